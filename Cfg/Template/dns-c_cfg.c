@@ -104,6 +104,18 @@ const  DNSc_CFG  DNSc_Cfg = {
     DNSc_DFLT_REQ_RETRY_TIMEOUT_MS,
                                 /* Default value: [DNSc_DFLT_REQ_RETRY_TIMEOUT_MS] = 1000ms */
                                 /* [MUST be >= 100]                                         */
+
+
+                                /* Configure static hosts table (answered w/o request):     */
+    DEF_NULL,                   /* [Pointer] to an array of host name/address pairs.        */
+    0,                          /* Number of entries in the array.                          */
+    DEF_NULL,                   /* [Pointer] to a string in /etc/hosts format.              */
+                                /* [DEF_NULL] if no static host is needed.                  */
+
+
+                                /* Configure clock used for timeouts, TTLs & delays:        */
+    DEF_NULL,                   /* [Pointer] to the clock functions.                        */
+                                /* [DEF_NULL] to use NetUtil_TS_Get_ms() & KAL_Dly().       */
 };
 
 
@@ -132,9 +144,14 @@ const  DNSc_CFG  DNSc_Cfg = {
 #define  DNSc_OS_CFG_INSTANCE_TASK_STK_SIZE             512
 #endif
 
+#ifndef  DNSc_OS_CFG_INSTANCE_TASK_WORKER_NBR                   /* Nbr of resolver tasks, each w/ the prio & stk size.  */
+#define  DNSc_OS_CFG_INSTANCE_TASK_WORKER_NBR             1
+#endif
+
 const  DNSc_CFG_TASK  DNSc_CfgTask = {
                                          DNSc_OS_CFG_INSTANCE_TASK_PRIO,
                                          DNSc_OS_CFG_INSTANCE_TASK_STK_SIZE,
-                                         DEF_NULL
+                                         DEF_NULL,
+                                         DNSc_OS_CFG_INSTANCE_TASK_WORKER_NBR
                                      };
 #endif
@@ -71,6 +71,44 @@
 *
 *               (b) When DISABLED, The API to get remote host will always be non-blocking, must poll DNS client to
 *                   know when the resolution is completed.
+*
+*           (3) Configure DNSc_CFG_CACHE_SLAB_EN to select the memory layout of the cache:
+*
+*               (a) When ENABLED,  a single contiguous region is allocated at initialization & divided in one
+*                   fixed slot per cache entry. Each slot holds the host object, its addresses, its names, its
+*                   request configuration & its cache list element.
+*
+*               (b) When DISABLED, each element of a cache entry is allocated from its own dynamic pool.
+*
+*           (4) Configure DNSc_CFG_CACHE_FRONT_NBR_ENTRIES with the number of entries of the front cache. The
+*               front cache keeps a copy of the last forward answers returned by the cache so that repeated
+*               lookups of the same name bypass the cache lock. Set to 0 to disable the front cache.
+*
+*           (5) Configure DNSc_CFG_STATS_SERVER_NBR_MAX with the number of DNS servers for which the resolver
+*               statistics are kept (see DNSc_ResolverStatsGet()). Each server takes a slot the first time a
+*               request is sent to it; servers contacted once all slots are taken are only accounted for in the
+*               global statistics.
+*
+*           (6) Configure DNSc_CFG_REQ_PRIO_LOW_NBR_MAX with the maximum number of low-priority requests
+*               (DNSc_REQ_PRIO_LOW) that DNSc's task has on the wire at once. Further low-priority requests
+*               wait in the task's queue until one completes. Set to 0 for no limit.
+*
+*           (7) Configure DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX with the maximum number of requests, of any priority,
+*               that DNSc's task has in progress at once; each one holds a socket. Further requests wait in the
+*               task's queue, w/o a socket, until one completes. Set to 0 for no limit.
+*
+*           (8) Configure DNSc_CFG_REQ_SERVER_QPS_MAX with the maximum number of queries per second sent to a
+*               server, retransmissions included. Queries over the rate are delayed, not failed; up to one
+*               second of queries may be sent in a burst. The servers w/o statistics slot (see Note #5) share
+*               a single rate. Set to 0 for no limit.
+*
+*           (9) Configure DNSc_CFG_ADDR_SORT_EN to enable/disable the ordering of the addresses returned by
+*               DNSc_GetHost() w/ the DNSc_FLAG_ADDR_SORT flag (see 'dns-c.c  DNSc_GetHost()  Note #7').
+*
+*               (a) When ENABLED,  the addresses are ordered by the destination address selection rules of
+*                   RFC #6724 against the local interface addresses, & the IPv4 & IPv6 addresses alternate.
+*
+*               (b) When DISABLED, the addresses are returned in the order they were received.
 *********************************************************************************************************
 */
 
@@ -85,6 +123,35 @@
                                                                 /* DEF_DISABLED     Blocking option DISABLED            */
                                                                 /* DEF_ENABLED      Blocking option ENABLED             */
 
+
+                                                                /* Configure cache memory layout, See Note #3 ...       */
+#define  DNSc_CFG_CACHE_SLAB_EN                     DEF_DISABLED
+                                                                /* DEF_DISABLED     One dynamic pool per cache element  */
+                                                                /* DEF_ENABLED      Single slab w/ one slot per entry   */
+
+
+                                                                /* Configure front cache size, See Note #4 ...          */
+#define  DNSc_CFG_CACHE_FRONT_NBR_ENTRIES                    4u
+
+
+                                                                /* Configure nbr of servers w/ stats, See Note #5 ...   */
+#define  DNSc_CFG_STATS_SERVER_NBR_MAX                       2u
+
+
+                                                                /* Configure low-priority reqs in flight, See Note #6...*/
+#define  DNSc_CFG_REQ_PRIO_LOW_NBR_MAX                       4u
+
+                                                                /* Configure reqs in flight, See Note #7 ...            */
+#define  DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX                      0u
+
+                                                                /* Configure queries per sec per server, See Note #8 ...*/
+#define  DNSc_CFG_REQ_SERVER_QPS_MAX                         0u
+
+                                                                /* Configure address ordering, See Note #9 ...          */
+#define  DNSc_CFG_ADDR_SORT_EN                      DEF_DISABLED
+                                                                /* DEF_DISABLED     Addresses in order received         */
+                                                                /* DEF_ENABLED      Addresses ordered by RFC #6724      */
+
 /*
 *********************************************************************************************************
 *                                DNSc RUN-TIME STRUCTURE CONFIGURATION
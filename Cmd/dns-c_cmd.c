@@ -54,6 +54,8 @@
 #include  <Cmd/net_cmd_output.h>
 
 #include  <Source/shell.h>
+#include  <KAL/kal.h>
+#include  <lib_mem.h>
 
 
 /*
@@ -70,6 +72,28 @@
 
 #define  DNSc_CMD_OUTPUT_ERR_CLR_CACHE_FAIL    ("Cache clear failed : ")
 #define  DNSc_CMD_OUTPUT_ERR_SET_SERVER_FAIL   ("Set server failed : ")
+#define  DNSc_CMD_OUTPUT_ERR_STATS_FAIL        ("Stats get failed : ")
+#define  DNSc_CMD_OUTPUT_ERR_CACHE_DUMP_FAIL   ("Cache dump failed : ")
+
+#define  DNSc_CMD_ADDR_NBR_MAX                          50u
+#define  DNSc_CMD_MSG_LEN_MAX                          128u
+
+#define  DNSc_CMD_BENCH_CONCURRENCY_MAX                  8u
+#define  DNSc_CMD_BENCH_POLL_DLY_MS                      1u
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_cmd_bench_slot {
+    const  CPU_CHAR     *NamePtr;                               /* Name being resolved, DEF_NULL if slot is free.       */
+           NET_TS_MS     TS_ms;                                 /* TS the resolution was started at.                    */
+} DNSc_CMD_BENCH_SLOT;
 
 
 /*
@@ -95,11 +119,42 @@ static  CPU_INT16S DNScCmd_ClrCache     (CPU_INT16U          argc,
                                          SHELL_OUT_FNCT      out_fnct,
                                          SHELL_CMD_PARAM    *p_cmd_param);
 
+static  CPU_INT16S  DNScCmd_Stats       (CPU_INT16U          argc,
+                                         CPU_CHAR           *p_argv[],
+                                         SHELL_OUT_FNCT      out_fnct,
+                                         SHELL_CMD_PARAM    *p_cmd_param);
+
+static  CPU_INT16S  DNScCmd_CacheDump   (CPU_INT16U          argc,
+                                         CPU_CHAR           *p_argv[],
+                                         SHELL_OUT_FNCT      out_fnct,
+                                         SHELL_CMD_PARAM    *p_cmd_param);
+
+static  CPU_INT16S  DNScCmd_Bench       (CPU_INT16U          argc,
+                                         CPU_CHAR           *p_argv[],
+                                         SHELL_OUT_FNCT      out_fnct,
+                                         SHELL_CMD_PARAM    *p_cmd_param);
+
 static  CPU_INT16S  DNScCmd_Help        (CPU_INT16U          argc,
                                          CPU_CHAR           *p_argv[],
                                          SHELL_OUT_FNCT      out_fnct,
                                          SHELL_CMD_PARAM    *p_cmd_param);
 
+static  void        DNScCmd_StrCatNbr   (CPU_CHAR           *p_str,
+                                         CPU_INT32U          nbr);
+
+static  void        DNScCmd_AddrToStr   (DNSc_ADDR_OBJ      *p_addr,
+                                         CPU_CHAR           *p_str);
+
+static  CPU_INT16S  DNScCmd_OutputNbr   (CPU_CHAR           *p_label,
+                                         CPU_INT32U          nbr,
+                                         SHELL_OUT_FNCT      out_fnct,
+                                         SHELL_CMD_PARAM    *p_cmd_param);
+
+static  CPU_INT16S  DNScCmd_OutputLat   (CPU_CHAR           *p_label,
+                                         DNSc_LAT_HIST      *p_hist,
+                                         SHELL_OUT_FNCT      out_fnct,
+                                         SHELL_CMD_PARAM    *p_cmd_param);
+
 
 /*
 *********************************************************************************************************
@@ -114,6 +169,9 @@ static  SHELL_CMD DNSc_CmdTbl[] =
     {"dns_get_host",   DNScCmd_GetHost},
     {"dns_server_set", DNScCmd_SetServerAddr},
     {"dns_cache_clr",  DNScCmd_ClrCache},
+    {"dns_cache_dump", DNScCmd_CacheDump},
+    {"dns_stats",      DNScCmd_Stats},
+    {"dns_bench",      DNScCmd_Bench},
     {"dns_help",       DNScCmd_Help},
     {0, 0 }
 };
@@ -241,8 +299,8 @@ CPU_INT16S  DNScCmd_GetHost (CPU_INT16U        argc,
                              SHELL_CMD_PARAM  *p_cmd_param)
 {
     DNSc_STATUS     status;
-    DNSc_ADDR_OBJ   addrs[50];
-    CPU_INT08U      addr_ctr = 50u;
+    DNSc_ADDR_OBJ   addrs[DNSc_CMD_ADDR_NBR_MAX];
+    CPU_INT08U      addr_ctr = DNSc_CMD_ADDR_NBR_MAX;
     CPU_INT08U      ix;
     CPU_INT16S      output;
     DNSc_ERR        err;
@@ -255,6 +313,8 @@ CPU_INT16S  DNScCmd_GetHost (CPU_INT16U        argc,
 
 
     status = DNSc_GetHost(p_argv[1],
+                          DEF_NULL,
+                          0u,
                           addrs,
                          &addr_ctr,
                           DNSc_FLAG_NONE,
@@ -287,24 +347,9 @@ CPU_INT16S  DNScCmd_GetHost (CPU_INT16U        argc,
 
     for (ix = 0u; ix < addr_ctr; ix++) {
         CPU_CHAR  addr_str[NET_ASCII_LEN_MAX_ADDR_IP];
-        NET_ERR   net_err;
-
-        if (addrs[ix].Len == NET_IPv4_ADDR_LEN) {
-#ifdef  NET_IPv4_MODULE_EN
-            NET_IPv4_ADDR *p_addr = (NET_IPv4_ADDR *)addrs[ix].Addr;
 
 
-            NetASCII_IPv4_to_Str(*p_addr, addr_str, NET_ASCII_LEN_MAX_ADDR_IP, &net_err);
-#endif
-        } else {
-#ifdef  NET_IPv6_MODULE_EN
-            NET_IPv6_ADDR *p_addr = (NET_IPv6_ADDR *)addrs[ix].Addr;
-
-
-            NetASCII_IPv6_to_Str(p_addr, addr_str, DEF_NO, DEF_YES, &net_err);
-#endif
-        }
-
+        DNScCmd_AddrToStr(&addrs[ix], addr_str);
         output += NetCmd_OutputMsg(addr_str, DEF_YES, DEF_NO, DEF_YES, out_fnct, p_cmd_param);
     }
 
@@ -373,6 +418,370 @@ exit:
 }
 
 
+/*
+*********************************************************************************************************
+*                                           DNScCmd_Stats()
+*
+* Description : Command to output the cache & resolver statistics.
+*
+* Argument(s) : argc            is a count of the arguments supplied.
+*
+*               p_argv          an array of pointers to the strings which are those arguments.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : The number of positive data octets transmitted, if NO errors
+*
+*               SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+*
+*               SHELL_OUT_ERR,                                  otherwise
+*
+* Caller(s)   : Referenced in DNSc_CmdTbl.
+*
+* Note(s)     : (1) Latencies are output as percentiles of the response latency histograms, in ms (see
+*                   DNSc_StatsLatPctGet()).
+*********************************************************************************************************
+*/
+
+static  CPU_INT16S  DNScCmd_Stats (CPU_INT16U        argc,
+                                   CPU_CHAR         *p_argv[],
+                                   SHELL_OUT_FNCT    out_fnct,
+                                   SHELL_CMD_PARAM  *p_cmd_param)
+{
+    DNSc_CACHE_STATS      cache_stats;
+    DNSc_RESOLVER_STATS   res_stats;
+    DNSc_SERVER_STATS    *p_server;
+    CPU_CHAR              msg[DNSc_CMD_MSG_LEN_MAX];
+    CPU_INT16S            output;
+    CPU_INT16U            ix;
+    DNSc_ERR              err;
+
+
+    if (argc != 1) {
+        output = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+    DNSc_CacheStatsGet(&cache_stats, &err);
+    if (err == DNSc_ERR_NONE) {
+        DNSc_ResolverStatsGet(&res_stats, &err);
+    }
+    if (err != DNSc_ERR_NONE) {
+        Str_Copy(msg, DNSc_CMD_OUTPUT_ERR_STATS_FAIL);
+        DNScCmd_StrCatNbr(msg, err);
+        output = NetCmd_OutputError(msg, out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+                                                                /* ----------------------- CACHE ---------------------- */
+    output  = NetCmd_OutputMsg("Cache", DEF_YES, DEF_NO, DEF_NO, out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Entries         :", cache_stats.EntriesCur,         out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Entries peak    :", cache_stats.EntriesPeak,        out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Entries max     :", cache_stats.EntriesMax,         out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Hits            :", cache_stats.Hits,               out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Front hits      :", cache_stats.FrontHits,          out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Pending hits    :", cache_stats.PendingHits,        out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Misses          :", cache_stats.Misses,             out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Expirations     :", cache_stats.Expirations,        out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Evictions       :", cache_stats.Evictions,          out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Alloc fail host :", cache_stats.AllocFailHost,      out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Alloc fail name :", cache_stats.AllocFailName,      out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Alloc fail canon:", cache_stats.AllocFailCanonName, out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Alloc fail rev  :", cache_stats.AllocFailRevName,   out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Alloc fail cfg  :", cache_stats.AllocFailReqCfg,    out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Alloc fail item :", cache_stats.AllocFailItem,      out_fnct, p_cmd_param);
+
+                                                                /* --------------------- RESOLVER --------------------- */
+    output += NetCmd_OutputMsg("Resolver", DEF_YES, DEF_NO, DEF_NO, out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Requests        :", res_stats.Req,                  out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Retransmissions :", res_stats.ReTx,                 out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Timeouts        :", res_stats.Timeouts,             out_fnct, p_cmd_param);
+    output += DNScCmd_OutputLat("A    (ms)       :", &res_stats.QTypeLat[DNSc_STATS_QTYPE_A],    out_fnct, p_cmd_param);
+    output += DNScCmd_OutputLat("AAAA (ms)       :", &res_stats.QTypeLat[DNSc_STATS_QTYPE_AAAA], out_fnct, p_cmd_param);
+    output += DNScCmd_OutputLat("PTR  (ms)       :", &res_stats.QTypeLat[DNSc_STATS_QTYPE_PTR],  out_fnct, p_cmd_param);
+
+    for (ix = 0u; ix < DNSc_STATS_ERR_NBR; ix++) {              /* Only output the errors that occurred.                */
+        if (res_stats.Errs[ix] != 0u) {
+            Str_Copy(msg, "Error ");
+            if (ix == DNSc_STATS_ERR_OTHER) {
+                Str_Cat(msg, "other");
+            } else {
+                DNScCmd_StrCatNbr(msg, DNSc_StatsErrGet((DNSc_STATS_ERR)ix));
+            }
+            Str_Cat(msg, " :");
+            output += DNScCmd_OutputNbr(msg, res_stats.Errs[ix], out_fnct, p_cmd_param);
+        }
+    }
+
+                                                                /* ---------------------- SERVERS --------------------- */
+    for (ix = 0u; ix < DNSc_CFG_STATS_SERVER_NBR_MAX; ix++) {
+        p_server = &res_stats.Servers[ix];
+        if (p_server->Addr.Len == 0u) {
+            break;
+        }
+
+        Str_Copy(msg, "Server ");
+        DNScCmd_AddrToStr(&p_server->Addr, msg + Str_Len(msg));
+        output += NetCmd_OutputMsg(msg, DEF_YES, DEF_NO, DEF_NO, out_fnct, p_cmd_param);
+        output += DNScCmd_OutputNbr("Requests        :", p_server->Req,               out_fnct, p_cmd_param);
+        output += DNScCmd_OutputNbr("Retransmissions :", p_server->ReTx,              out_fnct, p_cmd_param);
+        output += DNScCmd_OutputNbr("Timeouts        :", p_server->Timeouts,          out_fnct, p_cmd_param);
+        output += DNScCmd_OutputLat("Latency (ms)    :", &p_server->Lat,              out_fnct, p_cmd_param);
+    }
+
+    output = NetCmd_OutputSuccess(out_fnct, p_cmd_param);
+
+exit:
+    return (output);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCmd_CacheDump()
+*
+* Description : Command to list the cache entries, with their state, remaining TTL & addresses.
+*
+* Argument(s) : argc            is a count of the arguments supplied.
+*
+*               p_argv          an array of pointers to the strings which are those arguments.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : The number of positive data octets transmitted, if NO errors
+*
+*               SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+*
+*               SHELL_OUT_ERR,                                  otherwise
+*
+* Caller(s)   : Referenced in DNSc_CmdTbl.
+*
+* Note(s)     : (1) The state is output as its DNSc_STATE value.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16S  DNScCmd_CacheDump (CPU_INT16U        argc,
+                                       CPU_CHAR         *p_argv[],
+                                       SHELL_OUT_FNCT    out_fnct,
+                                       SHELL_CMD_PARAM  *p_cmd_param)
+{
+    CPU_CHAR        name[DNSc_DFLT_HOST_NAME_LEN + 1u];
+    CPU_CHAR        msg[DNSc_CMD_MSG_LEN_MAX];
+    DNSc_ADDR_OBJ   addrs[DNSc_CMD_ADDR_NBR_MAX];
+    CPU_INT08U      addr_nbr;
+    CPU_INT08U      addr_ix;
+    CPU_INT16U      ix;
+    DNSc_STATE      state;
+    CPU_INT32U      ttl_ms;
+    CPU_INT16S      output = 0;
+    DNSc_ERR        err;
+
+
+    if (argc != 1) {
+        output = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+    for (ix = 0u; ix < DEF_INT_16U_MAX_VAL; ix++) {
+        addr_nbr = DNSc_CMD_ADDR_NBR_MAX;
+        DNSc_CacheEntryGet(ix, name, sizeof(name), &state, &ttl_ms, addrs, &addr_nbr, &err);
+        if (err == DNSc_ERR_CACHE_HOST_NOT_FOUND) {
+            break;
+        }
+        if (err != DNSc_ERR_NONE) {
+            Str_Copy(msg, DNSc_CMD_OUTPUT_ERR_CACHE_DUMP_FAIL);
+            DNScCmd_StrCatNbr(msg, err);
+            output = NetCmd_OutputError(msg, out_fnct, p_cmd_param);
+            goto exit;
+        }
+
+        output += NetCmd_OutputMsg(name, DEF_YES, DEF_NO, DEF_NO, out_fnct, p_cmd_param);
+
+        Str_Copy(msg, "State: ");                               /* See Note #1.                                         */
+        DNScCmd_StrCatNbr(msg, state);
+        Str_Cat(msg, "  TTL (s): ");
+        DNScCmd_StrCatNbr(msg, (ttl_ms + DEF_TIME_NBR_mS_PER_SEC - 1u) / DEF_TIME_NBR_mS_PER_SEC);
+        output += NetCmd_OutputMsg(msg, DEF_YES, DEF_NO, DEF_YES, out_fnct, p_cmd_param);
+
+        for (addr_ix = 0u; addr_ix < addr_nbr; addr_ix++) {
+            DNScCmd_AddrToStr(&addrs[addr_ix], msg);
+            output += NetCmd_OutputMsg(msg, DEF_YES, DEF_NO, DEF_YES, out_fnct, p_cmd_param);
+        }
+    }
+
+    output = NetCmd_OutputSuccess(out_fnct, p_cmd_param);
+
+exit:
+    return (output);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DNScCmd_Bench()
+*
+* Description : Command to benchmark host resolution: resolve a list of host names a number of times, with a
+*               number of concurrent resolutions, & output the throughput & latency.
+*
+*                   dns_bench <nbr> <concurrency> <host name> [<host name> ...]
+*
+* Argument(s) : argc            is a count of the arguments supplied.
+*
+*               p_argv          an array of pointers to the strings which are those arguments.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : The number of positive data octets transmitted, if NO errors
+*
+*               SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+*
+*               SHELL_OUT_ERR,                                  otherwise
+*
+* Caller(s)   : Referenced in DNSc_CmdTbl.
+*
+* Note(s)     : (1) Every resolution bypasses the cache (DNSc_FLAG_FORCE_RENEW) so that the DNS server is
+*                   queried each time. Running the benchmark replaces the cache entries of the names.
+*
+*               (2) Concurrent resolutions require the asynchronous mode. Otherwise, the concurrency is forced
+*                   to 1 & each resolution blocks until it is completed.
+*
+*               (3) The same name is resolved by a single host object: resolving the same name in more than
+*                   one slot at a time restarts the resolution in progress.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16S  DNScCmd_Bench (CPU_INT16U        argc,
+                                   CPU_CHAR         *p_argv[],
+                                   SHELL_OUT_FNCT    out_fnct,
+                                   SHELL_CMD_PARAM  *p_cmd_param)
+{
+    DNSc_CMD_BENCH_SLOT   slots[DNSc_CMD_BENCH_CONCURRENCY_MAX];
+    DNSc_CMD_BENCH_SLOT  *p_slot;
+    DNSc_LAT_HIST         hist;
+    DNSc_ADDR_OBJ         addrs[DNSc_CMD_ADDR_NBR_MAX];
+    CPU_INT08U            addr_nbr;
+    DNSc_STATUS           status;
+    DNSc_FLAGS            flags;
+    CPU_INT32U            nbr;
+    CPU_INT32U            concurrency;
+    CPU_INT32U            name_nbr;
+    CPU_INT32U            req_nbr;
+    CPU_INT32U            req_ix   = 0u;
+    CPU_INT32U            done_nbr = 0u;
+    CPU_INT32U            fail_nbr = 0u;
+    CPU_INT32U            ix;
+    CPU_BOOLEAN           pending;
+    NET_TS_MS             ts_start_ms;
+    NET_TS_MS             ts_cur_ms;
+    NET_TS_MS             elapsed_ms;
+    CPU_INT16S            output;
+    DNSc_ERR              err;
+
+
+    if (argc < 4) {
+        output = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+    nbr         = Str_ParseNbr_Int32U(p_argv[1], DEF_NULL, DEF_NBR_BASE_DEC);
+    concurrency = Str_ParseNbr_Int32U(p_argv[2], DEF_NULL, DEF_NBR_BASE_DEC);
+    name_nbr    = argc - 3u;
+    if ((nbr         == 0u) ||
+        (concurrency == 0u)) {
+        output = NetCmd_OutputCmdArgInvalid(out_fnct, p_cmd_param);
+        goto exit;
+    }
+
+#ifdef  DNSc_TASK_MODULE_EN
+    concurrency = DEF_MIN(concurrency, DNSc_CMD_BENCH_CONCURRENCY_MAX);
+#else
+    concurrency = 1u;                                           /* See Note #2.                                         */
+#endif
+    req_nbr     = nbr * name_nbr;
+
+    Mem_Clr(slots, sizeof(slots));
+    Mem_Clr(&hist, sizeof(hist));
+
+    ts_start_ms = NetUtil_TS_Get_ms();
+
+    while (done_nbr < req_nbr) {
+        pending = DEF_NO;
+
+        for (ix = 0u; ix < concurrency; ix++) {
+            p_slot = &slots[ix];
+
+            if (p_slot->NamePtr == DEF_NULL) {                  /* Start a new resolution (see Note #1).                */
+                if (req_ix >= req_nbr) {
+                    continue;
+                }
+                p_slot->NamePtr = p_argv[3u + (req_ix % name_nbr)];
+                p_slot->TS_ms   = NetUtil_TS_Get_ms();
+                req_ix++;
+                flags           = DNSc_FLAG_FORCE_RENEW;
+            } else {                                            /* Poll the resolution in progress.                     */
+                flags           = DNSc_FLAG_FORCE_CACHE;
+            }
+#ifdef  DNSc_TASK_MODULE_EN
+            DEF_BIT_SET(flags, DNSc_FLAG_NO_BLOCK);
+#endif
+
+            addr_nbr = DNSc_CMD_ADDR_NBR_MAX;
+            status   = DNSc_GetHost(p_slot->NamePtr,
+                                    DEF_NULL,
+                                    0u,
+                                    addrs,
+                                   &addr_nbr,
+                                    flags,
+                                    DEF_NULL,
+                                   &err);
+            if ((status == DNSc_STATUS_PENDING) &&
+               ((err    == DNSc_ERR_NONE) ||
+                (err    == DNSc_ERR_CACHE_HOST_PENDING))) {
+                pending = DEF_YES;
+                continue;
+            }
+
+            ts_cur_ms = NetUtil_TS_Get_ms();
+            if ((status == DNSc_STATUS_RESOLVED) &&
+                (err    == DNSc_ERR_NONE)) {
+                DNSc_StatsLatAdd(&hist, ts_cur_ms - p_slot->TS_ms);
+            } else {
+                fail_nbr++;
+            }
+            p_slot->NamePtr = DEF_NULL;
+            done_nbr++;
+        }
+
+        if (pending == DEF_YES) {
+            KAL_Dly(DNSc_CMD_BENCH_POLL_DLY_MS);
+        }
+    }
+
+    elapsed_ms = NetUtil_TS_Get_ms() - ts_start_ms;
+    if (elapsed_ms == 0u) {
+        elapsed_ms = 1u;
+    }
+
+    output  = DNScCmd_OutputNbr("Resolutions     :", done_nbr,                          out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Failures        :", fail_nbr,                          out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Concurrency     :", concurrency,                       out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Time (ms)       :", elapsed_ms,                        out_fnct, p_cmd_param);
+    output += DNScCmd_OutputNbr("Throughput (/s) :", (CPU_INT32U)(((CPU_INT64U)done_nbr * DEF_TIME_NBR_mS_PER_SEC) / elapsed_ms), out_fnct, p_cmd_param);
+    output += DNScCmd_OutputLat("Latency (ms)    :", &hist,                             out_fnct, p_cmd_param);
+
+    output = NetCmd_OutputSuccess(out_fnct, p_cmd_param);
+
+exit:
+    return (output);
+}
+
+
 /*
 *********************************************************************************************************
 *                                            DNScCmd_Help()
@@ -412,3 +821,173 @@ static  CPU_INT16S DNScCmd_Help (CPU_INT16U        argc,
     return (ret_val);
 }
 
+
+/*
+*********************************************************************************************************
+*                                         DNScCmd_StrCatNbr()
+*
+* Description : Append the decimal representation of a number to a string.
+*
+* Argument(s) : p_str   Pointer to the string.
+*
+*               nbr     Number to append.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCmd_CacheDump(),
+*               DNScCmd_OutputLat(),
+*               DNScCmd_OutputNbr(),
+*               DNScCmd_Stats().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScCmd_StrCatNbr (CPU_CHAR    *p_str,
+                                 CPU_INT32U   nbr)
+{
+    CPU_CHAR  nbr_str[DEF_INT_32U_NBR_DIG_MAX + 1u];
+
+
+    (void)Str_FmtNbr_Int32U(nbr,
+                            DEF_INT_32U_NBR_DIG_MAX,
+                            DEF_NBR_BASE_DEC,
+                            ASCII_CHAR_NULL,
+                            DEF_NO,
+                            DEF_YES,
+                            nbr_str);
+
+    Str_Cat(p_str, nbr_str);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCmd_AddrToStr()
+*
+* Description : Convert an address returned by DNSc to its string representation.
+*
+* Argument(s) : p_addr  Pointer to the address.
+*
+*               p_str   Pointer to the buffer that will receive the string (see Note #1).
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCmd_CacheDump(),
+*               DNScCmd_GetHost(),
+*               DNScCmd_Stats().
+*
+* Note(s)     : (1) The buffer must be at least NET_ASCII_LEN_MAX_ADDR_IP long.
+*********************************************************************************************************
+*/
+
+static  void  DNScCmd_AddrToStr (DNSc_ADDR_OBJ  *p_addr,
+                                 CPU_CHAR       *p_str)
+{
+    NET_ERR  net_err;
+
+
+   *p_str = ASCII_CHAR_NULL;
+
+    if (p_addr->Len == NET_IPv4_ADDR_LEN) {
+#ifdef  NET_IPv4_MODULE_EN
+        NET_IPv4_ADDR *p_addr_ipv4 = (NET_IPv4_ADDR *)p_addr->Addr;
+
+
+        NetASCII_IPv4_to_Str(*p_addr_ipv4, p_str, DEF_NO, &net_err);
+#endif
+    } else {
+#ifdef  NET_IPv6_MODULE_EN
+        NET_IPv6_ADDR *p_addr_ipv6 = (NET_IPv6_ADDR *)p_addr->Addr;
+
+
+        NetASCII_IPv6_to_Str(p_addr_ipv6, p_str, DEF_NO, DEF_YES, &net_err);
+#endif
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCmd_OutputNbr()
+*
+* Description : Output a labelled number on its own line.
+*
+* Argument(s) : p_label         Pointer to the label.
+*
+*               nbr             Number to output.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : Value returned by NetCmd_OutputMsg().
+*
+* Caller(s)   : DNScCmd_Bench(),
+*               DNScCmd_Stats().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16S  DNScCmd_OutputNbr (CPU_CHAR         *p_label,
+                                       CPU_INT32U        nbr,
+                                       SHELL_OUT_FNCT    out_fnct,
+                                       SHELL_CMD_PARAM  *p_cmd_param)
+{
+    CPU_CHAR  msg[DNSc_CMD_MSG_LEN_MAX];
+
+
+    Str_Copy_N(msg, p_label, DNSc_CMD_MSG_LEN_MAX - DEF_INT_32U_NBR_DIG_MAX - 2u);
+    Str_Cat(msg, " ");
+    DNScCmd_StrCatNbr(msg, nbr);
+
+    return (NetCmd_OutputMsg(msg, DEF_YES, DEF_NO, DEF_YES, out_fnct, p_cmd_param));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCmd_OutputLat()
+*
+* Description : Output the number of samples & the percentiles of a latency histogram on its own line.
+*
+* Argument(s) : p_label         Pointer to the label.
+*
+*               p_hist          Pointer to the histogram.
+*
+*               out_fnct        is a callback to a respond to the requester.
+*
+*               p_cmd_param     is a pointer to additional information to pass to the command.
+*
+* Return(s)   : Value returned by NetCmd_OutputMsg().
+*
+* Caller(s)   : DNScCmd_Bench(),
+*               DNScCmd_Stats().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16S  DNScCmd_OutputLat (CPU_CHAR         *p_label,
+                                       DNSc_LAT_HIST    *p_hist,
+                                       SHELL_OUT_FNCT    out_fnct,
+                                       SHELL_CMD_PARAM  *p_cmd_param)
+{
+    CPU_CHAR  msg[DNSc_CMD_MSG_LEN_MAX];
+
+
+    Str_Copy_N(msg, p_label, 32u);
+    Str_Cat(msg, " n=");
+    DNScCmd_StrCatNbr(msg, p_hist->Nbr);
+    Str_Cat(msg, " p50=");
+    DNScCmd_StrCatNbr(msg, DNSc_StatsLatPctGet(p_hist, 50u));
+    Str_Cat(msg, " p90=");
+    DNScCmd_StrCatNbr(msg, DNSc_StatsLatPctGet(p_hist, 90u));
+    Str_Cat(msg, " p99=");
+    DNScCmd_StrCatNbr(msg, DNSc_StatsLatPctGet(p_hist, 99u));
+    Str_Cat(msg, " max=");
+    DNScCmd_StrCatNbr(msg, p_hist->Max_ms);
+
+    return (NetCmd_OutputMsg(msg, DEF_YES, DEF_NO, DEF_YES, out_fnct, p_cmd_param));
+}
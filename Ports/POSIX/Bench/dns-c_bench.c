@@ -0,0 +1,733 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                         BENCHMARK DRIVER
+*
+* Filename : dns-c_bench.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) The driver measures the throughput & latency of blocking DNSc_GetHost() calls against the
+*                stub responder (see 'dns-c_bench_responder.h'), for one of three workloads:
+*
+*                (a) 'hit'   : every request is for one of the names resolved during the warm-up phase.
+*
+*                (b) 'miss'  : every request is for a name never requested before, so that each one is
+*                              resolved by the responder.
+*
+*                (c) 'mixed' : 'hit_pct' percent of the requests are hits, the others are misses.
+*
+*            (2) The cache & resolver statistics are reset after the warm-up phase, so that the reported
+*                statistics only cover the measured requests.
+*
+*            (3) Misses add entries to the cache, & may therefore evict warm names once the cache is full;
+*                the cache statistics report it.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  700
+
+#include  <pthread.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+#include  <unistd.h>
+
+#include  <Source/dns-c.h>
+
+#include  "dns-c_bench_responder.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_BENCH_PORT_DFLT                          10053u
+#define  DNSc_BENCH_WARM_NBR_DFLT                         64u
+#define  DNSc_BENCH_REQ_NBR_DFLT                       10000u
+#define  DNSc_BENCH_HIT_PCT_DFLT                          90u
+#define  DNSc_BENCH_THREAD_NBR_MAX                        64u
+
+#define  DNSc_BENCH_NAME_LEN_MAX                          64u
+#define  DNSc_BENCH_ADDR_NBR_MAX                           4u
+
+#define  DNSc_BENCH_SUFFIX                      "bench.test"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  enum  dnsc_bench_workload {
+    DNSc_BENCH_WORKLOAD_HIT,
+    DNSc_BENCH_WORKLOAD_MISS,
+    DNSc_BENCH_WORKLOAD_MIXED
+} DNSc_BENCH_WORKLOAD;
+
+
+typedef  struct  dnsc_bench_worker {
+    pthread_t       Thread;
+    CPU_INT32U      ID;
+    CPU_INT32U      ReqNbr;                                     /* Nbr of req to issue.                                 */
+    CPU_INT32U     *LatTblPtr;                                  /* Latency of each req, in microseconds.                */
+    CPU_INT32U      Fails;                                      /* Nbr of req that did not resolve.                     */
+    CPU_INT32U      Hits;                                       /* Nbr of req issued for a warm name.                   */
+    unsigned  int   Seed;
+} DNSc_BENCH_WORKER;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  const  DNSc_BENCH_REC  DNScBench_RecTbl[] = {           /* Served before the synthesized names.                 */
+    { "www."   DNSc_BENCH_SUFFIX, "192.0.2.10"   },
+    { "www."   DNSc_BENCH_SUFFIX, "2001:db8::10" },
+    { "v4."    DNSc_BENCH_SUFFIX, "192.0.2.4"    },
+    { "v6."    DNSc_BENCH_SUFFIX, "2001:db8::6"  },
+    { "multi." DNSc_BENCH_SUFFIX, "192.0.2.21"   },
+    { "multi." DNSc_BENCH_SUFFIX, "192.0.2.22"   },
+};
+
+static  const  CPU_CHAR  *DNScBench_RecNameTbl[] = {            /* Rec names that hold an IPv4 addr come first, ...     */
+    "v4."    DNSc_BENCH_SUFFIX,
+    "multi." DNSc_BENCH_SUFFIX,
+    "www."   DNSc_BENCH_SUFFIX,
+    "v6."    DNSc_BENCH_SUFFIX,                                 /* ... then those that hold an IPv6 addr.               */
+};
+
+static  DNSc_BENCH_WORKLOAD  DNScBench_Workload = DNSc_BENCH_WORKLOAD_MIXED;
+static  CPU_INT32U           DNScBench_WarmNbr  = DNSc_BENCH_WARM_NBR_DFLT;
+static  CPU_INT32U           DNScBench_HitPct   = DNSc_BENCH_HIT_PCT_DFLT;
+static  DNSc_FLAGS           DNScBench_Flags    = DNSc_FLAG_NONE;
+static  DNSc_REQ_CFG         DNScBench_ReqCfg;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN   DNScBench_Resolve     (const  CPU_CHAR  *p_name);
+
+static  void          DNScBench_WarmNameGet (       CPU_INT32U  ix,
+                                                    CPU_CHAR   *p_name);
+
+static  void         *DNScBench_WorkerTask  (       void       *p_arg);
+
+static  CPU_INT64U    DNScBench_TS_Get_us   (       void);
+
+static  int           DNScBench_LatCmp      (const  void       *p_lat_1,
+                                             const  void       *p_lat_2);
+
+static  void          DNScBench_Usage       (const  char       *p_prog);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Start the responder & DNSc, warm the cache up, run the workload & report the results.
+*
+* Argument(s) : argc        Nbr of command line arguments.
+*
+*               argv        Command line arguments (see DNScBench_Usage()).
+*
+* Return(s)   : EXIT_SUCCESS, if every request resolved.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host's C runtime.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    DNSc_BENCH_RESPONDER_CFG    responder_cfg;
+    DNSc_BENCH_RESPONDER_STATS  responder_stats;
+    DNSc_BENCH_WORKER           workers[DNSc_BENCH_THREAD_NBR_MAX];
+    DNSc_CFG_TASK               task_cfg;
+    DNSc_CACHE_STATS            cache_stats;
+    DNSc_RESOLVER_STATS         resolver_stats;
+    CPU_CHAR                    name[DNSc_BENCH_NAME_LEN_MAX];
+    CPU_INT32U                 *p_lat_tbl;
+    CPU_INT32U                  req_nbr     = DNSc_BENCH_REQ_NBR_DFLT;
+    CPU_INT32U                  thread_nbr  = 1u;
+    CPU_INT32U                  deadline_ms = 0u;
+    CPU_INT32U                  fails;
+    CPU_INT32U                  warm_fails;
+    CPU_INT32U                  hits;
+    CPU_INT32U                  ix;
+    CPU_INT32U                  lat_ix;
+    CPU_INT64U                  ts_start_us;
+    CPU_INT64U                  elapsed_us;
+    CPU_INT08U                  qtype;
+    DNSc_ERR                    err;
+    int                         opt;
+    static  const  char        *qtype_name_tbl[DNSc_STATS_QTYPE_NBR] = { "A", "AAAA", "PTR" };
+
+
+    Mem_Clr(&responder_cfg, sizeof(responder_cfg));
+    responder_cfg.Port           = DNSc_BENCH_PORT_DFLT;
+    responder_cfg.TTL_s          = 3600u;
+    responder_cfg.RecTblPtr      = DNScBench_RecTbl;
+    responder_cfg.RecNbr         = sizeof(DNScBench_RecTbl) / sizeof(DNScBench_RecTbl[0]);
+    responder_cfg.SynthSuffixPtr = DNSc_BENCH_SUFFIX;
+    responder_cfg.Seed           = 1u;
+    task_cfg                     = DNSc_CfgTask;
+
+                                                                /* ------------------- PARSE OPTIONS ------------------ */
+    while ((opt = getopt(argc, argv, "p:l:j:L:n:r:w:m:t:f:s:W:D:q:SP")) != -1) {
+        switch (opt) {
+            case 'p':
+                 responder_cfg.Port       = (NET_PORT_NBR)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'l':
+                 responder_cfg.Latency_ms = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'j':
+                 responder_cfg.Jitter_ms  = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'L':
+                 responder_cfg.LossPct    = (CPU_INT08U)DEF_MIN(strtoul(optarg, DEF_NULL, 10), 100u);
+                 break;
+
+            case 's':
+                 responder_cfg.Seed       = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'n':
+                 DNScBench_WarmNbr        = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'r':
+                 req_nbr                  = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'm':
+                 DNScBench_HitPct         = (CPU_INT32U)DEF_MIN(strtoul(optarg, DEF_NULL, 10), 100u);
+                 break;
+
+            case 't':
+                 thread_nbr               = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'W':
+                 task_cfg.WorkerNbr       = (CPU_INT08U)DEF_MIN(strtoul(optarg, DEF_NULL, 10), DEF_INT_08U_MAX_VAL);
+                 break;
+
+            case 'D':
+                 deadline_ms              = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'w':
+                 if (strcmp(optarg, "hit") == 0) {
+                     DNScBench_Workload = DNSc_BENCH_WORKLOAD_HIT;
+                 } else if (strcmp(optarg, "miss") == 0) {
+                     DNScBench_Workload = DNSc_BENCH_WORKLOAD_MISS;
+                 } else if (strcmp(optarg, "mixed") == 0) {
+                     DNScBench_Workload = DNSc_BENCH_WORKLOAD_MIXED;
+                 } else {
+                     DNScBench_Usage(argv[0]);
+                     return (EXIT_FAILURE);
+                 }
+                 break;
+
+            case 'q':
+                 if (strcmp(optarg, "high") == 0) {
+                     DNScBench_ReqCfg.ReqPrio = DNSc_REQ_PRIO_HIGH;
+                 } else if (strcmp(optarg, "normal") == 0) {
+                     DNScBench_ReqCfg.ReqPrio = DNSc_REQ_PRIO_NORMAL;
+                 } else if (strcmp(optarg, "low") == 0) {
+                     DNScBench_ReqCfg.ReqPrio = DNSc_REQ_PRIO_LOW;
+                 } else {
+                     DNScBench_Usage(argv[0]);
+                     return (EXIT_FAILURE);
+                 }
+                 break;
+
+            case 'f':
+                 DEF_BIT_CLR(DNScBench_Flags, (DNSc_FLAGS)(DNSc_FLAG_IPv4_ONLY | DNSc_FLAG_IPv6_ONLY));
+                 if (strcmp(optarg, "4") == 0) {
+                     DEF_BIT_SET(DNScBench_Flags, DNSc_FLAG_IPv4_ONLY);
+                 } else if (strcmp(optarg, "6") == 0) {
+                     DEF_BIT_SET(DNScBench_Flags, DNSc_FLAG_IPv6_ONLY);
+                 } else if (strcmp(optarg, "any") != 0) {
+                     DNScBench_Usage(argv[0]);
+                     return (EXIT_FAILURE);
+                 }
+                 break;
+
+            case 'S':
+                 DEF_BIT_SET(DNScBench_Flags, DNSc_FLAG_ADDR_SORT);
+                 break;
+
+            case 'P':
+                 DEF_BIT_SET(DNScBench_Flags, DNSc_FLAG_PARTIAL);
+                 break;
+
+            default:
+                 DNScBench_Usage(argv[0]);
+                 return (EXIT_FAILURE);
+        }
+    }
+
+    if ((thread_nbr        <  1u)                        ||
+        (thread_nbr        >  DNSc_BENCH_THREAD_NBR_MAX) ||
+        (req_nbr           <  thread_nbr)                ||
+        (DNScBench_WarmNbr <  1u)                        ||
+        (DNScBench_WarmNbr >= DNSc_Cfg.CacheEntriesMaxNbr)) {
+        DNScBench_Usage(argv[0]);
+        return (EXIT_FAILURE);
+    }
+
+                                                                /* ---------------- START RESPONDER & DNSc ------------ */
+    if (DNScBench_ResponderStart(&responder_cfg) != DEF_OK) {
+        fprintf(stderr, "responder: cannot listen on 127.0.0.1:%u\n", (unsigned)responder_cfg.Port);
+        return (EXIT_FAILURE);
+    }
+
+    DNSc_Init(&DNSc_Cfg, &task_cfg, &err);
+    if (err != DNSc_ERR_NONE) {
+        fprintf(stderr, "DNSc_Init() failed: %d\n", (int)err);
+        return (EXIT_FAILURE);
+    }
+
+    DNScBench_ReqCfg.ServerAddrPtr  = DEF_NULL;                 /* Dflt server, at the responder's port.                */
+    DNScBench_ReqCfg.ServerPort     = responder_cfg.Port;
+    DNScBench_ReqCfg.TaskDly_ms     = DNSc_Cfg.TaskDly_ms;
+    DNScBench_ReqCfg.ReqTimeout_ms  = DNSc_Cfg.ReqRetryTimeout_ms;
+    DNScBench_ReqCfg.ReqDeadline_ms = deadline_ms;
+    DNScBench_ReqCfg.ReqRetry       = DNSc_Cfg.ReqRetryNbrMax;
+
+                                                                /* ---------------------- WARM UP --------------------- */
+    warm_fails = 0u;
+    for (ix = 0u; ix < DNScBench_WarmNbr; ix++) {
+        DNScBench_WarmNameGet(ix, name);
+        if (DNScBench_Resolve(name) != DEF_OK) {                /* Lost queries may fail a few warm names.              */
+            warm_fails++;
+        }
+    }
+
+    DNSc_CacheStatsReset(&err);                                 /* See Note #2.                                         */
+    DNSc_ResolverStatsReset(&err);
+
+                                                                /* ------------------- RUN WORKLOAD ------------------- */
+    p_lat_tbl = (CPU_INT32U *)malloc(req_nbr * sizeof(CPU_INT32U));
+    if (p_lat_tbl == DEF_NULL) {
+        return (EXIT_FAILURE);
+    }
+
+    ts_start_us = DNScBench_TS_Get_us();
+    lat_ix      = 0u;
+    for (ix = 0u; ix < thread_nbr; ix++) {
+        workers[ix].ID        = ix;
+        workers[ix].ReqNbr    = req_nbr / thread_nbr + ((ix < req_nbr % thread_nbr) ? 1u : 0u);
+        workers[ix].LatTblPtr = &p_lat_tbl[lat_ix];
+        workers[ix].Fails     = 0u;
+        workers[ix].Hits      = 0u;
+        workers[ix].Seed      = responder_cfg.Seed + ix;
+        lat_ix               += workers[ix].ReqNbr;
+        if (pthread_create(&workers[ix].Thread, DEF_NULL, DNScBench_WorkerTask, &workers[ix]) != 0) {
+            return (EXIT_FAILURE);
+        }
+    }
+
+    fails = 0u;
+    hits  = 0u;
+    for (ix = 0u; ix < thread_nbr; ix++) {
+        (void)pthread_join(workers[ix].Thread, DEF_NULL);
+        fails += workers[ix].Fails;
+        hits  += workers[ix].Hits;
+    }
+    elapsed_us = DNScBench_TS_Get_us() - ts_start_us;
+
+                                                                /* ------------------- REPORT RESULTS ----------------- */
+    qsort(p_lat_tbl, req_nbr, sizeof(CPU_INT32U), DNScBench_LatCmp);
+
+    printf("workload     : %s (%u%% warm), %u req, %u thread(s), %u worker(s), %u warm name(s)\n",
+           (DNScBench_Workload == DNSc_BENCH_WORKLOAD_HIT)  ? "hit"  :
+           (DNScBench_Workload == DNSc_BENCH_WORKLOAD_MISS) ? "miss" : "mixed",
+           (unsigned)((hits * 100u) / req_nbr),
+           (unsigned)req_nbr,
+           (unsigned)thread_nbr,
+           (unsigned)DEF_MAX(task_cfg.WorkerNbr, 1u),
+           (unsigned)DNScBench_WarmNbr);
+    printf("responder    : latency %u ms, jitter %u ms, loss %u%%\n",
+           (unsigned)responder_cfg.Latency_ms,
+           (unsigned)responder_cfg.Jitter_ms,
+           (unsigned)responder_cfg.LossPct);
+    printf("throughput   : %.0f req/s (%.3f s)\n",
+           (elapsed_us > 0u) ? ((double)req_nbr * 1000000.0 / (double)elapsed_us) : 0.0,
+           (double)elapsed_us / 1000000.0);
+    printf("latency (us) : p50 %u, p90 %u, p99 %u, max %u\n",
+           (unsigned)p_lat_tbl[(req_nbr * 50u) / 100u],
+           (unsigned)p_lat_tbl[(req_nbr * 90u) / 100u],
+           (unsigned)p_lat_tbl[(req_nbr * 99u) / 100u],
+           (unsigned)p_lat_tbl[req_nbr - 1u]);
+    printf("failures     : %u (warm-up: %u)\n", (unsigned)fails, (unsigned)warm_fails);
+
+    DNSc_CacheStatsGet(&cache_stats, &err);
+    printf("cache        : hits %u (front %u), pending %u, misses %u, expirations %u, evictions %u, entries %u/%u (peak %u)\n",
+           (unsigned)cache_stats.Hits,
+           (unsigned)cache_stats.FrontHits,
+           (unsigned)cache_stats.PendingHits,
+           (unsigned)cache_stats.Misses,
+           (unsigned)cache_stats.Expirations,
+           (unsigned)cache_stats.Evictions,
+           (unsigned)cache_stats.EntriesCur,
+           (unsigned)cache_stats.EntriesMax,
+           (unsigned)cache_stats.EntriesPeak);
+
+    DNSc_ResolverStatsGet(&resolver_stats, &err);
+    printf("resolver     : req %u, retransmissions %u, timeouts %u, deadlines %u\n",
+           (unsigned)resolver_stats.Req,
+           (unsigned)resolver_stats.ReTx,
+           (unsigned)resolver_stats.Timeouts,
+           (unsigned)resolver_stats.Errs[DNSc_STATS_ERR_DEADLINE]);
+    for (qtype = 0u; qtype < DNSc_STATS_QTYPE_NBR; qtype++) {
+        if (resolver_stats.QTypeLat[qtype].Nbr > 0u) {
+            printf("  %-4s (ms)  : n %u, p50 %u, p99 %u, max %u\n",
+                   qtype_name_tbl[qtype],
+                   (unsigned)resolver_stats.QTypeLat[qtype].Nbr,
+                   (unsigned)DNSc_StatsLatPctGet(&resolver_stats.QTypeLat[qtype], 50u),
+                   (unsigned)DNSc_StatsLatPctGet(&resolver_stats.QTypeLat[qtype], 99u),
+                   (unsigned)resolver_stats.QTypeLat[qtype].Max_ms);
+        }
+    }
+
+    DNScBench_ResponderStatsGet(&responder_stats);
+    printf("responder    : rx %u, dropped %u, answered %u, empty %u, nxdomain %u, malformed %u\n",
+           (unsigned)responder_stats.Rx,
+           (unsigned)responder_stats.Dropped,
+           (unsigned)responder_stats.Answered,
+           (unsigned)responder_stats.Empty,
+           (unsigned)responder_stats.NameErr,
+           (unsigned)responder_stats.Malformed);
+
+    free(p_lat_tbl);
+
+    return ((fails == 0u) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         DNScBench_Resolve()
+*
+* Description : Resolve a host name w/ a blocking DNSc_GetHost() call.
+*
+* Argument(s) : p_name      Pointer to the host name.
+*
+* Return(s)   : DEF_OK,   if the name resolved to at least one address.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : main(),
+*               DNScBench_WorkerTask().
+*
+* Note(s)     : (1) A blocking call returns DNSc_STATUS_PENDING when another worker is resolving the same
+*                   name; the call is repeated until that resolution completes.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DNScBench_Resolve (const  CPU_CHAR  *p_name)
+{
+    DNSc_ADDR_OBJ  addrs[DNSc_BENCH_ADDR_NBR_MAX];
+    DNSc_REQ_CFG   req_cfg;
+    CPU_INT08U     addr_nbr;
+    DNSc_STATUS    status;
+    DNSc_ERR       err;
+
+
+    do {
+        req_cfg  = DNScBench_ReqCfg;
+        addr_nbr = DNSc_BENCH_ADDR_NBR_MAX;
+        status   = DNSc_GetHost(p_name,
+                                DEF_NULL,
+                                0u,
+                                addrs,
+                               &addr_nbr,
+                                DNScBench_Flags,
+                               &req_cfg,
+                               &err);
+        if (status == DNSc_STATUS_PENDING) {                    /* See Note #1.                                         */
+            KAL_Dly(DNScBench_ReqCfg.TaskDly_ms);
+        }
+    } while (status == DNSc_STATUS_PENDING);
+
+    if ((status   != DNSc_STATUS_RESOLVED) ||
+        (addr_nbr == 0u)) {
+        return (DEF_FAIL);
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DNScBench_WarmNameGet()
+*
+* Description : Get the name of a warm entry.
+*
+* Argument(s) : ix          Index of the warm entry.
+*
+*               p_name      Pointer to a DNSc_BENCH_NAME_LEN_MAX characters buffer that will receive the name.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : main(),
+*               DNScBench_WorkerTask().
+*
+* Note(s)     : (1) The first warm entries are the names of the record table that hold an address of the
+*                   requested family; the others are synthesized.
+*********************************************************************************************************
+*/
+
+static  void  DNScBench_WarmNameGet (CPU_INT32U   ix,
+                                     CPU_CHAR    *p_name)
+{
+    CPU_INT32U  rec_first;
+    CPU_INT32U  rec_nbr;
+
+
+    rec_first = 0u;                                             /* See Note #1.                                         */
+    rec_nbr   = sizeof(DNScBench_RecNameTbl) / sizeof(DNScBench_RecNameTbl[0]);
+    if (DEF_BIT_IS_SET(DNScBench_Flags, DNSc_FLAG_IPv4_ONLY)) {
+        rec_nbr   = 3u;
+    } else if (DEF_BIT_IS_SET(DNScBench_Flags, DNSc_FLAG_IPv6_ONLY)) {
+        rec_first = 2u;
+        rec_nbr   = 2u;
+    }
+
+    if (ix < rec_nbr) {
+        (void)snprintf(p_name, DNSc_BENCH_NAME_LEN_MAX, "%s", DNScBench_RecNameTbl[rec_first + ix]);
+    } else {
+        (void)snprintf(p_name, DNSc_BENCH_NAME_LEN_MAX, "w%u.%s", (unsigned)ix, DNSc_BENCH_SUFFIX);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DNScBench_WorkerTask()
+*
+* Description : Issue a worker's share of the requests & record their latency.
+*
+* Argument(s) : p_arg       Pointer to the worker (see DNSc_BENCH_WORKER).
+*
+* Return(s)   : DEF_NULL.
+*
+* Caller(s)   : Referenced by main().
+*
+* Note(s)     : (1) Miss names embed the worker's ID, so that two workers never request the same name.
+*********************************************************************************************************
+*/
+
+static  void  *DNScBench_WorkerTask (void  *p_arg)
+{
+    DNSc_BENCH_WORKER  *p_worker = (DNSc_BENCH_WORKER *)p_arg;
+    CPU_CHAR            name[DNSc_BENCH_NAME_LEN_MAX];
+    CPU_INT32U          ix;
+    CPU_INT64U          ts_us;
+    CPU_BOOLEAN         is_hit;
+
+
+    for (ix = 0u; ix < p_worker->ReqNbr; ix++) {
+        switch (DNScBench_Workload) {
+            case DNSc_BENCH_WORKLOAD_HIT:
+                 is_hit = DEF_YES;
+                 break;
+
+            case DNSc_BENCH_WORKLOAD_MISS:
+                 is_hit = DEF_NO;
+                 break;
+
+            case DNSc_BENCH_WORKLOAD_MIXED:
+            default:
+                 is_hit = ((CPU_INT32U)(rand_r(&p_worker->Seed) % 100) < DNScBench_HitPct) ? DEF_YES : DEF_NO;
+                 break;
+        }
+
+        if (is_hit == DEF_YES) {
+            DNScBench_WarmNameGet((CPU_INT32U)rand_r(&p_worker->Seed) % DNScBench_WarmNbr, name);
+            p_worker->Hits++;
+        } else {                                                /* See Note #1.                                         */
+            (void)snprintf(name, sizeof(name), "m%u-%u.%s", (unsigned)p_worker->ID, (unsigned)ix, DNSc_BENCH_SUFFIX);
+        }
+
+        ts_us = DNScBench_TS_Get_us();
+        if (DNScBench_Resolve(name) != DEF_OK) {
+            p_worker->Fails++;
+        }
+        p_worker->LatTblPtr[ix] = (CPU_INT32U)(DNScBench_TS_Get_us() - ts_us);
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScBench_TS_Get_us()
+*
+* Description : Get the host's monotonic time, in microseconds.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Timestamp, in microseconds.
+*
+* Caller(s)   : main(),
+*               DNScBench_WorkerTask().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  DNScBench_TS_Get_us (void)
+{
+    struct  timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((CPU_INT64U)ts.tv_sec * DEF_TIME_NBR_uS_PER_SEC) + ((CPU_INT64U)ts.tv_nsec / 1000u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScBench_LatCmp()
+*
+* Description : Compare two latencies, for qsort().
+*
+* Argument(s) : p_lat_1     Pointer to the first latency.
+*
+*               p_lat_2     Pointer to the second latency.
+*
+* Return(s)   : Negative, zero or positive, as the first latency is lower, equal or higher.
+*
+* Caller(s)   : Referenced by main().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  int  DNScBench_LatCmp (const  void  *p_lat_1,
+                               const  void  *p_lat_2)
+{
+    CPU_INT32U  lat_1 = *(const CPU_INT32U *)p_lat_1;
+    CPU_INT32U  lat_2 = *(const CPU_INT32U *)p_lat_2;
+
+
+    return ((lat_1 > lat_2) - (lat_1 < lat_2));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScBench_Usage()
+*
+* Description : Print the command line usage.
+*
+* Argument(s) : p_prog      Pointer to the program name.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScBench_Usage (const  char  *p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  -w hit|miss|mixed  workload (default mixed)\n"
+            "  -m pct             warm requests in the mixed workload (default %u)\n"
+            "  -r nbr             number of requests (default %u)\n"
+            "  -n nbr             number of warm names, below the cache size (default %u)\n"
+            "  -t nbr             number of requesting threads, up to %u (default 1)\n"
+            "  -W nbr             number of DNSc worker tasks (default %u)\n"
+            "  -D ms              overall deadline of each request (default 0, none)\n"
+            "  -q high|normal|low priority of each request (default normal)\n"
+            "  -f 4|6|any         address family (default any)\n"
+            "  -S                 order the addresses (DNSc_FLAG_ADDR_SORT)\n"
+            "  -P                 return the IPv4 addresses first (DNSc_FLAG_PARTIAL)\n"
+            "  -p port            responder port on 127.0.0.1 (default %u)\n"
+            "  -l ms              responder latency (default 0)\n"
+            "  -j ms              responder jitter (default 0)\n"
+            "  -L pct             responder loss (default 0)\n"
+            "  -s seed            seed of the loss, jitter & workload generators (default 1)\n",
+            p_prog,
+            (unsigned)DNSc_BENCH_HIT_PCT_DFLT,
+            (unsigned)DNSc_BENCH_REQ_NBR_DFLT,
+            (unsigned)DNSc_BENCH_WARM_NBR_DFLT,
+            (unsigned)DNSc_BENCH_THREAD_NBR_MAX,
+            (unsigned)DNSc_CfgTask.WorkerNbr,
+            (unsigned)DNSc_BENCH_PORT_DFLT);
+}
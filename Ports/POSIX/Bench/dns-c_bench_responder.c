@@ -0,0 +1,812 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                     BENCHMARK STUB DNS RESPONDER
+*
+* Filename : dns-c_bench_responder.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) See 'dns-c_bench_responder.h  Note #1'.
+*
+*            (2) The responder runs in its own thread & uses the host's sockets directly, since it needs
+*                to reply to each client's address.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  700
+
+#include  <errno.h>
+#include  <poll.h>
+#include  <pthread.h>
+#include  <stdlib.h>
+#include  <unistd.h>
+#include  <arpa/inet.h>
+#include  <netinet/in.h>
+#include  <sys/socket.h>
+
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <lib_ascii.h>
+#include  <Source/net_util.h>
+
+#include  "dns-c_bench_responder.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_BENCH_NAME_LEN_MAX                         255u
+#define  DNSc_BENCH_REC_NBR_MAX                          256u
+#define  DNSc_BENCH_PENDING_NBR_MAX                      256u
+
+#define  DNSc_BENCH_HDR_LEN                               12u
+#define  DNSc_BENCH_ANSWER_HDR_LEN                        12u   /* Name ptr, type, class, TTL & data len.               */
+
+#define  DNSc_BENCH_TYPE_A                                 1u
+#define  DNSc_BENCH_TYPE_AAAA                             28u
+#define  DNSc_BENCH_CLASS_IN                               1u
+
+#define  DNSc_BENCH_FLAGS_RESP                        0x8180u   /* QR, RD & RA set.                                     */
+#define  DNSc_BENCH_RCODE_NAME_ERR                         3u
+
+#define  DNSc_BENCH_NAME_PTR_QUESTION                 0xC00Cu   /* Compressed ptr to the question's name.               */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_bench_rec_parsed {
+    CPU_CHAR                  Name[DNSc_BENCH_NAME_LEN_MAX + 1u];
+    CPU_INT16U                Type;
+    CPU_INT08U                Addr[NET_IPv6_ADDR_SIZE];
+} DNSc_BENCH_REC_PARSED;
+
+
+typedef  struct  dnsc_bench_pending {                           /* Resp waiting for its emulated latency.               */
+    CPU_BOOLEAN               Used;
+    NET_TS_MS                 Due_ms;
+    struct  sockaddr_storage  Addr;
+    socklen_t                 AddrLen;
+    CPU_INT16U                Len;
+    CPU_INT08U                Msg[DNSc_BENCH_MSG_LEN_MAX];
+} DNSc_BENCH_PENDING;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  DNSc_BENCH_RESPONDER_CFG    DNScBench_Cfg;
+static  DNSc_BENCH_RESPONDER_STATS  DNScBench_Stats;
+static  DNSc_BENCH_REC_PARSED       DNScBench_RecTbl[DNSc_BENCH_REC_NBR_MAX];
+static  CPU_INT16U                  DNScBench_RecNbr;
+static  DNSc_BENCH_PENDING          DNScBench_PendingTbl[DNSc_BENCH_PENDING_NBR_MAX];
+static  unsigned  int               DNScBench_RandSeed;
+static  int                         DNScBench_Sock;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void         *DNScBench_ResponderTask (void                      *p_arg);
+
+static  void          DNScBench_QueryProcess  (CPU_INT08U                *p_msg,
+                                               CPU_INT16U                 len,
+                                               struct  sockaddr_storage  *p_addr,
+                                               socklen_t                  addr_len);
+
+static  CPU_INT16U    DNScBench_RespBuild     (CPU_INT08U                *p_msg,
+                                               CPU_INT16U                 len);
+
+static  CPU_INT16U    DNScBench_AnswerAdd     (CPU_INT08U                *p_msg,
+                                               CPU_INT16U                 len,
+                                               CPU_INT16U                 type,
+                                               const  CPU_INT08U         *p_addr);
+
+static  CPU_INT32U    DNScBench_NameHash      (const  CPU_CHAR           *p_name);
+
+static  void          DNScBench_PendingFlush  (NET_TS_MS                  ts_cur_ms);
+
+static  int           DNScBench_PendingTimeoutGet(NET_TS_MS               ts_cur_ms);
+
+static  void          DNScBench_StatsInc      (CPU_INT32U                *p_ctr);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     DNScBench_ResponderStart()
+*
+* Description : Initialize the responder, open its socket & start its thread.
+*
+* Argument(s) : p_cfg       Pointer to the responder's configuration; the record table must remain valid
+*                           while the responder runs.
+*
+* Return(s)   : DEF_OK,   if the responder is running.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Benchmark driver.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  DNScBench_ResponderStart (const  DNSc_BENCH_RESPONDER_CFG  *p_cfg)
+{
+    struct  sockaddr_in  addr;
+    pthread_t            thread;
+
+
+    if (DNScBench_ResponderInit(p_cfg) != DEF_OK) {
+        return (DEF_FAIL);
+    }
+
+    DNScBench_Sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (DNScBench_Sock < 0) {
+        return (DEF_FAIL);
+    }
+
+    Mem_Clr(&addr, sizeof(addr));
+    addr.sin_family      = AF_INET;
+    addr.sin_port        = NET_UTIL_HOST_TO_NET_16(p_cfg->Port);
+    addr.sin_addr.s_addr = NET_UTIL_HOST_TO_NET_32(0x7F000001u);
+    if (bind(DNScBench_Sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+        (void)close(DNScBench_Sock);
+        return (DEF_FAIL);
+    }
+
+    if (pthread_create(&thread, DEF_NULL, DNScBench_ResponderTask, DEF_NULL) != 0) {
+        (void)close(DNScBench_Sock);
+        return (DEF_FAIL);
+    }
+    (void)pthread_detach(thread);
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScBench_ResponderInit()
+*
+* Description : Parse the record table & reset the responder's generator & statistics, w/o opening a socket.
+*
+* Argument(s) : p_cfg       Pointer to the responder's configuration; the record table must remain valid
+*                           while the responder is used.
+*
+* Return(s)   : DEF_OK,   if the configuration is valid.
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : DNScBench_ResponderStart(),
+*               Simulator.
+*
+* Note(s)     : (1) A driver that exchanges the messages itself calls DNScBench_ResponderInit() &
+*                   DNScBench_ResponderProcess() instead of DNScBench_ResponderStart(). Initializing again
+*                   w/ the same seed replays the same losses & delays.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  DNScBench_ResponderInit (const  DNSc_BENCH_RESPONDER_CFG  *p_cfg)
+{
+    DNSc_BENCH_REC_PARSED  *p_rec;
+    CPU_INT16U              ix;
+    CPU_SIZE_T              name_len;
+    CPU_SIZE_T              i;
+
+
+    DNScBench_Cfg      = *p_cfg;
+    DNScBench_RandSeed =  p_cfg->Seed;
+    DNScBench_RecNbr   =  0u;
+    Mem_Clr(&DNScBench_Stats,      sizeof(DNScBench_Stats));
+    Mem_Clr(&DNScBench_PendingTbl, sizeof(DNScBench_PendingTbl));
+
+    for (ix = 0u; ix < p_cfg->RecNbr; ix++) {
+        if (DNScBench_RecNbr >= DNSc_BENCH_REC_NBR_MAX) {
+            return (DEF_FAIL);
+        }
+        p_rec    = &DNScBench_RecTbl[DNScBench_RecNbr];
+        name_len =  Str_Len_N(p_cfg->RecTblPtr[ix].NamePtr, DNSc_BENCH_NAME_LEN_MAX + 1u);
+        if (name_len > DNSc_BENCH_NAME_LEN_MAX) {
+            return (DEF_FAIL);
+        }
+        for (i = 0u; i < name_len; i++) {
+            p_rec->Name[i] = ASCII_ToLower(p_cfg->RecTblPtr[ix].NamePtr[i]);
+        }
+        p_rec->Name[name_len] = ASCII_CHAR_NULL;
+
+        if (inet_pton(AF_INET, p_cfg->RecTblPtr[ix].AddrPtr, p_rec->Addr) == 1) {
+            p_rec->Type = DNSc_BENCH_TYPE_A;
+        } else if (inet_pton(AF_INET6, p_cfg->RecTblPtr[ix].AddrPtr, p_rec->Addr) == 1) {
+            p_rec->Type = DNSc_BENCH_TYPE_AAAA;
+        } else {
+            return (DEF_FAIL);
+        }
+        DNScBench_RecNbr++;
+    }
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DNScBench_ResponderProcess()
+*
+* Description : Answer or drop a query & draw the delay of its response.
+*
+* Argument(s) : p_msg       Pointer to the query, in a DNSc_BENCH_MSG_LEN_MAX octets buffer; the response is
+*                           built in place.
+*
+*               len         Length of the query.
+*
+*               p_dly_ms    Pointer to the variable that will receive the delay of the response, in milliseconds.
+*
+* Return(s)   : Length of the response, 0 if the query is dropped or malformed.
+*
+* Caller(s)   : DNScBench_QueryProcess(),
+*               Simulator.
+*
+* Note(s)     : (1) See 'dns-c_bench_responder.h  Note #2'.
+*********************************************************************************************************
+*/
+
+CPU_INT16U  DNScBench_ResponderProcess (CPU_INT08U  *p_msg,
+                                        CPU_INT16U   len,
+                                        CPU_INT32U  *p_dly_ms)
+{
+    CPU_INT32U  dly_ms;
+
+
+    DNScBench_StatsInc(&DNScBench_Stats.Rx);
+
+    if ((DNScBench_Cfg.LossPct > 0u) &&
+        ((CPU_INT32U)(rand_r(&DNScBench_RandSeed) % 100) < DNScBench_Cfg.LossPct)) {
+        DNScBench_StatsInc(&DNScBench_Stats.Dropped);
+        return (0u);
+    }
+
+    len = DNScBench_RespBuild(p_msg, len);
+    if (len == 0u) {
+        DNScBench_StatsInc(&DNScBench_Stats.Malformed);
+        return (0u);
+    }
+
+    dly_ms = DNScBench_Cfg.Latency_ms;
+    if (DNScBench_Cfg.Jitter_ms > 0u) {
+        dly_ms += (CPU_INT32U)rand_r(&DNScBench_RandSeed) % (DNScBench_Cfg.Jitter_ms + 1u);
+    }
+
+   *p_dly_ms = dly_ms;
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DNScBench_ResponderStatsGet()
+*
+* Description : Get a copy of the responder's statistics.
+*
+* Argument(s) : p_stats     Pointer to the variable that will receive the statistics.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Benchmark driver.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  DNScBench_ResponderStatsGet (DNSc_BENCH_RESPONDER_STATS  *p_stats)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+   *p_stats = DNScBench_Stats;
+    CPU_CRITICAL_EXIT();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                      DNScBench_ResponderTask()
+*
+* Description : Responder's thread: receive the queries & transmit the delayed responses.
+*
+* Argument(s) : p_arg       Unused.
+*
+* Return(s)   : Never returns.
+*
+* Caller(s)   : Referenced by DNScBench_ResponderStart().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  *DNScBench_ResponderTask (void  *p_arg)
+{
+    struct  pollfd            poll_fd;
+    struct  sockaddr_storage  addr;
+    socklen_t                 addr_len;
+    CPU_INT08U                msg[DNSc_BENCH_MSG_LEN_MAX];
+    ssize_t                   len;
+
+
+    (void)p_arg;
+
+    poll_fd.fd     = DNScBench_Sock;
+    poll_fd.events = POLLIN;
+
+    while (DEF_ON) {
+        (void)poll(&poll_fd, 1u, DNScBench_PendingTimeoutGet(NetUtil_TS_Get_ms()));
+
+        do {
+            addr_len = sizeof(addr);
+            len      = recvfrom(DNScBench_Sock, msg, sizeof(msg), MSG_DONTWAIT, (struct sockaddr *)&addr, &addr_len);
+            if (len > 0) {
+                DNScBench_QueryProcess(msg, (CPU_INT16U)len, &addr, addr_len);
+            }
+        } while (len > 0);
+
+        DNScBench_PendingFlush(NetUtil_TS_Get_ms());
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScBench_QueryProcess()
+*
+* Description : Answer, delay or drop a query.
+*
+* Argument(s) : p_msg       Pointer to the query; the response is built in place.
+*
+*               len         Length of the query.
+*
+*               p_addr      Pointer to the client's address.
+*
+*               addr_len    Length of the client's address.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScBench_ResponderTask().
+*
+* Note(s)     : (1) When every pending slot is taken, the response is transmitted w/o delay.
+*********************************************************************************************************
+*/
+
+static  void  DNScBench_QueryProcess (CPU_INT08U                *p_msg,
+                                      CPU_INT16U                 len,
+                                      struct  sockaddr_storage  *p_addr,
+                                      socklen_t                  addr_len)
+{
+    DNSc_BENCH_PENDING  *p_pending;
+    CPU_INT32U           dly_ms;
+    CPU_INT16U           ix;
+
+
+    len = DNScBench_ResponderProcess(p_msg, len, &dly_ms);
+    if (len == 0u) {
+        return;
+    }
+
+    if (dly_ms > 0u) {
+        for (ix = 0u; ix < DNSc_BENCH_PENDING_NBR_MAX; ix++) {
+            p_pending = &DNScBench_PendingTbl[ix];
+            if (p_pending->Used == DEF_NO) {
+                p_pending->Used    = DEF_YES;
+                p_pending->Due_ms  = NetUtil_TS_Get_ms() + dly_ms;
+                p_pending->Addr    = *p_addr;
+                p_pending->AddrLen =  addr_len;
+                p_pending->Len     =  len;
+                Mem_Copy(p_pending->Msg, p_msg, len);
+                return;
+            }
+        }
+    }
+
+                                                                /* See Note #1.                                         */
+    (void)sendto(DNScBench_Sock, p_msg, len, 0, (struct sockaddr *)p_addr, addr_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScBench_RespBuild()
+*
+* Description : Turn a query into its response, in place.
+*
+* Argument(s) : p_msg       Pointer to the query, in a DNSc_BENCH_MSG_LEN_MAX octets buffer.
+*
+*               len         Length of the query.
+*
+* Return(s)   : Length of the response, 0 if the query is malformed.
+*
+* Caller(s)   : DNScBench_ResponderProcess().
+*
+* Note(s)     : (1) See 'dns-c_bench_responder.h  Note #1'. The additional records (e.g. EDNS) of the query
+*                   are discarded.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DNScBench_RespBuild (CPU_INT08U  *p_msg,
+                                         CPU_INT16U   len)
+{
+    CPU_CHAR     name[DNSc_BENCH_NAME_LEN_MAX + 1u];
+    CPU_INT08U   addr[NET_IPv6_ADDR_SIZE];
+    CPU_INT16U   name_len;
+    CPU_INT16U   ix;
+    CPU_INT16U   type;
+    CPU_INT16U   answer_nbr;
+    CPU_INT16U   resp_len;
+    CPU_INT16U   flags;
+    CPU_INT32U   hash;
+    CPU_SIZE_T   suffix_len;
+    CPU_BOOLEAN  found;
+    CPU_INT08U   label_len;
+
+
+    if (len < DNSc_BENCH_HDR_LEN + 5u) {
+        return (0u);
+    }
+    if ((p_msg[4] != 0u) || (p_msg[5] != 1u)) {                 /* Exactly one question.                                */
+        return (0u);
+    }
+
+                                                                /* ------------------ PARSE QUESTION ------------------ */
+    ix       = DNSc_BENCH_HDR_LEN;
+    name_len = 0u;
+    while (p_msg[ix] != 0u) {
+        label_len = p_msg[ix];
+        if ((label_len                   >  63u) ||
+            (ix + 1u + label_len + 4u    >= len) ||
+            (name_len + label_len + 1u   >  DNSc_BENCH_NAME_LEN_MAX)) {
+            return (0u);
+        }
+        if (name_len > 0u) {
+            name[name_len++] = ASCII_CHAR_FULL_STOP;
+        }
+        for (ix++; label_len > 0u; label_len--) {
+            name[name_len++] = ASCII_ToLower((CPU_CHAR)p_msg[ix++]);
+        }
+    }
+    name[name_len] = ASCII_CHAR_NULL;
+    ix++;
+    if (ix + 4u > len) {
+        return (0u);
+    }
+    type     = (CPU_INT16U)((p_msg[ix] << 8u) | p_msg[ix + 1u]);
+    resp_len = ix + 4u;                                         /* Resp keeps hdr & question (see Note #1).             */
+
+                                                                /* ------------------- ADD ANSWERS -------------------- */
+    answer_nbr = 0u;
+    found      = DEF_NO;
+    for (ix = 0u; ix < DNScBench_RecNbr; ix++) {
+        if (Str_Cmp(DNScBench_RecTbl[ix].Name, name) == 0) {
+            found = DEF_YES;
+            if (DNScBench_RecTbl[ix].Type == type) {
+                resp_len = DNScBench_AnswerAdd(p_msg, resp_len, type, DNScBench_RecTbl[ix].Addr);
+                answer_nbr++;
+            }
+        }
+    }
+
+    if ((found                        == DEF_NO)   &&
+        (DNScBench_Cfg.SynthSuffixPtr != DEF_NULL)) {
+        suffix_len = Str_Len(DNScBench_Cfg.SynthSuffixPtr);
+        if ((name_len >= suffix_len) &&
+            (Str_CmpIgnoreCase_N(&name[name_len - suffix_len], DNScBench_Cfg.SynthSuffixPtr, suffix_len) == 0)) {
+            found = DEF_YES;
+            hash  = DNScBench_NameHash(name);
+            Mem_Clr(addr, sizeof(addr));
+            switch (type) {
+                case DNSc_BENCH_TYPE_A:
+                     addr[0] = 10u;
+                     addr[1] = (CPU_INT08U)(hash >> 16u);
+                     addr[2] = (CPU_INT08U)(hash >>  8u);
+                     addr[3] = (CPU_INT08U)(hash | 1u);         /* Never a network or broadcast addr.                   */
+                     break;
+
+                case DNSc_BENCH_TYPE_AAAA:
+                     addr[ 0] = 0xFDu;
+                     addr[12] = (CPU_INT08U)(hash >> 24u);
+                     addr[13] = (CPU_INT08U)(hash >> 16u);
+                     addr[14] = (CPU_INT08U)(hash >>  8u);
+                     addr[15] = (CPU_INT08U)(hash | 1u);
+                     break;
+
+                default:
+                     break;
+            }
+            if ((type == DNSc_BENCH_TYPE_A) ||
+                (type == DNSc_BENCH_TYPE_AAAA)) {
+                resp_len = DNScBench_AnswerAdd(p_msg, resp_len, type, addr);
+                answer_nbr++;
+            }
+        }
+    }
+
+    if ((type != DNSc_BENCH_TYPE_A) &&
+        (type != DNSc_BENCH_TYPE_AAAA)) {
+        found = DEF_NO;
+    }
+
+                                                                /* -------------------- SET HEADER -------------------- */
+    flags = DNSc_BENCH_FLAGS_RESP;
+    if (found == DEF_NO) {
+        flags |= DNSc_BENCH_RCODE_NAME_ERR;
+        DNScBench_StatsInc(&DNScBench_Stats.NameErr);
+    } else if (answer_nbr == 0u) {
+        DNScBench_StatsInc(&DNScBench_Stats.Empty);
+    } else {
+        DNScBench_StatsInc(&DNScBench_Stats.Answered);
+    }
+
+    p_msg[ 2] = (CPU_INT08U)(flags      >> 8u);
+    p_msg[ 3] = (CPU_INT08U)(flags          );
+    p_msg[ 6] = (CPU_INT08U)(answer_nbr >> 8u);
+    p_msg[ 7] = (CPU_INT08U)(answer_nbr     );
+    p_msg[ 8] = 0u;                                             /* No authority nor additional rec.                     */
+    p_msg[ 9] = 0u;
+    p_msg[10] = 0u;
+    p_msg[11] = 0u;
+
+    return (resp_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScBench_AnswerAdd()
+*
+* Description : Append an A or AAAA answer to a response.
+*
+* Argument(s) : p_msg       Pointer to the response.
+*
+*               len         Current length of the response.
+*
+*               type        Answer type, DNSc_BENCH_TYPE_A or DNSc_BENCH_TYPE_AAAA.
+*
+*               p_addr      Pointer to the address, in network order.
+*
+* Return(s)   : New length of the response, unchanged if the answer does not fit.
+*
+* Caller(s)   : DNScBench_RespBuild().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DNScBench_AnswerAdd (       CPU_INT08U  *p_msg,
+                                                CPU_INT16U   len,
+                                                CPU_INT16U   type,
+                                         const  CPU_INT08U  *p_addr)
+{
+    CPU_INT08U  *p_data;
+    CPU_INT16U   addr_len;
+
+
+    addr_len = (type == DNSc_BENCH_TYPE_A) ? NET_IPv4_ADDR_SIZE : NET_IPv6_ADDR_SIZE;
+    if (len + DNSc_BENCH_ANSWER_HDR_LEN + addr_len > DNSc_BENCH_MSG_LEN_MAX) {
+        return (len);
+    }
+
+    p_data     = &p_msg[len];
+    p_data[ 0] = (CPU_INT08U)(DNSc_BENCH_NAME_PTR_QUESTION >> 8u);
+    p_data[ 1] = (CPU_INT08U)(DNSc_BENCH_NAME_PTR_QUESTION     );
+    p_data[ 2] = (CPU_INT08U)(type                         >> 8u);
+    p_data[ 3] = (CPU_INT08U)(type                             );
+    p_data[ 4] = 0u;
+    p_data[ 5] = DNSc_BENCH_CLASS_IN;
+    p_data[ 6] = (CPU_INT08U)(DNScBench_Cfg.TTL_s          >> 24u);
+    p_data[ 7] = (CPU_INT08U)(DNScBench_Cfg.TTL_s          >> 16u);
+    p_data[ 8] = (CPU_INT08U)(DNScBench_Cfg.TTL_s          >>  8u);
+    p_data[ 9] = (CPU_INT08U)(DNScBench_Cfg.TTL_s              );
+    p_data[10] = 0u;
+    p_data[11] = (CPU_INT08U)addr_len;
+    Mem_Copy(&p_data[DNSc_BENCH_ANSWER_HDR_LEN], p_addr, addr_len);
+
+    return (len + DNSc_BENCH_ANSWER_HDR_LEN + addr_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScBench_NameHash()
+*
+* Description : Hash a host name (FNV-1a, 32 bits).
+*
+* Argument(s) : p_name      Pointer to the lower case host name.
+*
+* Return(s)   : Hash of the name.
+*
+* Caller(s)   : DNScBench_RespBuild().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DNScBench_NameHash (const  CPU_CHAR  *p_name)
+{
+    CPU_INT32U  hash = 2166136261u;
+
+
+    while (*p_name != ASCII_CHAR_NULL) {
+        hash ^= (CPU_INT08U)*p_name;
+        hash *= 16777619u;
+        p_name++;
+    }
+
+    return (hash);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScBench_PendingFlush()
+*
+* Description : Transmit every delayed response that is due.
+*
+* Argument(s) : ts_cur_ms   Current timestamp, in milliseconds.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScBench_ResponderTask().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScBench_PendingFlush (NET_TS_MS  ts_cur_ms)
+{
+    DNSc_BENCH_PENDING  *p_pending;
+    CPU_INT16U           ix;
+
+
+    for (ix = 0u; ix < DNSc_BENCH_PENDING_NBR_MAX; ix++) {
+        p_pending = &DNScBench_PendingTbl[ix];
+        if ((p_pending->Used                                 == DEF_YES) &&
+            ((CPU_INT32S)(ts_cur_ms - p_pending->Due_ms)     >= 0)) {
+            (void)sendto(DNScBench_Sock,
+                         p_pending->Msg,
+                         p_pending->Len,
+                         0,
+                         (struct sockaddr *)&p_pending->Addr,
+                         p_pending->AddrLen);
+            p_pending->Used = DEF_NO;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                    DNScBench_PendingTimeoutGet()
+*
+* Description : Get the time until the next delayed response is due.
+*
+* Argument(s) : ts_cur_ms   Current timestamp, in milliseconds.
+*
+* Return(s)   : Timeout for poll(), in milliseconds; -1 if no response is delayed.
+*
+* Caller(s)   : DNScBench_ResponderTask().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  int  DNScBench_PendingTimeoutGet (NET_TS_MS  ts_cur_ms)
+{
+    CPU_INT32S  dly_ms;
+    int         timeout_ms = -1;
+    CPU_INT16U  ix;
+
+
+    for (ix = 0u; ix < DNSc_BENCH_PENDING_NBR_MAX; ix++) {
+        if (DNScBench_PendingTbl[ix].Used == DEF_YES) {
+            dly_ms = (CPU_INT32S)(DNScBench_PendingTbl[ix].Due_ms - ts_cur_ms);
+            if (dly_ms < 0) {
+                dly_ms = 0;
+            }
+            if ((timeout_ms < 0) ||
+                (dly_ms     < timeout_ms)) {
+                timeout_ms = (int)dly_ms;
+            }
+        }
+    }
+
+    return (timeout_ms);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScBench_StatsInc()
+*
+* Description : Increment a responder statistic.
+*
+* Argument(s) : p_ctr       Pointer to the counter.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScBench_QueryProcess(),
+*               DNScBench_RespBuild().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScBench_StatsInc (CPU_INT32U  *p_ctr)
+{
+    CPU_SR_ALLOC();
+
+
+    CPU_CRITICAL_ENTER();
+  (*p_ctr)++;
+    CPU_CRITICAL_EXIT();
+}
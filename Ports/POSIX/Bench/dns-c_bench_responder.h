@@ -0,0 +1,134 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                     BENCHMARK STUB DNS RESPONDER
+*
+* Filename : dns-c_bench_responder.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) The responder is a minimal authoritative DNS server listening on the loopback address. It
+*                answers A & AAAA queries from a record table & from names synthesized on the fly, & can
+*                delay & drop queries to emulate a remote server:
+*
+*                (a) A name found in the record table is answered w/ every address of the requested family
+*                    it holds, possibly none.
+*
+*                (b) A name ending w/ the synthesis suffix is answered w/ one address derived from a hash
+*                    of the name (10.x.y.z or fd00::/8), so that any number of distinct names resolve.
+*
+*                (c) Any other name, & any other query type, is answered w/ a name error (NXDOMAIN).
+*
+*            (2) Each query is dropped w/ a probability of 'LossPct' percent; the others are answered after
+*                'Latency_ms' plus a random jitter of up to 'Jitter_ms' milliseconds.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  DNSc_BENCH_RESPONDER_PRESENT
+#define  DNSc_BENCH_RESPONDER_PRESENT
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_BENCH_MSG_LEN_MAX                          512u   /* Max len of a query or a resp.                        */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_bench_rec {                               /* One addr of a name; a name may have several rec.     */
+    const  CPU_CHAR        *NamePtr;
+    const  CPU_CHAR        *AddrPtr;
+} DNSc_BENCH_REC;
+
+
+typedef  struct  dnsc_bench_responder_cfg {
+           NET_PORT_NBR     Port;                               /* UDP port on the loopback addr.                       */
+           CPU_INT32U       Latency_ms;                         /* See 'dns-c_bench_responder.h  Note #2'.              */
+           CPU_INT32U       Jitter_ms;
+           CPU_INT08U       LossPct;
+           CPU_INT32U       TTL_s;                              /* TTL of every answer.                                 */
+    const  DNSc_BENCH_REC  *RecTblPtr;                          /* See 'dns-c_bench_responder.h  Note #1a'.             */
+           CPU_INT16U       RecNbr;
+    const  CPU_CHAR        *SynthSuffixPtr;                     /* See 'dns-c_bench_responder.h  Note #1b'.             */
+           CPU_INT32U       Seed;                               /* Seed of the loss & jitter generator.                 */
+} DNSc_BENCH_RESPONDER_CFG;
+
+
+typedef  struct  dnsc_bench_responder_stats {
+    CPU_INT32U              Rx;                                 /* Nbr of queries rx'd.                                 */
+    CPU_INT32U              Dropped;                            /* Nbr of queries dropped (see Note #2).                */
+    CPU_INT32U              Answered;                           /* Nbr of resp w/ at least one answer.                  */
+    CPU_INT32U              Empty;                              /* Nbr of resp w/o answer.                              */
+    CPU_INT32U              NameErr;                            /* Nbr of name error resp.                              */
+    CPU_INT32U              Malformed;                          /* Nbr of queries that could not be parsed.             */
+} DNSc_BENCH_RESPONDER_STATS;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  DNScBench_ResponderStart   (const  DNSc_BENCH_RESPONDER_CFG    *p_cfg);
+
+CPU_BOOLEAN  DNScBench_ResponderInit    (const  DNSc_BENCH_RESPONDER_CFG    *p_cfg);
+
+CPU_INT16U   DNScBench_ResponderProcess (       CPU_INT08U                  *p_msg,
+                                                CPU_INT16U                   len,
+                                                CPU_INT32U                  *p_dly_ms);
+
+void         DNScBench_ResponderStatsGet(       DNSc_BENCH_RESPONDER_STATS  *p_stats);
+
+#endif  /* DNSc_BENCH_RESPONDER_PRESENT */
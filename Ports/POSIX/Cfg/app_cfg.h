@@ -0,0 +1,44 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                   APPLICATION CONFIGURATION FILE
+*
+*                                          POSIX HOST PORT
+*
+* Filename : app_cfg.h
+* Version  : V2.02.00
+*********************************************************************************************************
+*/
+
+#ifndef  APP_CFG_MODULE_PRESENT
+#define  APP_CFG_MODULE_PRESENT
+
+
+/*
+*********************************************************************************************************
+*                                       DNSc TASK CONFIGURATION
+*
+* Note(s) : (1) Both values are ignored by the POSIX KAL (see 'KAL/kal.h  Note #2').
+*********************************************************************************************************
+*/
+
+#define  DNSc_OS_CFG_INSTANCE_TASK_PRIO                   30u
+#define  DNSc_OS_CFG_INSTANCE_TASK_STK_SIZE             4096u
+
+#endif  /* APP_CFG_MODULE_PRESENT */
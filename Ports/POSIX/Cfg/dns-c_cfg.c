@@ -0,0 +1,154 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                    DNS CLIENT CONFIGURATION FILE
+*
+*                                          POSIX HOST PORT
+*
+* Filename : dns-c_cfg.c
+* Version  : V2.02.00
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                             INCLUDE FILES
+*
+* Note(s) : (1) The task priority & stack size are defined in the port's 'app_cfg.h'; both are ignored by the
+*               POSIX KAL (see 'KAL/kal.h  Note #2').
+*
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  <app_cfg.h>                                           /* See Note #1.                                         */
+#include  <lib_def.h>
+#include  <Source/dns-c.h>
+#include  <dns-c_cfg.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                 DNS CLIENT CONFIGURATION STRUCTURE
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+const  DNSc_CFG  DNSc_Cfg = {
+                                /* Configure segment where allocate the memory for          */
+                                /* DNS objects:                                             */
+    DEF_NULL,
+                                /* [DEF_NULL] to allocate from uC/LIB Memory HEAP.          */
+                                /* [Pointer] to the memory segment.                         */
+
+
+                                /* Configure default DNS server to use.                     */
+#if    defined(NET_IPv4_MODULE_EN)
+    "127.0.0.1",
+#elif  defined(NET_IPv6_MODULE_EN)
+    "::1",
+#endif
+                                /* [Pointer] to a string that contains the IP address.      */
+                                /* Loopback, where the benchmark's responder listens.       */
+
+
+                                /* Configure the maximum host name length                   */
+    DNSc_DFLT_HOST_NAME_LEN,
+                                /* [MUST be >= 2]                                           */
+
+
+                                /* Configure number of entry the cache can contains:        */
+    255,                        /* [MUST be >= 1]                                           */
+
+
+                                /* Configure how many IP addresses can be stored by host:   */
+    2,                          /* Number of IPv4 Addresses.                                */
+    2,                          /* Number of IPv6 Addresses.                                */
+                                /* [MUST be >= 1]                                           */
+
+
+
+                                /* Configure task delay in integer milliseconds :           */
+    1,
+                                /* Default value: [DNSc_DFLT_TASK_DLY_MS] = 50ms            */
+                                /* [MUST be >= 1]                                           */
+
+
+                                /* Configure maximum of request resolution retry :          */
+    DNSc_DFLT_REQ_RETRY_NBR_MAX,
+                                /* Default value: [DNSc_DFLT_REQ_RETRY_NBR_MAX] = 2         */
+                                /* [MUST be >= 1]                                           */
+
+                                /* Configure timeout before a request resolution retry :    */
+    200,
+                                /* Default value: [DNSc_DFLT_REQ_RETRY_TIMEOUT_MS] = 1000ms */
+                                /* [MUST be >= 100]                                         */
+
+
+                                /* Configure static hosts table (answered w/o request):     */
+    DEF_NULL,                   /* [Pointer] to an array of host name/address pairs.        */
+    0,                          /* Number of entries in the array.                          */
+    DEF_NULL,                   /* [Pointer] to a string in /etc/hosts format.              */
+                                /* [DEF_NULL] if no static host is needed.                  */
+
+
+                                /* Configure clock used for timeouts, TTLs & delays:        */
+    DEF_NULL,                   /* [Pointer] to the clock functions.                        */
+                                /* [DEF_NULL] to use NetUtil_TS_Get_ms() & KAL_Dly().       */
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                               DNS CLIENT TASK CONFIGURATION STRUCTURE
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_MODE_ASYNC_EN == DEF_ENABLED)
+#ifndef  DNSc_OS_CFG_INSTANCE_TASK_PRIO
+#define  DNSc_OS_CFG_INSTANCE_TASK_PRIO                  30
+#endif
+
+#ifndef  DNSc_OS_CFG_INSTANCE_TASK_STK_SIZE
+#define  DNSc_OS_CFG_INSTANCE_TASK_STK_SIZE             512
+#endif
+
+#ifndef  DNSc_OS_CFG_INSTANCE_TASK_WORKER_NBR                   /* Nbr of resolver tasks, each w/ the prio & stk size.  */
+#define  DNSc_OS_CFG_INSTANCE_TASK_WORKER_NBR             1
+#endif
+
+const  DNSc_CFG_TASK  DNSc_CfgTask = {
+                                         DNSc_OS_CFG_INSTANCE_TASK_PRIO,
+                                         DNSc_OS_CFG_INSTANCE_TASK_STK_SIZE,
+                                         DEF_NULL,
+                                         DNSc_OS_CFG_INSTANCE_TASK_WORKER_NBR
+                                     };
+#endif
@@ -0,0 +1,173 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                    DNS CLIENT CONFIGURATION FILE
+*
+*                                          POSIX HOST PORT
+*
+* Filename : dns-c_cfg.h
+* Version  : V2.02.00
+*********************************************************************************************************
+*/
+
+#ifndef DNSc_CFG_MODULE_PRESENT
+#define DNSc_CFG_MODULE_PRESENT
+
+#include  <Source/dns-c_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                  DNSc ARGUMENT CHECK CONFIGURATION
+*
+* Note(s) : (1) Configure DNSc_CFG_ARG_CHK_EXT_EN to enable/disable the DNS client external argument
+*               check feature :
+*
+*               (a) When ENABLED,  ALL arguments received from any port interface provided by the developer
+*                   are checked/validated.
+*
+*               (b) When DISABLED, NO  arguments received from any port interface provided by the developer
+*                   are checked/validated.
+*********************************************************************************************************
+*/
+                                                                /* Configure external argument check feature ...        */
+                                                                /* See Note 1.                                          */
+#define  DNSc_CFG_ARG_CHK_EXT_EN                    DEF_DISABLED
+                                                                /* DEF_DISABLED     External argument check DISABLED    */
+                                                                /* DEF_ENABLED      External argument check ENABLED     */
+
+/*
+*********************************************************************************************************
+*                                     DNSc FEATURES CONFIGURATION
+*
+* Note(s) : (1) Configure DNSc_CFG_MODE_ASYNC_EN to enable/disable the DNS client asynchronous communication mode:
+*
+*               (a) When ENABLED,  A dedicated task will handle all host resolution request. It will be possible to
+*                   call DNS API to get remote host address without blocking.
+*
+*               (b) When DISABLED, The API to get remote host will always block until the resolution is completed.
+*
+*           (2) Configure DNSc_CFG_MODE_BLOCK_EN to enable/disable the blocking option when the asynchronous
+*               communication is enabled.
+*
+*               (a) When ENABLED,  It will be possible to block when calling the DNS API to get remote host until the
+*                   resolution is completed (via a flag option).
+*
+*               (b) When DISABLED, The API to get remote host will always be non-blocking, must poll DNS client to
+*                   know when the resolution is completed.
+*
+*           (3) Configure DNSc_CFG_CACHE_SLAB_EN to select the memory layout of the cache:
+*
+*               (a) When ENABLED,  a single contiguous region is allocated at initialization & divided in one
+*                   fixed slot per cache entry. Each slot holds the host object, its addresses, its names, its
+*                   request configuration & its cache list element.
+*
+*               (b) When DISABLED, each element of a cache entry is allocated from its own dynamic pool.
+*
+*           (4) Configure DNSc_CFG_CACHE_FRONT_NBR_ENTRIES with the number of entries of the front cache. The
+*               front cache keeps a copy of the last forward answers returned by the cache so that repeated
+*               lookups of the same name bypass the cache lock. Set to 0 to disable the front cache.
+*
+*           (5) Configure DNSc_CFG_STATS_SERVER_NBR_MAX with the number of DNS servers for which the resolver
+*               statistics are kept (see DNSc_ResolverStatsGet()). Each server takes a slot the first time a
+*               request is sent to it; servers contacted once all slots are taken are only accounted for in the
+*               global statistics.
+*
+*           (6) Configure DNSc_CFG_REQ_PRIO_LOW_NBR_MAX with the maximum number of low-priority requests
+*               (DNSc_REQ_PRIO_LOW) that DNSc's task has on the wire at once. Further low-priority requests
+*               wait in the task's queue until one completes. Set to 0 for no limit.
+*
+*           (7) Configure DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX with the maximum number of requests, of any priority,
+*               that DNSc's task has in progress at once; each one holds a socket. Further requests wait in the
+*               task's queue, w/o a socket, until one completes. Set to 0 for no limit.
+*
+*           (8) Configure DNSc_CFG_REQ_SERVER_QPS_MAX with the maximum number of queries per second sent to a
+*               server, retransmissions included. Queries over the rate are delayed, not failed; up to one
+*               second of queries may be sent in a burst. The servers w/o statistics slot (see Note #5) share
+*               a single rate. Set to 0 for no limit.
+*
+*           (9) Configure DNSc_CFG_ADDR_SORT_EN to enable/disable the ordering of the addresses returned by
+*               DNSc_GetHost() w/ the DNSc_FLAG_ADDR_SORT flag (see 'dns-c.c  DNSc_GetHost()  Note #7').
+*
+*               (a) When ENABLED,  the addresses are ordered by the destination address selection rules of
+*                   RFC #6724 against the local interface addresses, & the IPv4 & IPv6 addresses alternate.
+*
+*               (b) When DISABLED, the addresses are returned in the order they were received.
+*********************************************************************************************************
+*/
+
+                                                                /* Configure asynchronous mode feature, See Note #1 ... */
+#ifndef  DNSc_CFG_MODE_ASYNC_EN                                 /* May be overridden on the command line (see readme).  */
+#define  DNSc_CFG_MODE_ASYNC_EN                     DEF_ENABLED
+#endif
+                                                                /* DEF_DISABLED     Asynchronous mode DISABLED          */
+                                                                /* DEF_ENABLED      Asynchronous mode ENABLED           */
+
+
+                                                                /* Configure blocking option feature, See Note #2 ... */
+#ifndef  DNSc_CFG_MODE_BLOCK_EN                                 /* May be overridden on the command line (see readme).  */
+#define  DNSc_CFG_MODE_BLOCK_EN                     DEF_ENABLED
+#endif
+                                                                /* DEF_DISABLED     Blocking option DISABLED            */
+                                                                /* DEF_ENABLED      Blocking option ENABLED             */
+
+
+                                                                /* Configure cache memory layout, See Note #3 ...       */
+#define  DNSc_CFG_CACHE_SLAB_EN                     DEF_DISABLED
+                                                                /* DEF_DISABLED     One dynamic pool per cache element  */
+                                                                /* DEF_ENABLED      Single slab w/ one slot per entry   */
+
+
+                                                                /* Configure front cache size, See Note #4 ...          */
+#define  DNSc_CFG_CACHE_FRONT_NBR_ENTRIES                    4u
+
+
+                                                                /* Configure nbr of servers w/ stats, See Note #5 ...   */
+#define  DNSc_CFG_STATS_SERVER_NBR_MAX                       2u
+
+
+                                                                /* Configure low-priority reqs in flight, See Note #6...*/
+#define  DNSc_CFG_REQ_PRIO_LOW_NBR_MAX                       4u
+
+                                                                /* Configure reqs in flight, See Note #7 ...            */
+#define  DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX                      0u
+
+                                                                /* Configure queries per sec per server, See Note #8 ...*/
+#define  DNSc_CFG_REQ_SERVER_QPS_MAX                         0u
+
+                                                                /* Configure address ordering, See Note #9 ...          */
+#define  DNSc_CFG_ADDR_SORT_EN                      DEF_ENABLED
+                                                                /* DEF_DISABLED     Addresses in order received         */
+                                                                /* DEF_ENABLED      Addresses ordered by RFC #6724      */
+
+/*
+*********************************************************************************************************
+*                                DNSc RUN-TIME STRUCTURE CONFIGURATION
+*
+* Note(s) : (1) These structures should be defined into a 'C' file.
+*********************************************************************************************************
+*/
+
+extern  const  DNSc_CFG       DNSc_Cfg;                         /* Must always be defined.                              */
+
+#if (DNSc_CFG_MODE_ASYNC_EN == DEF_ENABLED)
+extern  const  DNSc_CFG_TASK  DNSc_CfgTask;                     /* Not required when Asynchronous mode is disabled.     */
+#endif
+
+#endif
@@ -0,0 +1,53 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                         NETWORK INTERFACES
+*
+* Filename : net_if.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'IF/net_if.h' when DNSc is built on a POSIX host. A single
+*                interface, number NET_IF_NBR_BASE_CFGD, is reported; its link state can be changed w/
+*                NetIF_LinkStateSet() to exercise DNSc's link down paths.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_IF_MODULE_PRESENT
+#define  NET_IF_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+NET_IF_NBR         NetIF_GetNbrBaseCfgd(void);
+
+NET_IF_NBR         NetIF_GetExtAvailCtr(NET_ERR            *p_err);
+
+NET_IF_LINK_STATE  NetIF_LinkStateGet  (NET_IF_NBR          if_nbr,
+                                        NET_ERR            *p_err);
+
+void               NetIF_LinkStateSet  (NET_IF_LINK_STATE   link_state);
+
+#endif  /* NET_IF_MODULE_PRESENT */
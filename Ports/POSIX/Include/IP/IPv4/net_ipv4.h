@@ -0,0 +1,58 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                          IPv4 DEFINITIONS
+*
+* Filename : net_ipv4.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'IP/IPv4/net_ipv4.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_IPv4_MODULE_PRESENT
+#define  NET_IPv4_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                              DEFINES
+*********************************************************************************************************
+*/
+
+#define  NET_IPv4_ADDR_NONE                       0x00000000u
+#define  NET_IPv4_ADDR_ANY                        0x00000000u
+#define  NET_IPv4_ADDR_LOCAL_HOST                 0x7F000001u
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIPv4_GetAddrHost(NET_IF_NBR         if_nbr,
+                                 NET_IPv4_ADDR     *p_addr_tbl,
+                                 NET_IP_ADDRS_QTY  *p_addr_tbl_qty,
+                                 NET_ERR           *p_err);
+
+#endif  /* NET_IPv4_MODULE_PRESENT */
@@ -0,0 +1,56 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                          IPv6 DEFINITIONS
+*
+* Filename : net_ipv6.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'IP/IPv6/net_ipv6.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_IPv6_MODULE_PRESENT
+#define  NET_IPv6_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  const  NET_IPv6_ADDR  NET_IPv6_ADDR_ANY;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIPv6_GetAddrHost(NET_IF_NBR         if_nbr,
+                                 NET_IPv6_ADDR     *p_addr_tbl,
+                                 NET_IP_ADDRS_QTY  *p_addr_tbl_qty,
+                                 NET_ERR           *p_err);
+
+#endif  /* NET_IPv6_MODULE_PRESENT */
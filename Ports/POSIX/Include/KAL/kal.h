@@ -0,0 +1,188 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                   KERNEL ABSTRACTION LAYER (KAL)
+*
+* Filename : kal.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/Common's 'KAL/kal.h' when DNSc is built on a POSIX host. Tasks are
+*                POSIX threads, locks are mutexes & semaphores are built on a mutex & a condition variable.
+*
+*            (2) Task priorities & stacks are ignored; every task runs w/ the default thread attributes.
+*
+*            (3) Timeouts are expressed in milliseconds; a timeout of 0 waits forever.
+*********************************************************************************************************
+*/
+
+#ifndef  KAL_MODULE_PRESENT
+#define  KAL_MODULE_PRESENT
+
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+
+
+/*
+*********************************************************************************************************
+*                                              DEFINES
+*********************************************************************************************************
+*/
+
+#define  KAL_OPT_NONE                           DEF_BIT_NONE
+
+#define  KAL_OPT_CREATE_NONE                    DEF_BIT_NONE
+
+#define  KAL_OPT_PEND_NONE                      DEF_BIT_NONE
+#define  KAL_OPT_PEND_BLOCKING                  DEF_BIT_NONE
+#define  KAL_OPT_PEND_NON_BLOCKING              DEF_BIT_00
+
+#define  KAL_OPT_POST_NONE                      DEF_BIT_NONE
+
+#define  KAL_OPT_ABORT_NONE                     DEF_BIT_NONE
+
+#define  KAL_TIMEOUT_INFINITE                              0u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT08U  KAL_OPT;
+
+typedef  CPU_INT32U  KAL_TICK;
+
+
+typedef  enum  kal_err {
+    KAL_ERR_NONE = 0u,
+
+    KAL_ERR_INVALID_ARG,
+    KAL_ERR_NULL_PTR,
+    KAL_ERR_MEM_ALLOC,
+    KAL_ERR_TIMEOUT,
+    KAL_ERR_ABORT,
+    KAL_ERR_WOULD_BLOCK,
+    KAL_ERR_OVF,
+    KAL_ERR_OS
+} KAL_ERR;
+
+
+typedef  struct  kal_lock_handle {
+    void  *LockObjPtr;
+} KAL_LOCK_HANDLE;
+
+typedef  struct  kal_sem_handle {
+    void  *SemObjPtr;
+} KAL_SEM_HANDLE;
+
+typedef  struct  kal_task_handle {
+    void  *TaskObjPtr;
+} KAL_TASK_HANDLE;
+
+typedef  struct  kal_lock_ext_cfg  KAL_LOCK_EXT_CFG;
+typedef  struct  kal_sem_ext_cfg   KAL_SEM_EXT_CFG;
+typedef  struct  kal_task_ext_cfg  KAL_TASK_EXT_CFG;
+
+
+/*
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*/
+
+extern  const  KAL_LOCK_HANDLE  KAL_LockHandleNull;
+extern  const  KAL_SEM_HANDLE   KAL_SemHandleNull;
+extern  const  KAL_TASK_HANDLE  KAL_TaskHandleNull;
+
+
+/*
+*********************************************************************************************************
+*                                               MACRO'S
+*********************************************************************************************************
+*/
+
+#define  KAL_LOCK_HANDLE_IS_NULL(lock_handle)   (((lock_handle).LockObjPtr == KAL_LockHandleNull.LockObjPtr) ? DEF_YES : DEF_NO)
+#define  KAL_SEM_HANDLE_IS_NULL(sem_handle)     (((sem_handle).SemObjPtr   == KAL_SemHandleNull.SemObjPtr)   ? DEF_YES : DEF_NO)
+#define  KAL_TASK_HANDLE_IS_NULL(task_handle)   (((task_handle).TaskObjPtr == KAL_TaskHandleNull.TaskObjPtr) ? DEF_YES : DEF_NO)
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+KAL_LOCK_HANDLE  KAL_LockCreate (const  CPU_CHAR          *p_name,
+                                        KAL_LOCK_EXT_CFG  *p_cfg,
+                                        KAL_ERR           *p_err);
+
+void             KAL_LockAcquire(       KAL_LOCK_HANDLE    lock_handle,
+                                        KAL_OPT            opt,
+                                        CPU_INT32U         timeout_ms,
+                                        KAL_ERR           *p_err);
+
+void             KAL_LockRelease(       KAL_LOCK_HANDLE    lock_handle,
+                                        KAL_ERR           *p_err);
+
+void             KAL_LockDel    (       KAL_LOCK_HANDLE    lock_handle,
+                                        KAL_ERR           *p_err);
+
+
+KAL_SEM_HANDLE   KAL_SemCreate  (const  CPU_CHAR          *p_name,
+                                        KAL_SEM_EXT_CFG   *p_cfg,
+                                        KAL_ERR           *p_err);
+
+void             KAL_SemPend    (       KAL_SEM_HANDLE     sem_handle,
+                                        KAL_OPT            opt,
+                                        CPU_INT32U         timeout_ms,
+                                        KAL_ERR           *p_err);
+
+void             KAL_SemPost    (       KAL_SEM_HANDLE     sem_handle,
+                                        KAL_OPT            opt,
+                                        KAL_ERR           *p_err);
+
+void             KAL_SemPendAbort(      KAL_SEM_HANDLE     sem_handle,
+                                        KAL_ERR           *p_err);
+
+void             KAL_SemDel     (       KAL_SEM_HANDLE     sem_handle,
+                                        KAL_ERR           *p_err);
+
+
+KAL_TASK_HANDLE  KAL_TaskAlloc  (const  CPU_CHAR          *p_name,
+                                        void              *p_stk_base,
+                                        CPU_SIZE_T         stk_size_bytes,
+                                        KAL_TASK_EXT_CFG  *p_cfg,
+                                        KAL_ERR           *p_err);
+
+void             KAL_TaskCreate (       KAL_TASK_HANDLE    task_handle,
+                                        void             (*p_fnct)(void  *p_arg),
+                                        void              *p_task_arg,
+                                        CPU_INT08U         prio,
+                                        KAL_TASK_EXT_CFG  *p_cfg,
+                                        KAL_ERR           *p_err);
+
+
+void             KAL_Dly        (       CPU_INT32U         dly_ms);
+
+KAL_TICK         KAL_TickGet    (       KAL_ERR           *p_err);
+
+#endif  /* KAL_MODULE_PRESENT */
@@ -0,0 +1,41 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                          NETWORK SUITE
+*
+* Filename : net.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_MODULE_PRESENT
+#define  NET_MODULE_PRESENT
+
+#include  <Source/net_cfg_net.h>
+#include  <Source/net_type.h>
+#include  <Source/net_sock.h>
+#include  <Source/net_app.h>
+#include  <Source/net_ascii.h>
+#include  <Source/net_util.h>
+#include  <IF/net_if.h>
+
+#endif  /* NET_MODULE_PRESENT */
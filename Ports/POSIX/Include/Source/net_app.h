@@ -0,0 +1,49 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                     NETWORK APPLICATION INTERFACE
+*
+* Filename : net_app.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net_app.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_APP_MODULE_PRESENT
+#define  NET_APP_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  NetApp_SetSockAddr(NET_SOCK_ADDR         *p_sock_addr,
+                         NET_SOCK_ADDR_FAMILY   addr_family,
+                         NET_PORT_NBR           port_nbr,
+                         CPU_INT08U            *p_addr,
+                         NET_SOCK_ADDR_LEN      addr_len,
+                         NET_ERR               *p_err);
+
+#endif  /* NET_APP_MODULE_PRESENT */
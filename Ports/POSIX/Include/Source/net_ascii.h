@@ -0,0 +1,64 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                      NETWORK ASCII LIBRARY
+*
+* Filename : net_ascii.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net_ascii.h' when DNSc is built on a POSIX host.
+*
+*            (2) As w/ uC/TCP-IP :
+*
+*                (a) NetASCII_Str_to_IP() returns the address in network order.
+*
+*                (b) NetASCII_IPv4_to_Str() takes an IPv4 address in host order.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_ASCII_MODULE_PRESENT
+#define  NET_ASCII_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+NET_IP_ADDR_FAMILY  NetASCII_Str_to_IP  (CPU_CHAR       *p_addr_ip_str,
+                                         void           *p_addr,
+                                         CPU_INT08U      addr_max_len,
+                                         NET_ERR        *p_err);
+
+void                NetASCII_IPv4_to_Str(NET_IPv4_ADDR   addr,
+                                         CPU_CHAR       *p_addr_ip_str,
+                                         CPU_BOOLEAN     lead_zeros,
+                                         NET_ERR        *p_err);
+
+void                NetASCII_IPv6_to_Str(NET_IPv6_ADDR  *p_addr,
+                                         CPU_CHAR       *p_addr_ip_str,
+                                         CPU_BOOLEAN     hex_lower_case,
+                                         CPU_BOOLEAN     lead_zeros,
+                                         NET_ERR        *p_err);
+
+#endif  /* NET_ASCII_MODULE_PRESENT */
@@ -0,0 +1,49 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                   NETWORK CONFIGURATION DEFINES
+*
+* Filename : net_cfg_net.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net_cfg_net.h' when DNSc is built on a POSIX host.
+*
+*            (2) Both IP families are enabled by default. Define 'NET_CFG_IPv4_DIS' or 'NET_CFG_IPv6_DIS'
+*                on the compiler command line to build a single-family DNSc.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_CFG_NET_MODULE_PRESENT
+#define  NET_CFG_NET_MODULE_PRESENT
+
+#ifndef  NET_CFG_IPv4_DIS
+#define  NET_IPv4_MODULE_EN
+#endif
+
+#ifndef  NET_CFG_IPv6_DIS
+#define  NET_IPv6_MODULE_EN
+#endif
+
+#if (defined(NET_IPv4_MODULE_EN) || \
+     defined(NET_IPv6_MODULE_EN))
+#define  NET_IP_MODULE_EN
+#endif
+
+#endif  /* NET_CFG_NET_MODULE_PRESENT */
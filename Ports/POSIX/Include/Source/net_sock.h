@@ -0,0 +1,77 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                          NETWORK SOCKETS
+*
+* Filename : net_sock.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net_sock.h' when DNSc is built on a POSIX host.
+*                Socket IDs are the host's file descriptors.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_SOCK_MODULE_PRESENT
+#define  NET_SOCK_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+NET_SOCK_ID  NetSock_Open  (NET_SOCK_PROTOCOL_FAMILY   protocol_family,
+                            NET_SOCK_TYPE              sock_type,
+                            NET_SOCK_PROTOCOL          protocol,
+                            NET_ERR                   *p_err);
+
+void         NetSock_Close (NET_SOCK_ID                sock_id,
+                            NET_ERR                   *p_err);
+
+CPU_INT32S   NetSock_Bind  (NET_SOCK_ID                sock_id,
+                            NET_SOCK_ADDR             *p_addr_local,
+                            NET_SOCK_ADDR_LEN          addr_len,
+                            NET_ERR                   *p_err);
+
+CPU_INT32S   NetSock_Conn  (NET_SOCK_ID                sock_id,
+                            NET_SOCK_ADDR             *p_addr_remote,
+                            NET_SOCK_ADDR_LEN          addr_len,
+                            NET_ERR                   *p_err);
+
+CPU_INT32S   NetSock_TxData(NET_SOCK_ID                sock_id,
+                            void                      *p_data,
+                            CPU_INT16U                 data_len,
+                            NET_SOCK_API_FLAGS         flags,
+                            NET_ERR                   *p_err);
+
+CPU_INT32S   NetSock_RxData(NET_SOCK_ID                sock_id,
+                            void                      *p_data_buf,
+                            CPU_INT16U                 data_buf_len,
+                            NET_SOCK_API_FLAGS         flags,
+                            NET_ERR                   *p_err);
+
+CPU_BOOLEAN  NetSock_CfgIF (NET_SOCK_ID                sock_id,
+                            NET_IF_NBR                 if_nbr,
+                            NET_ERR                   *p_err);
+
+#endif  /* NET_SOCK_MODULE_PRESENT */
@@ -0,0 +1,164 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                         NETWORK DATA TYPES
+*
+* Filename : net_type.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net_type.h' when DNSc is built on a POSIX host.
+*                Only the types, error codes & constants used by DNSc are provided.
+*
+*            (2) As w/ uC/TCP-IP, the address & port of a socket address are kept in network order.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_TYPE_MODULE_PRESENT
+#define  NET_TYPE_MODULE_PRESENT
+
+#include  <cpu.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <KAL/kal.h>
+#include  <Source/net_cfg_net.h>
+
+
+/*
+*********************************************************************************************************
+*                                              DEFINES
+*********************************************************************************************************
+*/
+
+#define  NET_SOCK_ID_NONE                                 -1
+
+#define  NET_PORT_NBR_NONE                                 0u
+
+#define  NET_IF_NBR_BASE_CFGD                              1u
+#define  NET_IF_NBR_WILDCARD                             254u
+#define  NET_IF_NBR_NONE                                 255u
+
+#define  NET_IPv4_ADDR_LEN                                 4u
+#define  NET_IPv4_ADDR_SIZE                                4u
+#define  NET_IPv6_ADDR_LEN                                16u
+#define  NET_IPv6_ADDR_SIZE                               16u
+
+#define  NET_SOCK_ADDR_IPv4_SIZE                          16u
+#define  NET_SOCK_ADDR_IPv6_SIZE                          28u
+
+#define  NET_SOCK_ADDR_FAMILY_IP_V4                        2u
+#define  NET_SOCK_ADDR_FAMILY_IP_V6                       10u
+
+#define  NET_SOCK_PROTOCOL_FAMILY_IP_V4                    2u
+#define  NET_SOCK_PROTOCOL_FAMILY_IP_V6                   10u
+
+#define  NET_SOCK_TYPE_DATAGRAM                            2u
+
+#define  NET_SOCK_PROTOCOL_UDP                            17u
+
+#define  NET_SOCK_FLAG_NONE                     DEF_BIT_NONE
+#define  NET_SOCK_FLAG_TX_NO_BLOCK              DEF_BIT_07
+#define  NET_SOCK_FLAG_RX_NO_BLOCK              DEF_BIT_07
+
+#define  NET_ASCII_LEN_MAX_ADDR_IPv4                      16u
+#define  NET_ASCII_LEN_MAX_ADDR_IPv6                      40u
+#define  NET_ASCII_LEN_MAX_ADDR_IP              NET_ASCII_LEN_MAX_ADDR_IPv6
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  CPU_INT16S  NET_SOCK_ID;
+typedef  CPU_INT16U  NET_PORT_NBR;
+typedef  CPU_INT08U  NET_IF_NBR;
+typedef  CPU_INT32U  NET_TS_MS;
+
+typedef  CPU_INT16U  NET_SOCK_ADDR_LEN;
+typedef  CPU_INT16U  NET_SOCK_ADDR_FAMILY;
+typedef  CPU_INT16U  NET_SOCK_PROTOCOL_FAMILY;
+typedef  CPU_INT08U  NET_SOCK_TYPE;
+typedef  CPU_INT08U  NET_SOCK_PROTOCOL;
+typedef  CPU_INT16U  NET_SOCK_API_FLAGS;
+
+typedef  CPU_INT08U  NET_IP_ADDRS_QTY;
+
+typedef  CPU_INT32U  NET_IPv4_ADDR;
+
+typedef  struct  net_ipv6_addr {
+    CPU_INT08U  Addr[NET_IPv6_ADDR_SIZE];
+} NET_IPv6_ADDR;
+
+
+typedef  struct  net_sock_addr {                                /* See Note #2.                                         */
+    NET_SOCK_ADDR_FAMILY  AddrFamily;
+    NET_PORT_NBR          Port;
+    CPU_INT08U            Addr[NET_IPv6_ADDR_SIZE];
+} NET_SOCK_ADDR;
+
+
+typedef  enum  net_ip_addr_family {
+    NET_IP_ADDR_FAMILY_NONE    = 0u,
+    NET_IP_ADDR_FAMILY_UNKNOWN = 0u,
+    NET_IP_ADDR_FAMILY_IPv4    = 4u,
+    NET_IP_ADDR_FAMILY_IPv6    = 6u
+} NET_IP_ADDR_FAMILY;
+
+
+typedef  enum  net_if_link_state {
+    NET_IF_LINK_DOWN = 0u,
+    NET_IF_LINK_UP   = 1u
+} NET_IF_LINK_STATE;
+
+
+typedef  enum  net_err {
+    NET_ERR_NONE                        =    0u,
+    NET_SOCK_ERR_NONE                   =    0u,
+    NET_APP_ERR_NONE                    =    0u,
+    NET_ASCII_ERR_NONE                  =    0u,
+    NET_IF_ERR_NONE                     =    0u,
+    NET_IPv4_ERR_NONE                   =    0u,
+    NET_IPv6_ERR_NONE                   =    0u,
+
+    NET_ERR_FAULT_NULL_PTR              = 1000u,
+    NET_ERR_FAULT_MEM_ALLOC,
+    NET_ERR_FAULT_UNKNOWN_ERR,
+    NET_ERR_INVALID_ADDR,
+    NET_ERR_IF_LINK_DOWN,
+    NET_ERR_TX,
+    NET_ERR_RX,
+
+    NET_SOCK_ERR_INVALID_SOCK           = 2000u,
+    NET_SOCK_ERR_INVALID_FAMILY,
+    NET_SOCK_ERR_INVALID_ADDR,
+    NET_SOCK_ERR_NONE_AVAIL,
+    NET_SOCK_ERR_RX_Q_EMPTY,
+    NET_SOCK_ERR_CONN_FAIL,
+    NET_SOCK_ERR_CLOSED,
+
+    NET_ASCII_ERR_NULL_PTR              = 3000u,
+    NET_ASCII_ERR_INVALID_STR_LEN,
+    NET_ASCII_ERR_INVALID_CHAR_VAL,
+    NET_ASCII_ERR_IP_FAMILY_NOT_PRESENT
+} NET_ERR;
+
+#endif  /* NET_TYPE_MODULE_PRESENT */
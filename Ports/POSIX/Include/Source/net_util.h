@@ -0,0 +1,72 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                       NETWORK UTILITY LIBRARY
+*
+* Filename : net_util.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/TCP-IP's 'Source/net_util.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_UTIL_MODULE_PRESENT
+#define  NET_UTIL_MODULE_PRESENT
+
+#include  <Source/net_type.h>
+
+
+/*
+*********************************************************************************************************
+*                                    NETWORK WORD ORDER MACRO'S
+*********************************************************************************************************
+*/
+
+#define  NET_UTIL_VAL_SWAP_ORDER_16(val)        ((CPU_INT16U)((((CPU_INT16U)(val) & 0xFF00u) >> 8u) | \
+                                                              (((CPU_INT16U)(val) & 0x00FFu) << 8u)))
+
+#define  NET_UTIL_VAL_SWAP_ORDER_32(val)        ((CPU_INT32U)((((CPU_INT32U)(val) & 0xFF000000u) >> 24u) | \
+                                                              (((CPU_INT32U)(val) & 0x00FF0000u) >>  8u) | \
+                                                              (((CPU_INT32U)(val) & 0x0000FF00u) <<  8u) | \
+                                                              (((CPU_INT32U)(val) & 0x000000FFu) << 24u)))
+
+#if (CPU_CFG_ENDIAN_TYPE == CPU_ENDIAN_TYPE_BIG)
+#define  NET_UTIL_HOST_TO_NET_16(val)           ((CPU_INT16U)(val))
+#define  NET_UTIL_HOST_TO_NET_32(val)           ((CPU_INT32U)(val))
+#else
+#define  NET_UTIL_HOST_TO_NET_16(val)           NET_UTIL_VAL_SWAP_ORDER_16(val)
+#define  NET_UTIL_HOST_TO_NET_32(val)           NET_UTIL_VAL_SWAP_ORDER_32(val)
+#endif
+
+#define  NET_UTIL_NET_TO_HOST_16(val)           NET_UTIL_HOST_TO_NET_16(val)
+#define  NET_UTIL_NET_TO_HOST_32(val)           NET_UTIL_HOST_TO_NET_32(val)
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*
+* Note(s) : (1) NetUtil_TS_Get_ms() returns the host's monotonic clock, truncated to 32 bits.
+*********************************************************************************************************
+*/
+
+NET_TS_MS  NetUtil_TS_Get_ms(void);
+
+#endif  /* NET_UTIL_MODULE_PRESENT */
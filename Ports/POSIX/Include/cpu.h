@@ -0,0 +1,116 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                          CPU DEFINITIONS
+*
+* Filename : cpu.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/CPU's 'cpu.h' when DNSc is built on a POSIX host (see
+*                'Ports/POSIX/readme.md'). Only the definitions used by DNSc are provided.
+*
+*            (2) Critical sections are emulated w/ a single recursive mutex shared by every thread.
+*********************************************************************************************************
+*/
+
+#ifndef  CPU_MODULE_PRESENT
+#define  CPU_MODULE_PRESENT
+
+#include  <stdint.h>
+#include  <stddef.h>
+
+
+/*
+*********************************************************************************************************
+*                                           CPU DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef            void        CPU_VOID;
+typedef            char        CPU_CHAR;
+typedef  unsigned  char        CPU_BOOLEAN;
+typedef            uint8_t     CPU_INT08U;
+typedef            int8_t      CPU_INT08S;
+typedef            uint16_t    CPU_INT16U;
+typedef            int16_t     CPU_INT16S;
+typedef            uint32_t    CPU_INT32U;
+typedef            int32_t     CPU_INT32S;
+typedef            uint64_t    CPU_INT64U;
+typedef            int64_t     CPU_INT64S;
+typedef            float       CPU_FP32;
+typedef            double      CPU_FP64;
+
+typedef            uintptr_t   CPU_ADDR;
+typedef            uintptr_t   CPU_DATA;
+typedef            uintptr_t   CPU_ALIGN;
+typedef            size_t      CPU_SIZE_T;
+
+typedef            CPU_INT32U  CPU_SR;
+
+
+/*
+*********************************************************************************************************
+*                                    CPU WORD SIZE & ENDIANNESS
+*********************************************************************************************************
+*/
+
+#define  CPU_WORD_SIZE_08                                  1u
+#define  CPU_WORD_SIZE_16                                  2u
+#define  CPU_WORD_SIZE_32                                  4u
+#define  CPU_WORD_SIZE_64                                  8u
+
+#define  CPU_CFG_ADDR_SIZE                      sizeof(CPU_ADDR)
+#define  CPU_CFG_DATA_SIZE                      sizeof(CPU_DATA)
+
+#define  CPU_ENDIAN_TYPE_BIG                               1u
+#define  CPU_ENDIAN_TYPE_LITTLE                            2u
+
+#if (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define  CPU_CFG_ENDIAN_TYPE                    CPU_ENDIAN_TYPE_BIG
+#else
+#define  CPU_CFG_ENDIAN_TYPE                    CPU_ENDIAN_TYPE_LITTLE
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         CRITICAL SECTIONS
+*
+* Note(s) : (1) See 'cpu.h  Note #2'. 'cpu_sr' is only declared to keep the uC/CPU usage pattern.
+*********************************************************************************************************
+*/
+
+#define  CPU_SR_ALLOC()                         CPU_SR  cpu_sr = (CPU_SR)0
+
+#define  CPU_CRITICAL_ENTER()                   do { (void)cpu_sr; CPU_CriticalEnter(); } while (0)
+#define  CPU_CRITICAL_EXIT()                    do { CPU_CriticalExit(); } while (0)
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalEnter(void);
+
+void  CPU_CriticalExit (void);
+
+#endif  /* CPU_MODULE_PRESENT */
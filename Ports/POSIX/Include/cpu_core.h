@@ -0,0 +1,55 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                          CPU CORE LIBRARY
+*
+* Filename : cpu_core.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/CPU's 'cpu_core.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  CPU_CORE_MODULE_PRESENT
+#define  CPU_CORE_MODULE_PRESENT
+
+#include  <cpu.h>
+
+
+/*
+*********************************************************************************************************
+*                                     SOFTWARE EXCEPTION MACRO
+*
+* Note(s) : (1) A software exception aborts the process; 'err_rtn_val' is never returned.
+*********************************************************************************************************
+*/
+
+#define  CPU_SW_EXCEPTION(err_rtn_val)          do { CPU_SW_Exception(); } while (0)
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void  CPU_SW_Exception(void);
+
+#endif  /* CPU_CORE_MODULE_PRESENT */
@@ -0,0 +1,74 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                      ASCII CHARACTER OPERATIONS
+*
+* Filename : lib_ascii.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/LIB's 'lib_ascii.h' when DNSc is built on a POSIX host.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_ASCII_MODULE_PRESENT
+#define  LIB_ASCII_MODULE_PRESENT
+
+#include  <cpu.h>
+#include  <lib_def.h>
+
+
+/*
+*********************************************************************************************************
+*                                         ASCII CHARACTERS
+*********************************************************************************************************
+*/
+
+#define  ASCII_CHAR_NULL                                0x00
+#define  ASCII_CHAR_CHARACTER_TABULATION                0x09
+#define  ASCII_CHAR_LINE_FEED                           0x0A
+#define  ASCII_CHAR_CARRIAGE_RETURN                     0x0D
+#define  ASCII_CHAR_SPACE                               0x20
+#define  ASCII_CHAR_NUMBER_SIGN                         0x23
+#define  ASCII_CHAR_HYPHEN_MINUS                        0x2D
+#define  ASCII_CHAR_FULL_STOP                           0x2E
+#define  ASCII_CHAR_COLON                               0x3A
+#define  ASCII_CHAR_DELETE                              0x7F
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  ASCII_IsAlphaNum   (CPU_CHAR  c);
+
+CPU_BOOLEAN  ASCII_IsDig        (CPU_CHAR  c);
+
+CPU_BOOLEAN  ASCII_IsCtrl       (CPU_CHAR  c);
+
+CPU_BOOLEAN  ASCII_IsSpace      (CPU_CHAR  c);
+
+CPU_CHAR     ASCII_ToLower      (CPU_CHAR  c);
+
+CPU_BOOLEAN  ASCII_CmpIgnoreCase(CPU_CHAR  c1,
+                                 CPU_CHAR  c2);
+
+#endif  /* LIB_ASCII_MODULE_PRESENT */
@@ -0,0 +1,143 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                      STANDARD MEMORY OPERATIONS
+*
+* Filename : lib_mem.h
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file replaces uC/LIB's 'lib_mem.h' when DNSc is built on a POSIX host.
+*
+*            (2) Memory segments are not emulated: every segment allocation is served by the C heap & the
+*                segment pointer is ignored.
+*
+*            (3) Dynamic pools follow uC/LIB's semantics: blocks are allocated on demand until 'BlkQtyMax'
+*                blocks exist ('LIB_MEM_BLK_QTY_UNLIMITED' for no limit) & freed blocks are kept in a free
+*                list for re-use.
+*********************************************************************************************************
+*/
+
+#ifndef  LIB_MEM_MODULE_PRESENT
+#define  LIB_MEM_MODULE_PRESENT
+
+#include  <cpu.h>
+#include  <lib_def.h>
+
+
+/*
+*********************************************************************************************************
+*                                              DEFINES
+*********************************************************************************************************
+*/
+
+#define  LIB_MEM_BLK_QTY_UNLIMITED                         0u
+
+
+/*
+*********************************************************************************************************
+*                                             DATA TYPES
+*********************************************************************************************************
+*/
+
+typedef  enum  lib_err {
+    LIB_ERR_NONE              =     0u,
+    LIB_MEM_ERR_NONE          =     0u,
+
+    LIB_MEM_ERR_NULL_PTR      = 10001u,
+    LIB_MEM_ERR_INVALID_BLK_SIZE,
+    LIB_MEM_ERR_INVALID_BLK_ALIGN,
+    LIB_MEM_ERR_POOL_EMPTY,
+    LIB_MEM_ERR_SEG_OVF,
+    LIB_MEM_ERR_HEAP_OVF
+} LIB_ERR;
+
+
+typedef  struct  mem_seg {
+    const  CPU_CHAR    *NamePtr;
+} MEM_SEG;
+
+
+typedef  struct  mem_dyn_pool {
+    const  CPU_CHAR    *NamePtr;
+           void        *BlkFreeListPtr;                         /* Freed blks, linked through their first word.         */
+           CPU_SIZE_T   BlkSize;
+           CPU_SIZE_T   BlkAlign;
+           CPU_SIZE_T   BlkQtyMax;
+           CPU_SIZE_T   BlkAllocCnt;
+} MEM_DYN_POOL;
+
+
+/*
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*/
+
+void         Mem_Clr                 (       void          *p_mem,
+                                             CPU_SIZE_T     size);
+
+void         Mem_Set                 (       void          *p_mem,
+                                             CPU_INT08U     data_val,
+                                             CPU_SIZE_T     size);
+
+void         Mem_Copy                (       void          *p_dest,
+                                      const  void          *p_src,
+                                             CPU_SIZE_T     size);
+
+void         Mem_Move                (       void          *p_dest,
+                                      const  void          *p_src,
+                                             CPU_SIZE_T     size);
+
+CPU_BOOLEAN  Mem_Cmp                 (const  void          *p1_mem,
+                                      const  void          *p2_mem,
+                                             CPU_SIZE_T     size);
+
+void        *Mem_SegAlloc            (const  CPU_CHAR      *p_name,
+                                             MEM_SEG       *p_seg,
+                                             CPU_SIZE_T     size,
+                                             LIB_ERR       *p_err);
+
+void        *Mem_SegAllocExt         (const  CPU_CHAR      *p_name,
+                                             MEM_SEG       *p_seg,
+                                             CPU_SIZE_T     size,
+                                             CPU_SIZE_T     align,
+                                             CPU_SIZE_T    *p_bytes_reqd,
+                                             LIB_ERR       *p_err);
+
+void         Mem_DynPoolCreate       (const  CPU_CHAR      *p_name,
+                                             MEM_DYN_POOL  *p_pool,
+                                             MEM_SEG       *p_seg,
+                                             CPU_SIZE_T     blk_size,
+                                             CPU_SIZE_T     blk_align,
+                                             CPU_SIZE_T     blk_qty_init,
+                                             CPU_SIZE_T     blk_qty_max,
+                                             LIB_ERR       *p_err);
+
+void        *Mem_DynPoolBlkGet       (       MEM_DYN_POOL  *p_pool,
+                                             LIB_ERR       *p_err);
+
+void         Mem_DynPoolBlkFree      (       MEM_DYN_POOL  *p_pool,
+                                             void          *p_blk,
+                                             LIB_ERR       *p_err);
+
+CPU_SIZE_T   Mem_DynPoolBlkNbrAvailGet(      MEM_DYN_POOL  *p_pool,
+                                             LIB_ERR       *p_err);
+
+#endif  /* LIB_MEM_MODULE_PRESENT */
@@ -0,0 +1,851 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                   KERNEL ABSTRACTION LAYER (KAL)
+*
+* Filename : kal_posix.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) Implements the subset of KAL used by DNSc over POSIX threads (see 'KAL/kal.h  Note #1').
+*
+*            (2) Semaphore timed waits use CLOCK_MONOTONIC, the clock NetUtil_TS_Get_ms() is based on.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  700
+
+#include  <errno.h>
+#include  <pthread.h>
+#include  <sched.h>
+#include  <stdlib.h>
+#include  <time.h>
+
+#include  <KAL/kal.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  kal_lock_obj {
+    pthread_mutex_t   Mutex;
+} KAL_LOCK_OBJ;
+
+
+typedef  struct  kal_sem_obj {
+    pthread_mutex_t   Mutex;
+    pthread_cond_t    Cond;
+    CPU_INT32U        Cnt;
+    CPU_INT32U        AbortCtr;                                 /* Incremented by each KAL_SemPendAbort().              */
+} KAL_SEM_OBJ;
+
+
+typedef  struct  kal_task_obj {
+    const  CPU_CHAR   *NamePtr;
+           pthread_t   Thread;
+           void      (*FnctPtr)(void  *p_arg);
+           void       *ArgPtr;
+} KAL_TASK_OBJ;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+const  KAL_LOCK_HANDLE  KAL_LockHandleNull = { DEF_NULL };
+const  KAL_SEM_HANDLE   KAL_SemHandleNull  = { DEF_NULL };
+const  KAL_TASK_HANDLE  KAL_TaskHandleNull = { DEF_NULL };
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void  *KAL_TaskTrampoline(void             *p_arg);
+
+static  void   KAL_TimeoutGet    (clockid_t         clk_id,
+                                  CPU_INT32U        timeout_ms,
+                                  struct  timespec *p_ts);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          KAL_LockCreate()
+*
+* Description : Create a lock.
+*
+* Argument(s) : p_name      Name of the lock (unused).
+*
+*               p_cfg       Pointer to the extended configuration (unused).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               KAL_ERR_NONE        Lock created.
+*                               KAL_ERR_MEM_ALLOC   Lock could not be allocated.
+*                               KAL_ERR_OS          Mutex could not be initialized.
+*
+* Return(s)   : Handle of the lock, KAL_LockHandleNull on error.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+KAL_LOCK_HANDLE  KAL_LockCreate (const  CPU_CHAR          *p_name,
+                                        KAL_LOCK_EXT_CFG  *p_cfg,
+                                        KAL_ERR           *p_err)
+{
+    KAL_LOCK_HANDLE   handle = KAL_LockHandleNull;
+    KAL_LOCK_OBJ     *p_lock;
+
+
+    (void)p_name;
+    (void)p_cfg;
+
+    p_lock = (KAL_LOCK_OBJ *)malloc(sizeof(KAL_LOCK_OBJ));
+    if (p_lock == DEF_NULL) {
+       *p_err = KAL_ERR_MEM_ALLOC;
+        return (handle);
+    }
+
+    if (pthread_mutex_init(&p_lock->Mutex, DEF_NULL) != 0) {
+        free(p_lock);
+       *p_err = KAL_ERR_OS;
+        return (handle);
+    }
+
+    handle.LockObjPtr = p_lock;
+   *p_err             = KAL_ERR_NONE;
+
+    return (handle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          KAL_LockAcquire()
+*
+* Description : Acquire a lock.
+*
+* Argument(s) : lock_handle     Handle of the lock.
+*
+*               opt             KAL_OPT_PEND_NON_BLOCKING to return immediately if the lock is taken.
+*
+*               timeout_ms      Timeout, in milliseconds (see 'KAL/kal.h  Note #3').
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Lock acquired.
+*                                   KAL_ERR_NULL_PTR        Null lock handle.
+*                                   KAL_ERR_WOULD_BLOCK     Lock taken & KAL_OPT_PEND_NON_BLOCKING set.
+*                                   KAL_ERR_TIMEOUT         Lock not acquired within 'timeout_ms'.
+*                                   KAL_ERR_OS              Mutex error.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) pthread_mutex_timedlock() always waits on CLOCK_REALTIME.
+*********************************************************************************************************
+*/
+
+void  KAL_LockAcquire (KAL_LOCK_HANDLE   lock_handle,
+                       KAL_OPT           opt,
+                       CPU_INT32U        timeout_ms,
+                       KAL_ERR          *p_err)
+{
+    KAL_LOCK_OBJ     *p_lock = (KAL_LOCK_OBJ *)lock_handle.LockObjPtr;
+    struct  timespec  ts;
+    int               rtn;
+
+
+    if (p_lock == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    if (DEF_BIT_IS_SET(opt, KAL_OPT_PEND_NON_BLOCKING) == DEF_YES) {
+        rtn = pthread_mutex_trylock(&p_lock->Mutex);
+    } else if (timeout_ms == KAL_TIMEOUT_INFINITE) {
+        rtn = pthread_mutex_lock(&p_lock->Mutex);
+    } else {
+        KAL_TimeoutGet(CLOCK_REALTIME, timeout_ms, &ts);        /* See Note #1.                                         */
+        rtn = pthread_mutex_timedlock(&p_lock->Mutex, &ts);
+    }
+
+    switch (rtn) {
+        case 0:
+            *p_err = KAL_ERR_NONE;
+             break;
+
+        case EBUSY:
+            *p_err = KAL_ERR_WOULD_BLOCK;
+             break;
+
+        case ETIMEDOUT:
+            *p_err = KAL_ERR_TIMEOUT;
+             break;
+
+        default:
+            *p_err = KAL_ERR_OS;
+             break;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          KAL_LockRelease()
+*
+* Description : Release a lock.
+*
+* Argument(s) : lock_handle     Handle of the lock.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Lock released.
+*                                   KAL_ERR_NULL_PTR        Null lock handle.
+*                                   KAL_ERR_OS              Mutex error.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  KAL_LockRelease (KAL_LOCK_HANDLE   lock_handle,
+                       KAL_ERR          *p_err)
+{
+    KAL_LOCK_OBJ  *p_lock = (KAL_LOCK_OBJ *)lock_handle.LockObjPtr;
+
+
+    if (p_lock == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+   *p_err = (pthread_mutex_unlock(&p_lock->Mutex) == 0) ? KAL_ERR_NONE : KAL_ERR_OS;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_LockDel()
+*
+* Description : Delete a lock.
+*
+* Argument(s) : lock_handle     Handle of the lock.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Lock deleted.
+*                                   KAL_ERR_NULL_PTR        Null lock handle.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  KAL_LockDel (KAL_LOCK_HANDLE   lock_handle,
+                   KAL_ERR          *p_err)
+{
+    KAL_LOCK_OBJ  *p_lock = (KAL_LOCK_OBJ *)lock_handle.LockObjPtr;
+
+
+    if (p_lock == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    (void)pthread_mutex_destroy(&p_lock->Mutex);
+    free(p_lock);
+
+   *p_err = KAL_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           KAL_SemCreate()
+*
+* Description : Create a counting semaphore, initially 0.
+*
+* Argument(s) : p_name      Name of the semaphore (unused).
+*
+*               p_cfg       Pointer to the extended configuration (unused).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               KAL_ERR_NONE        Semaphore created.
+*                               KAL_ERR_MEM_ALLOC   Semaphore could not be allocated.
+*                               KAL_ERR_OS          Mutex or condition could not be initialized.
+*
+* Return(s)   : Handle of the semaphore, KAL_SemHandleNull on error.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+KAL_SEM_HANDLE  KAL_SemCreate (const  CPU_CHAR         *p_name,
+                                      KAL_SEM_EXT_CFG  *p_cfg,
+                                      KAL_ERR          *p_err)
+{
+    KAL_SEM_HANDLE       handle = KAL_SemHandleNull;
+    KAL_SEM_OBJ         *p_sem;
+    pthread_condattr_t   attr;
+
+
+    (void)p_name;
+    (void)p_cfg;
+
+    p_sem = (KAL_SEM_OBJ *)malloc(sizeof(KAL_SEM_OBJ));
+    if (p_sem == DEF_NULL) {
+       *p_err = KAL_ERR_MEM_ALLOC;
+        return (handle);
+    }
+
+    p_sem->Cnt      = 0u;
+    p_sem->AbortCtr = 0u;
+
+    if (pthread_mutex_init(&p_sem->Mutex, DEF_NULL) != 0) {
+        free(p_sem);
+       *p_err = KAL_ERR_OS;
+        return (handle);
+    }
+
+    (void)pthread_condattr_init(&attr);
+    (void)pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);    /* See 'kal_posix.c  Note #2'.                          */
+    if (pthread_cond_init(&p_sem->Cond, &attr) != 0) {
+        (void)pthread_condattr_destroy(&attr);
+        (void)pthread_mutex_destroy(&p_sem->Mutex);
+        free(p_sem);
+       *p_err = KAL_ERR_OS;
+        return (handle);
+    }
+    (void)pthread_condattr_destroy(&attr);
+
+    handle.SemObjPtr = p_sem;
+   *p_err            = KAL_ERR_NONE;
+
+    return (handle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_SemPend()
+*
+* Description : Wait on a semaphore.
+*
+* Argument(s) : sem_handle      Handle of the semaphore.
+*
+*               opt             KAL_OPT_PEND_NON_BLOCKING to return immediately if the semaphore is 0.
+*
+*               timeout_ms      Timeout, in milliseconds (see 'KAL/kal.h  Note #3').
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Semaphore obtained.
+*                                   KAL_ERR_NULL_PTR        Null semaphore handle.
+*                                   KAL_ERR_WOULD_BLOCK     Semaphore is 0 & KAL_OPT_PEND_NON_BLOCKING set.
+*                                   KAL_ERR_TIMEOUT         Semaphore not obtained within 'timeout_ms'.
+*                                   KAL_ERR_ABORT           Wait aborted by KAL_SemPendAbort().
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  KAL_SemPend (KAL_SEM_HANDLE   sem_handle,
+                   KAL_OPT          opt,
+                   CPU_INT32U       timeout_ms,
+                   KAL_ERR         *p_err)
+{
+    KAL_SEM_OBJ       *p_sem = (KAL_SEM_OBJ *)sem_handle.SemObjPtr;
+    struct  timespec   ts;
+    CPU_INT32U         abort_ctr;
+    int                rtn;
+
+
+    if (p_sem == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    KAL_TimeoutGet(CLOCK_MONOTONIC, timeout_ms, &ts);
+
+    (void)pthread_mutex_lock(&p_sem->Mutex);
+    abort_ctr = p_sem->AbortCtr;
+    rtn       = 0;
+    while ((p_sem->Cnt      == 0u)        &&
+           (p_sem->AbortCtr == abort_ctr) &&
+           (rtn             == 0)) {
+        if (DEF_BIT_IS_SET(opt, KAL_OPT_PEND_NON_BLOCKING) == DEF_YES) {
+            rtn = EWOULDBLOCK;
+        } else if (timeout_ms == KAL_TIMEOUT_INFINITE) {
+            rtn = pthread_cond_wait(&p_sem->Cond, &p_sem->Mutex);
+        } else {
+            rtn = pthread_cond_timedwait(&p_sem->Cond, &p_sem->Mutex, &ts);
+        }
+    }
+
+    if (p_sem->Cnt > 0u) {
+        p_sem->Cnt--;
+       *p_err = KAL_ERR_NONE;
+    } else if (p_sem->AbortCtr != abort_ctr) {
+       *p_err = KAL_ERR_ABORT;
+    } else if (rtn == EWOULDBLOCK) {
+       *p_err = KAL_ERR_WOULD_BLOCK;
+    } else if (rtn == ETIMEDOUT) {
+       *p_err = KAL_ERR_TIMEOUT;
+    } else {
+       *p_err = KAL_ERR_OS;
+    }
+    (void)pthread_mutex_unlock(&p_sem->Mutex);
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_SemPost()
+*
+* Description : Signal a semaphore.
+*
+* Argument(s) : sem_handle      Handle of the semaphore.
+*
+*               opt             Post options (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Semaphore signaled.
+*                                   KAL_ERR_NULL_PTR        Null semaphore handle.
+*                                   KAL_ERR_OVF             Semaphore count would overflow.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  KAL_SemPost (KAL_SEM_HANDLE   sem_handle,
+                   KAL_OPT          opt,
+                   KAL_ERR         *p_err)
+{
+    KAL_SEM_OBJ  *p_sem = (KAL_SEM_OBJ *)sem_handle.SemObjPtr;
+
+
+    (void)opt;
+
+    if (p_sem == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    (void)pthread_mutex_lock(&p_sem->Mutex);
+    if (p_sem->Cnt == DEF_INT_32U_MAX_VAL) {
+        (void)pthread_mutex_unlock(&p_sem->Mutex);
+       *p_err = KAL_ERR_OVF;
+        return;
+    }
+    p_sem->Cnt++;
+    (void)pthread_cond_signal(&p_sem->Cond);
+    (void)pthread_mutex_unlock(&p_sem->Mutex);
+
+   *p_err = KAL_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         KAL_SemPendAbort()
+*
+* Description : Abort every wait on a semaphore.
+*
+* Argument(s) : sem_handle      Handle of the semaphore.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Waits aborted.
+*                                   KAL_ERR_NULL_PTR        Null semaphore handle.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  KAL_SemPendAbort (KAL_SEM_HANDLE   sem_handle,
+                        KAL_ERR         *p_err)
+{
+    KAL_SEM_OBJ  *p_sem = (KAL_SEM_OBJ *)sem_handle.SemObjPtr;
+
+
+    if (p_sem == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    (void)pthread_mutex_lock(&p_sem->Mutex);
+    p_sem->AbortCtr++;
+    (void)pthread_cond_broadcast(&p_sem->Cond);
+    (void)pthread_mutex_unlock(&p_sem->Mutex);
+
+   *p_err = KAL_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_SemDel()
+*
+* Description : Delete a semaphore.
+*
+* Argument(s) : sem_handle      Handle of the semaphore.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Semaphore deleted.
+*                                   KAL_ERR_NULL_PTR        Null semaphore handle.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) No task may still wait on the semaphore.
+*********************************************************************************************************
+*/
+
+void  KAL_SemDel (KAL_SEM_HANDLE   sem_handle,
+                  KAL_ERR         *p_err)
+{
+    KAL_SEM_OBJ  *p_sem = (KAL_SEM_OBJ *)sem_handle.SemObjPtr;
+
+
+    if (p_sem == DEF_NULL) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    (void)pthread_cond_destroy(&p_sem->Cond);
+    (void)pthread_mutex_destroy(&p_sem->Mutex);
+    free(p_sem);
+
+   *p_err = KAL_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           KAL_TaskAlloc()
+*
+* Description : Allocate a task.
+*
+* Argument(s) : p_name          Name of the task.
+*
+*               p_stk_base      Pointer to the task's stack (unused, see 'KAL/kal.h  Note #2').
+*
+*               stk_size_bytes  Size of the task's stack (unused, see 'KAL/kal.h  Note #2').
+*
+*               p_cfg           Pointer to the extended configuration (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Task allocated.
+*                                   KAL_ERR_MEM_ALLOC       Task could not be allocated.
+*
+* Return(s)   : Handle of the task, KAL_TaskHandleNull on error.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+KAL_TASK_HANDLE  KAL_TaskAlloc (const  CPU_CHAR          *p_name,
+                                       void              *p_stk_base,
+                                       CPU_SIZE_T         stk_size_bytes,
+                                       KAL_TASK_EXT_CFG  *p_cfg,
+                                       KAL_ERR           *p_err)
+{
+    KAL_TASK_HANDLE   handle = KAL_TaskHandleNull;
+    KAL_TASK_OBJ     *p_task;
+
+
+    (void)p_stk_base;
+    (void)stk_size_bytes;
+    (void)p_cfg;
+
+    p_task = (KAL_TASK_OBJ *)malloc(sizeof(KAL_TASK_OBJ));
+    if (p_task == DEF_NULL) {
+       *p_err = KAL_ERR_MEM_ALLOC;
+        return (handle);
+    }
+
+    p_task->NamePtr = p_name;
+    p_task->FnctPtr = DEF_NULL;
+    p_task->ArgPtr  = DEF_NULL;
+
+    handle.TaskObjPtr = p_task;
+   *p_err             = KAL_ERR_NONE;
+
+    return (handle);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          KAL_TaskCreate()
+*
+* Description : Start a task previously allocated w/ KAL_TaskAlloc().
+*
+* Argument(s) : task_handle     Handle of the task.
+*
+*               p_fnct          Pointer to the task's function.
+*
+*               p_task_arg      Argument passed to the task's function.
+*
+*               prio            Priority of the task (unused, see 'KAL/kal.h  Note #2').
+*
+*               p_cfg           Pointer to the extended configuration (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   KAL_ERR_NONE            Task started.
+*                                   KAL_ERR_NULL_PTR        Null task handle or function.
+*                                   KAL_ERR_OS              Thread could not be created.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Tasks never return; the thread is detached.
+*********************************************************************************************************
+*/
+
+void  KAL_TaskCreate (KAL_TASK_HANDLE     task_handle,
+                      void              (*p_fnct)(void  *p_arg),
+                      void               *p_task_arg,
+                      CPU_INT08U          prio,
+                      KAL_TASK_EXT_CFG   *p_cfg,
+                      KAL_ERR            *p_err)
+{
+    KAL_TASK_OBJ  *p_task = (KAL_TASK_OBJ *)task_handle.TaskObjPtr;
+
+
+    (void)prio;
+    (void)p_cfg;
+
+    if ((p_task == DEF_NULL) ||
+        (p_fnct == DEF_NULL)) {
+       *p_err = KAL_ERR_NULL_PTR;
+        return;
+    }
+
+    p_task->FnctPtr = p_fnct;
+    p_task->ArgPtr  = p_task_arg;
+
+    if (pthread_create(&p_task->Thread, DEF_NULL, KAL_TaskTrampoline, p_task) != 0) {
+       *p_err = KAL_ERR_OS;
+        return;
+    }
+    (void)pthread_detach(p_task->Thread);                       /* See Note #1.                                         */
+
+   *p_err = KAL_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                              KAL_Dly()
+*
+* Description : Delay the calling task.
+*
+* Argument(s) : dly_ms      Delay, in milliseconds; 0 only yields the processor.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  KAL_Dly (CPU_INT32U  dly_ms)
+{
+    struct  timespec  ts;
+
+
+    if (dly_ms == 0u) {
+        (void)sched_yield();
+        return;
+    }
+
+    ts.tv_sec  = (time_t)(dly_ms / DEF_TIME_NBR_mS_PER_SEC);
+    ts.tv_nsec = (long)  (dly_ms % DEF_TIME_NBR_mS_PER_SEC) * 1000000L;
+    while (nanosleep(&ts, &ts) != 0) {
+        if (errno != EINTR) {
+            break;
+        }
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                            KAL_TickGet()
+*
+* Description : Get the current tick count; a tick is a millisecond.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               KAL_ERR_NONE        Tick count returned.
+*
+* Return(s)   : Tick count.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+KAL_TICK  KAL_TickGet (KAL_ERR  *p_err)
+{
+    struct  timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+   *p_err = KAL_ERR_NONE;
+
+    return ((KAL_TICK)((CPU_INT64U)ts.tv_sec * DEF_TIME_NBR_mS_PER_SEC + (CPU_INT64U)ts.tv_nsec / 1000000u));
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        KAL_TaskTrampoline()
+*
+* Description : Thread entry point, calls the task's function.
+*
+* Argument(s) : p_arg       Pointer to the task object.
+*
+* Return(s)   : DEF_NULL.
+*
+* Caller(s)   : Referenced by KAL_TaskCreate().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  *KAL_TaskTrampoline (void  *p_arg)
+{
+    KAL_TASK_OBJ  *p_task = (KAL_TASK_OBJ *)p_arg;
+
+
+    p_task->FnctPtr(p_task->ArgPtr);
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          KAL_TimeoutGet()
+*
+* Description : Convert a relative timeout to an absolute time.
+*
+* Argument(s) : clk_id      Clock the absolute time refers to.
+*
+*               timeout_ms  Timeout, in milliseconds.
+*
+*               p_ts        Pointer to variable that will receive the absolute time.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : KAL_LockAcquire(),
+*               KAL_SemPend().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  KAL_TimeoutGet (clockid_t          clk_id,
+                              CPU_INT32U         timeout_ms,
+                              struct  timespec  *p_ts)
+{
+    (void)clock_gettime(clk_id, p_ts);
+
+    p_ts->tv_sec  += (time_t)(timeout_ms / DEF_TIME_NBR_mS_PER_SEC);
+    p_ts->tv_nsec += (long)  (timeout_ms % DEF_TIME_NBR_mS_PER_SEC) * 1000000L;
+    if (p_ts->tv_nsec >= (long)DEF_TIME_NBR_nS_PER_SEC) {
+        p_ts->tv_sec++;
+        p_ts->tv_nsec -= (long)DEF_TIME_NBR_nS_PER_SEC;
+    }
+}
@@ -0,0 +1,1429 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                     uC/CPU & uC/LIB REPLACEMENT
+*
+* Filename : lib_posix.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) Implements the subset of uC/CPU & uC/LIB used by DNSc over the C library & POSIX threads.
+*                The functions follow uC/LIB's semantics, not the C library's, where both differ (see
+*                Str_Copy_N(), Str_Cat_N() & Str_FmtNbr_Int32U()).
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  700
+
+#include  <pthread.h>
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+
+#include  <cpu.h>
+#include  <cpu_core.h>
+#include  <lib_def.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <lib_ascii.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  mem_dyn_pool_blk {                             /* Free blk hdr, overlaid on the blk itself.            */
+    struct  mem_dyn_pool_blk  *NextPtr;
+} MEM_DYN_POOL_BLK;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  pthread_once_t   CPU_CriticalOnce = PTHREAD_ONCE_INIT;
+static  pthread_mutex_t  CPU_CriticalMutex;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void   CPU_CriticalInit(void);
+
+static  void  *Mem_HeapAlloc   (CPU_SIZE_T   size,
+                                CPU_SIZE_T   align);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          uC/CPU FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         CPU_CriticalEnter()
+*
+* Description : Enter a critical section.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : CPU_CRITICAL_ENTER().
+*
+* Note(s)     : (1) The critical section mutex is recursive so that critical sections can nest, as they do
+*                   on a target where CPU_CRITICAL_ENTER() saves the interrupt state.
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalEnter (void)
+{
+    (void)pthread_once(&CPU_CriticalOnce, CPU_CriticalInit);
+    (void)pthread_mutex_lock(&CPU_CriticalMutex);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_CriticalExit()
+*
+* Description : Exit a critical section.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : CPU_CRITICAL_EXIT().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  CPU_CriticalExit (void)
+{
+    (void)pthread_mutex_unlock(&CPU_CriticalMutex);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         CPU_SW_Exception()
+*
+* Description : Abort the process on a software exception.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : CPU_SW_EXCEPTION().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  CPU_SW_Exception (void)
+{
+    (void)fprintf(stderr, "CPU_SW_EXCEPTION\n");
+    abort();
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          uC/LIB FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                             Mem_Clr()
+*
+* Description : Clear a memory area.
+*
+* Argument(s) : p_mem       Pointer to the memory area.
+*
+*               size        Number of octets to clear.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  Mem_Clr (void        *p_mem,
+               CPU_SIZE_T   size)
+{
+    if (size > 0u) {
+        (void)memset(p_mem, 0, size);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Mem_Set()
+*
+* Description : Fill a memory area w/ a value.
+*
+* Argument(s) : p_mem       Pointer to the memory area.
+*
+*               data_val    Value to write in every octet.
+*
+*               size        Number of octets to set.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  Mem_Set (void        *p_mem,
+               CPU_INT08U   data_val,
+               CPU_SIZE_T   size)
+{
+    if (size > 0u) {
+        (void)memset(p_mem, data_val, size);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Mem_Copy()
+*
+* Description : Copy a memory area to a non-overlapping memory area.
+*
+* Argument(s) : p_dest      Pointer to the destination memory area.
+*
+*               p_src       Pointer to the source      memory area.
+*
+*               size        Number of octets to copy.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  Mem_Copy (       void        *p_dest,
+                const  void        *p_src,
+                       CPU_SIZE_T   size)
+{
+    if (size > 0u) {
+        (void)memcpy(p_dest, p_src, size);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Mem_Move()
+*
+* Description : Copy a memory area to a possibly overlapping memory area.
+*
+* Argument(s) : p_dest      Pointer to the destination memory area.
+*
+*               p_src       Pointer to the source      memory area.
+*
+*               size        Number of octets to move.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  Mem_Move (       void        *p_dest,
+                const  void        *p_src,
+                       CPU_SIZE_T   size)
+{
+    if (size > 0u) {
+        (void)memmove(p_dest, p_src, size);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Mem_Cmp()
+*
+* Description : Compare two memory areas.
+*
+* Argument(s) : p1_mem      Pointer to the first  memory area.
+*
+*               p2_mem      Pointer to the second memory area.
+*
+*               size        Number of octets to compare.
+*
+* Return(s)   : DEF_YES, if the memory areas are identical (or 'size' is 0).
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  Mem_Cmp (const  void        *p1_mem,
+                      const  void        *p2_mem,
+                             CPU_SIZE_T   size)
+{
+    if (size == 0u) {
+        return (DEF_YES);
+    }
+
+    return ((memcmp(p1_mem, p2_mem, size) == 0) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_SegAlloc()
+*
+* Description : Allocate a memory block from a segment.
+*
+* Argument(s) : p_name      Name of the allocation (unused).
+*
+*               p_seg       Pointer to the segment (unused, see 'lib_mem.h  Note #2').
+*
+*               size        Size of the block, in octets.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE        Block allocated.
+*                               LIB_MEM_ERR_SEG_OVF     Heap exhausted.
+*
+* Return(s)   : Pointer to the block, if NO error(s).
+*
+*               DEF_NULL,             otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  *Mem_SegAlloc (const  CPU_CHAR    *p_name,
+                            MEM_SEG     *p_seg,
+                            CPU_SIZE_T   size,
+                            LIB_ERR     *p_err)
+{
+    return (Mem_SegAllocExt(p_name, p_seg, size, sizeof(CPU_ALIGN), DEF_NULL, p_err));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          Mem_SegAllocExt()
+*
+* Description : Allocate an aligned memory block from a segment.
+*
+* Argument(s) : p_name          Name of the allocation (unused).
+*
+*               p_seg           Pointer to the segment (unused, see 'lib_mem.h  Note #2').
+*
+*               size            Size of the block, in octets.
+*
+*               align           Required alignment of the block, in octets.
+*
+*               p_bytes_reqd    Pointer to variable that will receive the number of octets missing, on failure.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE        Block allocated.
+*                                   LIB_MEM_ERR_SEG_OVF     Heap exhausted.
+*
+* Return(s)   : Pointer to the block, if NO error(s).
+*
+*               DEF_NULL,             otherwise.
+*
+* Caller(s)   : Mem_SegAlloc(),
+*               Various.
+*
+* Note(s)     : (1) The block is cleared so that runs do not depend on the heap's previous content.
+*********************************************************************************************************
+*/
+
+void  *Mem_SegAllocExt (const  CPU_CHAR    *p_name,
+                               MEM_SEG     *p_seg,
+                               CPU_SIZE_T   size,
+                               CPU_SIZE_T   align,
+                               CPU_SIZE_T  *p_bytes_reqd,
+                               LIB_ERR     *p_err)
+{
+    void  *p_blk;
+
+
+    (void)p_name;
+    (void)p_seg;
+
+    p_blk = Mem_HeapAlloc(size, align);
+    if (p_blk == DEF_NULL) {
+        if (p_bytes_reqd != DEF_NULL) {
+           *p_bytes_reqd = size;
+        }
+       *p_err = LIB_MEM_ERR_SEG_OVF;
+        return (DEF_NULL);
+    }
+
+    Mem_Clr(p_blk, size);                                       /* See Note #1.                                         */
+
+    if (p_bytes_reqd != DEF_NULL) {
+       *p_bytes_reqd = 0u;
+    }
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_DynPoolCreate()
+*
+* Description : Create a dynamic memory pool.
+*
+* Argument(s) : p_name          Name of the pool.
+*
+*               p_pool          Pointer to the pool to create.
+*
+*               p_seg           Pointer to the segment (unused, see 'lib_mem.h  Note #2').
+*
+*               blk_size        Size of each block, in octets.
+*
+*               blk_align       Required alignment of each block, in octets.
+*
+*               blk_qty_init    Number of blocks to allocate at creation.
+*
+*               blk_qty_max     Maximum number of blocks, LIB_MEM_BLK_QTY_UNLIMITED for no limit.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   LIB_MEM_ERR_NONE                Pool created.
+*                                   LIB_MEM_ERR_NULL_PTR            Argument 'p_pool' passed a NULL pointer.
+*                                   LIB_MEM_ERR_INVALID_BLK_SIZE    Argument 'blk_size' is 0.
+*                                   LIB_MEM_ERR_SEG_OVF             Heap exhausted.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) Blocks are cleared when allocated from the heap, like a segment block (see Mem_SegAllocExt()
+*                   Note #1).
+*********************************************************************************************************
+*/
+
+void  Mem_DynPoolCreate (const  CPU_CHAR      *p_name,
+                                MEM_DYN_POOL  *p_pool,
+                                MEM_SEG       *p_seg,
+                                CPU_SIZE_T     blk_size,
+                                CPU_SIZE_T     blk_align,
+                                CPU_SIZE_T     blk_qty_init,
+                                CPU_SIZE_T     blk_qty_max,
+                                LIB_ERR       *p_err)
+{
+    MEM_DYN_POOL_BLK  *p_blk;
+    CPU_SIZE_T         ix;
+
+
+    (void)p_seg;
+
+    if (p_pool == DEF_NULL) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+    if (blk_size == 0u) {
+       *p_err = LIB_MEM_ERR_INVALID_BLK_SIZE;
+        return;
+    }
+
+    p_pool->NamePtr        = p_name;
+    p_pool->BlkFreeListPtr = DEF_NULL;
+    p_pool->BlkSize        = DEF_MAX(blk_size,  sizeof(MEM_DYN_POOL_BLK));
+    p_pool->BlkAlign       = DEF_MAX(blk_align, sizeof(CPU_ALIGN));
+    p_pool->BlkQtyMax      = blk_qty_max;
+    p_pool->BlkAllocCnt    = 0u;
+
+    for (ix = 0u; ix < blk_qty_init; ix++) {
+        p_blk = (MEM_DYN_POOL_BLK *)Mem_HeapAlloc(p_pool->BlkSize, p_pool->BlkAlign);
+        if (p_blk == DEF_NULL) {
+           *p_err = LIB_MEM_ERR_SEG_OVF;
+            return;
+        }
+        Mem_Clr(p_blk, p_pool->BlkSize);                        /* See Note #1.                                         */
+        p_blk->NextPtr         = (MEM_DYN_POOL_BLK *)p_pool->BlkFreeListPtr;
+        p_pool->BlkFreeListPtr = p_blk;
+        p_pool->BlkAllocCnt++;
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         Mem_DynPoolBlkGet()
+*
+* Description : Get a block from a dynamic memory pool.
+*
+* Argument(s) : p_pool      Pointer to the pool.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Block returned.
+*                               LIB_MEM_ERR_POOL_EMPTY      Pool reached its maximum number of blocks.
+*                               LIB_MEM_ERR_SEG_OVF         Heap exhausted.
+*
+* Return(s)   : Pointer to the block, if NO error(s).
+*
+*               DEF_NULL,             otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) A block allocated from the heap is cleared (see Mem_DynPoolCreate() Note #1). A block taken
+*                   back from the free list keeps the content it was freed with.
+*********************************************************************************************************
+*/
+
+void  *Mem_DynPoolBlkGet (MEM_DYN_POOL  *p_pool,
+                          LIB_ERR       *p_err)
+{
+    MEM_DYN_POOL_BLK  *p_blk;
+    CPU_BOOLEAN        alloc;
+    CPU_SR_ALLOC();
+
+
+    alloc = DEF_NO;
+    CPU_CRITICAL_ENTER();
+    p_blk = (MEM_DYN_POOL_BLK *)p_pool->BlkFreeListPtr;
+    if (p_blk != DEF_NULL) {
+        p_pool->BlkFreeListPtr = p_blk->NextPtr;
+    } else if ((p_pool->BlkQtyMax   == LIB_MEM_BLK_QTY_UNLIMITED) ||
+               (p_pool->BlkAllocCnt <  p_pool->BlkQtyMax)) {
+        p_pool->BlkAllocCnt++;
+        alloc = DEF_YES;
+    }
+    CPU_CRITICAL_EXIT();
+
+    if (alloc == DEF_YES) {
+        p_blk = (MEM_DYN_POOL_BLK *)Mem_HeapAlloc(p_pool->BlkSize, p_pool->BlkAlign);
+        if (p_blk == DEF_NULL) {
+            CPU_CRITICAL_ENTER();
+            p_pool->BlkAllocCnt--;
+            CPU_CRITICAL_EXIT();
+           *p_err = LIB_MEM_ERR_SEG_OVF;
+            return (DEF_NULL);
+        }
+        Mem_Clr(p_blk, p_pool->BlkSize);                        /* See Note #1.                                         */
+    }
+
+    if (p_blk == DEF_NULL) {
+       *p_err = LIB_MEM_ERR_POOL_EMPTY;
+        return (DEF_NULL);
+    }
+
+   *p_err = LIB_MEM_ERR_NONE;
+
+    return (p_blk);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Mem_DynPoolBlkFree()
+*
+* Description : Return a block to a dynamic memory pool.
+*
+* Argument(s) : p_pool      Pointer to the pool.
+*
+*               p_blk       Pointer to the block, obtained from Mem_DynPoolBlkGet() on the same pool.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Block freed.
+*                               LIB_MEM_ERR_NULL_PTR        Argument 'p_blk' passed a NULL pointer.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  Mem_DynPoolBlkFree (MEM_DYN_POOL  *p_pool,
+                          void          *p_blk,
+                          LIB_ERR       *p_err)
+{
+    MEM_DYN_POOL_BLK  *p_free;
+    CPU_SR_ALLOC();
+
+
+    if (p_blk == DEF_NULL) {
+       *p_err = LIB_MEM_ERR_NULL_PTR;
+        return;
+    }
+
+    p_free = (MEM_DYN_POOL_BLK *)p_blk;
+
+    CPU_CRITICAL_ENTER();
+    p_free->NextPtr        = (MEM_DYN_POOL_BLK *)p_pool->BlkFreeListPtr;
+    p_pool->BlkFreeListPtr =  p_free;
+    CPU_CRITICAL_EXIT();
+
+   *p_err = LIB_MEM_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                     Mem_DynPoolBlkNbrAvailGet()
+*
+* Description : Get the number of blocks that can still be obtained from a dynamic memory pool.
+*
+* Argument(s) : p_pool      Pointer to the pool.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               LIB_MEM_ERR_NONE            Number returned.
+*
+* Return(s)   : Number of available blocks, DEF_INT_32U_MAX_VAL for an unlimited pool.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Mem_DynPoolBlkNbrAvailGet (MEM_DYN_POOL  *p_pool,
+                                       LIB_ERR       *p_err)
+{
+    MEM_DYN_POOL_BLK  *p_blk;
+    CPU_SIZE_T         nbr;
+    CPU_SR_ALLOC();
+
+
+   *p_err = LIB_MEM_ERR_NONE;
+    if (p_pool->BlkQtyMax == LIB_MEM_BLK_QTY_UNLIMITED) {
+        return (DEF_INT_32U_MAX_VAL);
+    }
+
+    CPU_CRITICAL_ENTER();
+    nbr   = p_pool->BlkQtyMax - p_pool->BlkAllocCnt;
+    p_blk = (MEM_DYN_POOL_BLK *)p_pool->BlkFreeListPtr;
+    while (p_blk != DEF_NULL) {
+        nbr++;
+        p_blk = p_blk->NextPtr;
+    }
+    CPU_CRITICAL_EXIT();
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Str_Len()
+*
+* Description : Get the length of a string.
+*
+* Argument(s) : p_str       Pointer to the string.
+*
+* Return(s)   : Length of the string, 0 if 'p_str' is a NULL pointer.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Str_Len (const  CPU_CHAR  *p_str)
+{
+    return (Str_Len_N(p_str, DEF_STR_MAX_LEN));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_Len_N()
+*
+* Description : Get the length of a string, up to a maximum.
+*
+* Argument(s) : p_str       Pointer to the string.
+*
+*               len_max     Maximum length to return.
+*
+* Return(s)   : Length of the string, or 'len_max' if the string is longer.
+*
+* Caller(s)   : Str_Len(),
+*               Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_SIZE_T  Str_Len_N (const  CPU_CHAR    *p_str,
+                              CPU_SIZE_T   len_max)
+{
+    CPU_SIZE_T  len;
+
+
+    if (p_str == DEF_NULL) {
+        return (0u);
+    }
+
+    len = 0u;
+    while ((len           < len_max) &&
+           (p_str[len] != ASCII_CHAR_NULL)) {
+        len++;
+    }
+
+    return (len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Str_Copy()
+*
+* Description : Copy a string.
+*
+* Argument(s) : p_str_dest  Pointer to the destination buffer.
+*
+*               p_str_src   Pointer to the source string.
+*
+* Return(s)   : Pointer to the destination, if NO error(s).
+*
+*               DEF_NULL,                   otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Copy (       CPU_CHAR  *p_str_dest,
+                     const  CPU_CHAR  *p_str_src)
+{
+    return (Str_Copy_N(p_str_dest, p_str_src, DEF_STR_MAX_LEN));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_Copy_N()
+*
+* Description : Copy a string, up to a maximum number of characters.
+*
+* Argument(s) : p_str_dest  Pointer to the destination buffer.
+*
+*               p_str_src   Pointer to the source string.
+*
+*               len_max     Maximum number of characters to copy.
+*
+* Return(s)   : Pointer to the destination, if NO error(s).
+*
+*               DEF_NULL,                   otherwise.
+*
+* Caller(s)   : Str_Copy(),
+*               Various.
+*
+* Note(s)     : (1) As w/ uC/LIB, the destination is NOT terminated if the source holds 'len_max' or more
+*                   characters.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Copy_N (       CPU_CHAR    *p_str_dest,
+                       const  CPU_CHAR    *p_str_src,
+                              CPU_SIZE_T   len_max)
+{
+    CPU_SIZE_T  len;
+
+
+    if ((p_str_dest == DEF_NULL) ||
+        (p_str_src  == DEF_NULL)) {
+        return (DEF_NULL);
+    }
+
+    len = 0u;
+    while ((len                < len_max) &&
+           (p_str_src[len] != ASCII_CHAR_NULL)) {
+        p_str_dest[len] = p_str_src[len];
+        len++;
+    }
+
+    if (len < len_max) {                                        /* See Note #1.                                         */
+        p_str_dest[len] = ASCII_CHAR_NULL;
+    }
+
+    return (p_str_dest);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Str_Cat()
+*
+* Description : Append a string to another.
+*
+* Argument(s) : p_str_dest  Pointer to the destination string.
+*
+*               p_str_cat   Pointer to the string to append.
+*
+* Return(s)   : Pointer to the destination, if NO error(s).
+*
+*               DEF_NULL,                   otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Cat (       CPU_CHAR  *p_str_dest,
+                    const  CPU_CHAR  *p_str_cat)
+{
+    return (Str_Cat_N(p_str_dest, p_str_cat, DEF_STR_MAX_LEN));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_Cat_N()
+*
+* Description : Append a string to another, up to a maximum number of characters.
+*
+* Argument(s) : p_str_dest  Pointer to the destination string.
+*
+*               p_str_cat   Pointer to the string to append.
+*
+*               len_max     Maximum number of characters to append.
+*
+* Return(s)   : Pointer to the destination, if NO error(s).
+*
+*               DEF_NULL,                   otherwise.
+*
+* Caller(s)   : Str_Cat(),
+*               Various.
+*
+* Note(s)     : (1) As w/ uC/LIB, the destination is always terminated; the buffer MUST hold 'len_max' + 1
+*                   more characters.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Cat_N (       CPU_CHAR    *p_str_dest,
+                      const  CPU_CHAR    *p_str_cat,
+                             CPU_SIZE_T   len_max)
+{
+    CPU_CHAR    *p_str;
+    CPU_SIZE_T   len;
+
+
+    if ((p_str_dest == DEF_NULL) ||
+        (p_str_cat  == DEF_NULL)) {
+        return (DEF_NULL);
+    }
+
+    p_str = p_str_dest + Str_Len(p_str_dest);
+    len   = 0u;
+    while ((len                < len_max) &&
+           (p_str_cat[len] != ASCII_CHAR_NULL)) {
+        p_str[len] = p_str_cat[len];
+        len++;
+    }
+    p_str[len] = ASCII_CHAR_NULL;                               /* See Note #1.                                         */
+
+    return (p_str_dest);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Str_Cmp()
+*
+* Description : Compare two strings.
+*
+* Argument(s) : p1_str      Pointer to the first  string.
+*
+*               p2_str      Pointer to the second string.
+*
+* Return(s)   : 0, if the strings are identical; difference of the first mismatching characters otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT16S  Str_Cmp (const  CPU_CHAR  *p1_str,
+                     const  CPU_CHAR  *p2_str)
+{
+    return (Str_Cmp_N(p1_str, p2_str, DEF_STR_MAX_LEN));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_Cmp_N()
+*
+* Description : Compare two strings, up to a maximum number of characters.
+*
+* Argument(s) : p1_str      Pointer to the first  string.
+*
+*               p2_str      Pointer to the second string.
+*
+*               len_max     Maximum number of characters to compare.
+*
+* Return(s)   : 0, if the strings are identical; difference of the first mismatching characters otherwise.
+*
+* Caller(s)   : Str_Cmp(),
+*               Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT16S  Str_Cmp_N (const  CPU_CHAR    *p1_str,
+                       const  CPU_CHAR    *p2_str,
+                              CPU_SIZE_T   len_max)
+{
+    CPU_SIZE_T  ix;
+
+
+    for (ix = 0u; ix < len_max; ix++) {
+        if (p1_str[ix] != p2_str[ix]) {
+            return ((CPU_INT16S)((CPU_INT16S)(unsigned char)p1_str[ix] - (CPU_INT16S)(unsigned char)p2_str[ix]));
+        }
+        if (p1_str[ix] == ASCII_CHAR_NULL) {
+            break;
+        }
+    }
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Str_CmpIgnoreCase_N()
+*
+* Description : Compare two strings, ignoring case, up to a maximum number of characters.
+*
+* Argument(s) : p1_str      Pointer to the first  string.
+*
+*               p2_str      Pointer to the second string.
+*
+*               len_max     Maximum number of characters to compare.
+*
+* Return(s)   : 0, if the strings are identical; difference of the first mismatching characters otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT16S  Str_CmpIgnoreCase_N (const  CPU_CHAR    *p1_str,
+                                 const  CPU_CHAR    *p2_str,
+                                        CPU_SIZE_T   len_max)
+{
+    CPU_SIZE_T  ix;
+    CPU_CHAR    c1;
+    CPU_CHAR    c2;
+
+
+    for (ix = 0u; ix < len_max; ix++) {
+        c1 = ASCII_ToLower(p1_str[ix]);
+        c2 = ASCII_ToLower(p2_str[ix]);
+        if (c1 != c2) {
+            return ((CPU_INT16S)((CPU_INT16S)(unsigned char)c1 - (CPU_INT16S)(unsigned char)c2));
+        }
+        if (c1 == ASCII_CHAR_NULL) {
+            break;
+        }
+    }
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                             Str_Char()
+*
+* Description : Search a string for a character.
+*
+* Argument(s) : p_str       Pointer to the string.
+*
+*               srch_char   Character to search for.
+*
+* Return(s)   : Pointer to the first occurrence of the character, if found.
+*
+*               DEF_NULL,                                         otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Char (const  CPU_CHAR  *p_str,
+                            CPU_CHAR   srch_char)
+{
+    return (Str_Char_N(p_str, DEF_STR_MAX_LEN, srch_char));
+}
+
+
+/*
+*********************************************************************************************************
+*                                            Str_Char_N()
+*
+* Description : Search a string for a character, up to a maximum number of characters.
+*
+* Argument(s) : p_str       Pointer to the string.
+*
+*               len_max     Maximum number of characters to search.
+*
+*               srch_char   Character to search for.
+*
+* Return(s)   : Pointer to the first occurrence of the character, if found.
+*
+*               DEF_NULL,                                         otherwise.
+*
+* Caller(s)   : Str_Char(),
+*               Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_Char_N (const  CPU_CHAR    *p_str,
+                              CPU_SIZE_T   len_max,
+                              CPU_CHAR     srch_char)
+{
+    CPU_SIZE_T  ix;
+
+
+    if (p_str == DEF_NULL) {
+        return (DEF_NULL);
+    }
+
+    for (ix = 0u; ix < len_max; ix++) {
+        if (p_str[ix] == srch_char) {
+            return ((CPU_CHAR *)&p_str[ix]);
+        }
+        if (p_str[ix] == ASCII_CHAR_NULL) {
+            break;
+        }
+    }
+
+    return (DEF_NULL);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        Str_FmtNbr_Int32U()
+*
+* Description : Format an unsigned integer into a string.
+*
+* Argument(s) : nbr         Number to format.
+*
+*               nbr_dig     Number of digits to format.
+*
+*               nbr_base    Base of the number (2 to 36).
+*
+*               lead_char   Character prepended up to 'nbr_dig' digits, ASCII_CHAR_NULL for none.
+*
+*               lower_case  DEF_YES to format alphabetic digits in lower case.
+*
+*               nul         DEF_YES to terminate the string.
+*
+*               p_str       Pointer to the buffer that will receive the string.
+*
+* Return(s)   : Pointer to the string, if NO error(s).
+*
+*               DEF_NULL,              otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : (1) As w/ uC/LIB, a number w/ more significant digits than 'nbr_dig' is formatted as
+*                   'nbr_dig' '?' characters rather than truncated.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  *Str_FmtNbr_Int32U (CPU_INT32U    nbr,
+                              CPU_INT08U    nbr_dig,
+                              CPU_INT08U    nbr_base,
+                              CPU_CHAR      lead_char,
+                              CPU_BOOLEAN   lower_case,
+                              CPU_BOOLEAN   nul,
+                              CPU_CHAR     *p_str)
+{
+    CPU_CHAR     digits[DEF_INT_32_NBR_BITS];
+    CPU_INT08U   dig_nbr;
+    CPU_INT08U   ix;
+    CPU_INT08U   val;
+    CPU_CHAR    *p_char;
+
+
+    if ((p_str    == DEF_NULL) ||
+        (nbr_base <  DEF_NBR_BASE_BIN) ||
+        (nbr_base >  36u)) {
+        return (DEF_NULL);
+    }
+
+    dig_nbr = 0u;
+    do {
+        val              = (CPU_INT08U)(nbr % nbr_base);
+        digits[dig_nbr]  = (val < 10u) ? (CPU_CHAR)('0' + val)
+                                       : (CPU_CHAR)(((lower_case == DEF_YES) ? 'a' : 'A') + (val - 10u));
+        nbr             /=  nbr_base;
+        dig_nbr++;
+    } while (nbr > 0u);
+
+    p_char = p_str;
+    if (dig_nbr > nbr_dig) {                                    /* See Note #1.                                         */
+        for (ix = 0u; ix < nbr_dig; ix++) {
+           *p_char++ = '?';
+        }
+    } else {
+        if (lead_char != ASCII_CHAR_NULL) {
+            for (ix = dig_nbr; ix < nbr_dig; ix++) {
+               *p_char++ = lead_char;
+            }
+        }
+        while (dig_nbr > 0u) {
+            dig_nbr--;
+           *p_char++ = digits[dig_nbr];
+        }
+    }
+
+    if (nul == DEF_YES) {
+       *p_char = ASCII_CHAR_NULL;
+    }
+
+    return (p_str);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       Str_ParseNbr_Int32U()
+*
+* Description : Parse an unsigned integer from a string.
+*
+* Argument(s) : p_str       Pointer to the string.
+*
+*               p_str_next  Pointer to variable that will receive a pointer past the parsed characters
+*                           (optional).
+*
+*               nbr_base    Base of the number, 0 to detect it from its prefix.
+*
+* Return(s)   : Parsed number, 0 if none.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  Str_ParseNbr_Int32U (const  CPU_CHAR     *p_str,
+                                        CPU_CHAR    **p_str_next,
+                                        CPU_INT08U    nbr_base)
+{
+    unsigned long  nbr;
+
+
+    nbr = strtoul(p_str, p_str_next, nbr_base);
+    if (nbr > DEF_INT_32U_MAX_VAL) {
+        nbr = DEF_INT_32U_MAX_VAL;
+    }
+
+    return ((CPU_INT32U)nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         ASCII_IsAlphaNum()
+*
+* Description : Determine whether a character is alphanumeric.
+*
+* Argument(s) : c           Character to examine.
+*
+* Return(s)   : DEF_YES, if the character is alphanumeric.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  ASCII_IsAlphaNum (CPU_CHAR  c)
+{
+    if (ASCII_IsDig(c) == DEF_YES) {
+        return (DEF_YES);
+    }
+
+    return ((((c >= 'a') && (c <= 'z')) ||
+             ((c >= 'A') && (c <= 'Z'))) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           ASCII_IsDig()
+*
+* Description : Determine whether a character is a decimal digit.
+*
+* Argument(s) : c           Character to examine.
+*
+* Return(s)   : DEF_YES, if the character is a decimal digit.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  ASCII_IsDig (CPU_CHAR  c)
+{
+    return (((c >= '0') && (c <= '9')) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           ASCII_IsCtrl()
+*
+* Description : Determine whether a character is a control character.
+*
+* Argument(s) : c           Character to examine.
+*
+* Return(s)   : DEF_YES, if the character is a control character.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  ASCII_IsCtrl (CPU_CHAR  c)
+{
+    return (((((unsigned char)c) < 0x20u) || (((unsigned char)c) == 0x7Fu)) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           ASCII_IsSpace()
+*
+* Description : Determine whether a character is a white-space character.
+*
+* Argument(s) : c           Character to examine.
+*
+* Return(s)   : DEF_YES, if the character is a white-space character.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  ASCII_IsSpace (CPU_CHAR  c)
+{
+    return (((c == ASCII_CHAR_SPACE) || ((c >= ASCII_CHAR_CHARACTER_TABULATION) && (c <= ASCII_CHAR_CARRIAGE_RETURN))) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           ASCII_ToLower()
+*
+* Description : Convert a character to lower case.
+*
+* Argument(s) : c           Character to convert.
+*
+* Return(s)   : Lower case character, or 'c' if it is not an upper case letter.
+*
+* Caller(s)   : Str_CmpIgnoreCase_N(),
+*               ASCII_CmpIgnoreCase(),
+*               Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_CHAR  ASCII_ToLower (CPU_CHAR  c)
+{
+    if ((c >= 'A') && (c <= 'Z')) {
+        return ((CPU_CHAR)(c + ('a' - 'A')));
+    }
+
+    return (c);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        ASCII_CmpIgnoreCase()
+*
+* Description : Compare two characters, ignoring case.
+*
+* Argument(s) : c1          First  character.
+*
+*               c2          Second character.
+*
+* Return(s)   : DEF_YES, if the characters are identical.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : Various.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  ASCII_CmpIgnoreCase (CPU_CHAR  c1,
+                                  CPU_CHAR  c2)
+{
+    return ((ASCII_ToLower(c1) == ASCII_ToLower(c2)) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         CPU_CriticalInit()
+*
+* Description : Create the recursive mutex used by critical sections.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : CPU_CriticalEnter(), via pthread_once().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  CPU_CriticalInit (void)
+{
+    pthread_mutexattr_t  attr;
+
+
+    (void)pthread_mutexattr_init(&attr);
+    (void)pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE);
+    (void)pthread_mutex_init(&CPU_CriticalMutex, &attr);
+    (void)pthread_mutexattr_destroy(&attr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           Mem_HeapAlloc()
+*
+* Description : Allocate an aligned block from the C heap.
+*
+* Argument(s) : size        Size of the block, in octets.
+*
+*               align       Required alignment, in octets.
+*
+* Return(s)   : Pointer to the block, if NO error(s).
+*
+*               DEF_NULL,             otherwise.
+*
+* Caller(s)   : Mem_SegAllocExt(),
+*               Mem_DynPoolCreate(),
+*               Mem_DynPoolBlkGet().
+*
+* Note(s)     : (1) posix_memalign() requires a power of two multiple of 'sizeof(void *)'.
+*********************************************************************************************************
+*/
+
+static  void  *Mem_HeapAlloc (CPU_SIZE_T  size,
+                              CPU_SIZE_T  align)
+{
+    void        *p_blk;
+    CPU_SIZE_T   align_pow2;
+
+
+    align_pow2 = sizeof(void *);                                /* See Note #1.                                         */
+    while (align_pow2 < align) {
+        align_pow2 <<= 1u;
+    }
+
+    if (posix_memalign(&p_blk, align_pow2, DEF_MAX(size, 1u)) != 0) {
+        return (DEF_NULL);
+    }
+
+    return (p_blk);
+}
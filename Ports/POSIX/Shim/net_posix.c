@@ -0,0 +1,1036 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                     uC/TCP-IP REPLACEMENT
+*
+* Filename : net_posix.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) Implements the subset of uC/TCP-IP used by DNSc over POSIX UDP sockets.
+*
+*            (2) The host's errors are mapped on the uC/TCP-IP errors DNSc handles :
+*
+*                (a) A transmit that would block is a transitory NET_ERR_TX, which DNSc retries.
+*
+*                (b) A receive w/ nothing queued is NET_SOCK_ERR_RX_Q_EMPTY.
+*
+*                (c) ECONNREFUSED, reported on a connected UDP socket after an ICMP port unreachable, is
+*                    ignored as uC/TCP-IP does not report it either.
+*
+*            (3) Defining NET_POSIX_SOCK_EXT removes the socket functions, so that a driver can provide its
+*                own, e.g. the simulator of 'Sim/dns-c_sim.c' which exchanges messages w/o a host socket.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  700
+
+#include  <errno.h>
+#include  <stdio.h>
+#include  <time.h>
+#include  <unistd.h>
+#include  <arpa/inet.h>
+#include  <netinet/in.h>
+#include  <sys/socket.h>
+
+#include  <Source/net.h>
+#include  <IP/IPv4/net_ipv4.h>
+#include  <IP/IPv6/net_ipv6.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  NET_POSIX_IPv4_ADDR_HOST                 0xC0000201u   /* 192.0.2.1 (see NetIPv4_GetAddrHost() Note #1).       */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+const  NET_IPv6_ADDR  NET_IPv6_ADDR_ANY = { { 0u } };
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  volatile  NET_IF_LINK_STATE  NetIF_LinkState = NET_IF_LINK_UP;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  NET_POSIX_SOCK_EXT
+static  socklen_t  NetSock_AddrToHost(const  NET_SOCK_ADDR            *p_addr,
+                                             struct  sockaddr_storage *p_addr_host);
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          SOCKET FUNCTIONS
+*
+* Note(s) : (1) See 'net_posix.c  Note #3'.
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  NET_POSIX_SOCK_EXT
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Open()
+*
+* Description : Open a socket.
+*
+* Argument(s) : protocol_family     Protocol family, NET_SOCK_PROTOCOL_FAMILY_IP_V4 or _IP_V6.
+*
+*               sock_type           Socket type, NET_SOCK_TYPE_DATAGRAM.
+*
+*               protocol            Protocol, NET_SOCK_PROTOCOL_UDP.
+*
+*               p_err               Pointer to variable that will receive the return error code from this function :
+*
+*                                       NET_SOCK_ERR_NONE               Socket opened.
+*                                       NET_SOCK_ERR_INVALID_FAMILY     Unsupported family, type or protocol.
+*                                       NET_SOCK_ERR_NONE_AVAIL         Host could not open a socket.
+*
+* Return(s)   : Socket ID, if NO error(s).
+*
+*               NET_SOCK_ID_NONE, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+NET_SOCK_ID  NetSock_Open (NET_SOCK_PROTOCOL_FAMILY   protocol_family,
+                           NET_SOCK_TYPE              sock_type,
+                           NET_SOCK_PROTOCOL          protocol,
+                           NET_ERR                   *p_err)
+{
+    int  domain;
+    int  fd;
+
+
+    switch (protocol_family) {
+        case NET_SOCK_PROTOCOL_FAMILY_IP_V4:
+             domain = AF_INET;
+             break;
+
+        case NET_SOCK_PROTOCOL_FAMILY_IP_V6:
+             domain = AF_INET6;
+             break;
+
+        default:
+            *p_err = NET_SOCK_ERR_INVALID_FAMILY;
+             return (NET_SOCK_ID_NONE);
+    }
+
+    if ((sock_type != NET_SOCK_TYPE_DATAGRAM) ||
+        (protocol  != NET_SOCK_PROTOCOL_UDP)) {
+       *p_err = NET_SOCK_ERR_INVALID_FAMILY;
+        return (NET_SOCK_ID_NONE);
+    }
+
+    fd = socket(domain, SOCK_DGRAM, IPPROTO_UDP);
+    if ((fd < 0) ||
+        (fd > INT16_MAX)) {
+        if (fd >= 0) {
+            (void)close(fd);
+        }
+       *p_err = NET_SOCK_ERR_NONE_AVAIL;
+        return (NET_SOCK_ID_NONE);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return ((NET_SOCK_ID)fd);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Close()
+*
+* Description : Close a socket.
+*
+* Argument(s) : sock_id     Socket ID.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket closed.
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket ID.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  NetSock_Close (NET_SOCK_ID   sock_id,
+                     NET_ERR      *p_err)
+{
+   *p_err = (close(sock_id) == 0) ? NET_SOCK_ERR_NONE : NET_SOCK_ERR_INVALID_SOCK;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Bind()
+*
+* Description : Bind a socket to a local address.
+*
+* Argument(s) : sock_id         Socket ID.
+*
+*               p_addr_local    Pointer to the local socket address.
+*
+*               addr_len        Length of the socket address (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Socket bound.
+*                                   NET_SOCK_ERR_INVALID_ADDR       Address could not be bound.
+*
+* Return(s)   : 0, if NO error(s); -1 otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_Bind (NET_SOCK_ID         sock_id,
+                          NET_SOCK_ADDR      *p_addr_local,
+                          NET_SOCK_ADDR_LEN   addr_len,
+                          NET_ERR            *p_err)
+{
+    struct  sockaddr_storage  addr;
+    socklen_t                 len;
+
+
+    (void)addr_len;
+
+    len = NetSock_AddrToHost(p_addr_local, &addr);
+    if ((len == 0u) ||
+        (bind(sock_id, (struct sockaddr *)&addr, len) != 0)) {
+       *p_err = NET_SOCK_ERR_INVALID_ADDR;
+        return (-1);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Conn()
+*
+* Description : Connect a socket to a remote address.
+*
+* Argument(s) : sock_id         Socket ID.
+*
+*               p_addr_remote   Pointer to the remote socket address.
+*
+*               addr_len        Length of the socket address (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Socket connected.
+*                                   NET_SOCK_ERR_CONN_FAIL          Socket could not be connected.
+*
+* Return(s)   : 0, if NO error(s); -1 otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_Conn (NET_SOCK_ID         sock_id,
+                          NET_SOCK_ADDR      *p_addr_remote,
+                          NET_SOCK_ADDR_LEN   addr_len,
+                          NET_ERR            *p_err)
+{
+    struct  sockaddr_storage  addr;
+    socklen_t                 len;
+
+
+    (void)addr_len;
+
+    len = NetSock_AddrToHost(p_addr_remote, &addr);
+    if ((len == 0u) ||
+        (connect(sock_id, (struct sockaddr *)&addr, len) != 0)) {
+       *p_err = NET_SOCK_ERR_CONN_FAIL;
+        return (-1);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_TxData()
+*
+* Description : Transmit data on a connected socket.
+*
+* Argument(s) : sock_id     Socket ID.
+*
+*               p_data      Pointer to the data to transmit.
+*
+*               data_len    Length of the data, in octets.
+*
+*               flags       NET_SOCK_FLAG_TX_NO_BLOCK not to block.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Data transmitted.
+*                               NET_ERR_TX                      Transitory error, retry (see Note #2a).
+*                               NET_ERR_IF_LINK_DOWN            Interface link down.
+*                               NET_SOCK_ERR_INVALID_SOCK       Fatal socket error.
+*
+* Return(s)   : Number of octets transmitted, if NO error(s); 0 otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_TxData (NET_SOCK_ID          sock_id,
+                            void                *p_data,
+                            CPU_INT16U           data_len,
+                            NET_SOCK_API_FLAGS   flags,
+                            NET_ERR             *p_err)
+{
+    ssize_t  len;
+    int      host_flags = 0;
+
+
+    if (NetIF_LinkState != NET_IF_LINK_UP) {
+       *p_err = NET_ERR_IF_LINK_DOWN;
+        return (0);
+    }
+
+    if (DEF_BIT_IS_SET(flags, NET_SOCK_FLAG_TX_NO_BLOCK) == DEF_YES) {
+        host_flags = MSG_DONTWAIT;
+    }
+
+    len = send(sock_id, p_data, data_len, host_flags);
+    if (len < 0) {
+        switch (errno) {
+            case EAGAIN:
+            case EINTR:
+            case ENOBUFS:
+            case ECONNREFUSED:                                  /* See 'net_posix.c  Note #2c'.                         */
+                *p_err = NET_ERR_TX;
+                 break;
+
+            case ENETDOWN:
+            case ENETUNREACH:
+                *p_err = NET_ERR_IF_LINK_DOWN;
+                 break;
+
+            default:
+                *p_err = NET_SOCK_ERR_INVALID_SOCK;
+                 break;
+        }
+        return (0);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return ((CPU_INT32S)len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_RxData()
+*
+* Description : Receive data from a connected socket.
+*
+* Argument(s) : sock_id         Socket ID.
+*
+*               p_data_buf      Pointer to the buffer that will receive the data.
+*
+*               data_buf_len    Size of the buffer, in octets.
+*
+*               flags           NET_SOCK_FLAG_RX_NO_BLOCK not to block.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Data received.
+*                                   NET_SOCK_ERR_RX_Q_EMPTY         Nothing received (see Note #2b).
+*                                   NET_SOCK_ERR_INVALID_SOCK       Fatal socket error.
+*
+* Return(s)   : Number of octets received, if NO error(s); 0 otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_RxData (NET_SOCK_ID          sock_id,
+                            void                *p_data_buf,
+                            CPU_INT16U           data_buf_len,
+                            NET_SOCK_API_FLAGS   flags,
+                            NET_ERR             *p_err)
+{
+    ssize_t  len;
+    int      host_flags = 0;
+
+
+    if (DEF_BIT_IS_SET(flags, NET_SOCK_FLAG_RX_NO_BLOCK) == DEF_YES) {
+        host_flags = MSG_DONTWAIT;
+    }
+
+    len = recv(sock_id, p_data_buf, data_buf_len, host_flags);
+    if (len < 0) {
+        switch (errno) {
+            case EAGAIN:
+            case EINTR:
+            case ECONNREFUSED:                                  /* See 'net_posix.c  Note #2c'.                         */
+                *p_err = NET_SOCK_ERR_RX_Q_EMPTY;
+                 break;
+
+            default:
+                *p_err = NET_SOCK_ERR_INVALID_SOCK;
+                 break;
+        }
+        return (0);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return ((CPU_INT32S)len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_CfgIF()
+*
+* Description : Configure the interface a socket uses.
+*
+* Argument(s) : sock_id     Socket ID (unused).
+*
+*               if_nbr      Interface number.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Interface configured.
+*                               NET_ERR_INVALID_ADDR            Unknown interface.
+*
+* Return(s)   : DEF_OK, if NO error(s); DEF_FAIL otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The host's routing table selects the interface; see 'IF/net_if.h  Note #1'.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetSock_CfgIF (NET_SOCK_ID   sock_id,
+                            NET_IF_NBR    if_nbr,
+                            NET_ERR      *p_err)
+{
+    (void)sock_id;
+
+    if (if_nbr != NET_IF_NBR_BASE_CFGD) {
+       *p_err = NET_ERR_INVALID_ADDR;
+        return (DEF_FAIL);
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (DEF_OK);
+}
+#endif  /* NET_POSIX_SOCK_EXT */
+
+
+/*
+*********************************************************************************************************
+*                                        NetApp_SetSockAddr()
+*
+* Description : Set a socket address.
+*
+* Argument(s) : p_sock_addr     Pointer to the socket address to set.
+*
+*               addr_family     Address family, NET_SOCK_ADDR_FAMILY_IP_V4 or _IP_V6.
+*
+*               port_nbr        Port number, in host order.
+*
+*               p_addr          Pointer to the IP address, in network order.
+*
+*               addr_len        Length of the IP address, in octets.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_APP_ERR_NONE                Address set.
+*                                   NET_ERR_INVALID_ADDR            Invalid family or address length.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  NetApp_SetSockAddr (NET_SOCK_ADDR         *p_sock_addr,
+                          NET_SOCK_ADDR_FAMILY   addr_family,
+                          NET_PORT_NBR           port_nbr,
+                          CPU_INT08U            *p_addr,
+                          NET_SOCK_ADDR_LEN      addr_len,
+                          NET_ERR               *p_err)
+{
+    if (((addr_family == NET_SOCK_ADDR_FAMILY_IP_V4) && (addr_len != NET_IPv4_ADDR_SIZE)) ||
+        ((addr_family == NET_SOCK_ADDR_FAMILY_IP_V6) && (addr_len != NET_IPv6_ADDR_SIZE)) ||
+        ((addr_family != NET_SOCK_ADDR_FAMILY_IP_V4) && (addr_family != NET_SOCK_ADDR_FAMILY_IP_V6))) {
+       *p_err = NET_ERR_INVALID_ADDR;
+        return;
+    }
+
+    Mem_Clr(p_sock_addr, sizeof(NET_SOCK_ADDR));
+    p_sock_addr->AddrFamily = addr_family;
+    p_sock_addr->Port       = NET_UTIL_HOST_TO_NET_16(port_nbr);
+    Mem_Copy(p_sock_addr->Addr, p_addr, addr_len);
+
+   *p_err = NET_APP_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetASCII_Str_to_IP()
+*
+* Description : Convert an IPv4 or IPv6 address string to an address.
+*
+* Argument(s) : p_addr_ip_str   Pointer to the address string.
+*
+*               p_addr          Pointer to the buffer that will receive the address, in network order.
+*
+*               addr_max_len    Size of the buffer, in octets.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_ASCII_ERR_NONE                      Address converted.
+*                                   NET_ASCII_ERR_NULL_PTR                  NULL pointer argument.
+*                                   NET_ASCII_ERR_INVALID_STR_LEN           Buffer too small.
+*                                   NET_ASCII_ERR_INVALID_CHAR_VAL          Not an address string.
+*                                   NET_ASCII_ERR_IP_FAMILY_NOT_PRESENT     Address family disabled.
+*
+* Return(s)   : Address family, NET_IP_ADDR_FAMILY_UNKNOWN on error.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) See 'net_ascii.h  Note #2a'.
+*********************************************************************************************************
+*/
+
+NET_IP_ADDR_FAMILY  NetASCII_Str_to_IP (CPU_CHAR    *p_addr_ip_str,
+                                        void        *p_addr,
+                                        CPU_INT08U   addr_max_len,
+                                        NET_ERR     *p_err)
+{
+    CPU_INT08U  addr[NET_IPv6_ADDR_SIZE];
+
+
+    if ((p_addr_ip_str == DEF_NULL) ||
+        (p_addr        == DEF_NULL)) {
+       *p_err = NET_ASCII_ERR_NULL_PTR;
+        return (NET_IP_ADDR_FAMILY_UNKNOWN);
+    }
+
+    if (inet_pton(AF_INET, p_addr_ip_str, addr) == 1) {
+#ifdef  NET_IPv4_MODULE_EN
+        if (addr_max_len < NET_IPv4_ADDR_SIZE) {
+           *p_err = NET_ASCII_ERR_INVALID_STR_LEN;
+            return (NET_IP_ADDR_FAMILY_UNKNOWN);
+        }
+        Mem_Copy(p_addr, addr, NET_IPv4_ADDR_SIZE);
+       *p_err = NET_ASCII_ERR_NONE;
+        return (NET_IP_ADDR_FAMILY_IPv4);
+#else
+       *p_err = NET_ASCII_ERR_IP_FAMILY_NOT_PRESENT;
+        return (NET_IP_ADDR_FAMILY_UNKNOWN);
+#endif
+    }
+
+    if (inet_pton(AF_INET6, p_addr_ip_str, addr) == 1) {
+#ifdef  NET_IPv6_MODULE_EN
+        if (addr_max_len < NET_IPv6_ADDR_SIZE) {
+           *p_err = NET_ASCII_ERR_INVALID_STR_LEN;
+            return (NET_IP_ADDR_FAMILY_UNKNOWN);
+        }
+        Mem_Copy(p_addr, addr, NET_IPv6_ADDR_SIZE);
+       *p_err = NET_ASCII_ERR_NONE;
+        return (NET_IP_ADDR_FAMILY_IPv6);
+#else
+       *p_err = NET_ASCII_ERR_IP_FAMILY_NOT_PRESENT;
+        return (NET_IP_ADDR_FAMILY_UNKNOWN);
+#endif
+    }
+
+   *p_err = NET_ASCII_ERR_INVALID_CHAR_VAL;
+
+    return (NET_IP_ADDR_FAMILY_UNKNOWN);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetASCII_IPv4_to_Str()
+*
+* Description : Convert an IPv4 address to a dotted-decimal string.
+*
+* Argument(s) : addr            IPv4 address, in host order (see 'net_ascii.h  Note #2b').
+*
+*               p_addr_ip_str   Pointer to the buffer that will receive the string; MUST hold at least
+*                               NET_ASCII_LEN_MAX_ADDR_IPv4 characters.
+*
+*               lead_zeros      DEF_YES to format every octet on three digits.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_ASCII_ERR_NONE              String formatted.
+*                                   NET_ASCII_ERR_NULL_PTR          Argument 'p_addr_ip_str' passed a NULL pointer.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  NetASCII_IPv4_to_Str (NET_IPv4_ADDR   addr,
+                            CPU_CHAR       *p_addr_ip_str,
+                            CPU_BOOLEAN     lead_zeros,
+                            NET_ERR        *p_err)
+{
+    if (p_addr_ip_str == DEF_NULL) {
+       *p_err = NET_ASCII_ERR_NULL_PTR;
+        return;
+    }
+
+    (void)snprintf(p_addr_ip_str,
+                   NET_ASCII_LEN_MAX_ADDR_IPv4,
+                   (lead_zeros == DEF_YES) ? "%03u.%03u.%03u.%03u" : "%u.%u.%u.%u",
+                   (unsigned)((addr >> 24u) & 0xFFu),
+                   (unsigned)((addr >> 16u) & 0xFFu),
+                   (unsigned)((addr >>  8u) & 0xFFu),
+                   (unsigned)( addr         & 0xFFu));
+
+   *p_err = NET_ASCII_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetASCII_IPv6_to_Str()
+*
+* Description : Convert an IPv6 address to a string.
+*
+* Argument(s) : p_addr          Pointer to the IPv6 address, in network order.
+*
+*               p_addr_ip_str   Pointer to the buffer that will receive the string; MUST hold at least
+*                               NET_ASCII_LEN_MAX_ADDR_IPv6 characters.
+*
+*               hex_lower_case  DEF_YES to format hexadecimal digits in lower case.
+*
+*               lead_zeros      Format leading zeros (unused, zeros are always compressed).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_ASCII_ERR_NONE              String formatted.
+*                                   NET_ASCII_ERR_NULL_PTR          NULL pointer argument.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  NetASCII_IPv6_to_Str (NET_IPv6_ADDR  *p_addr,
+                            CPU_CHAR       *p_addr_ip_str,
+                            CPU_BOOLEAN     hex_lower_case,
+                            CPU_BOOLEAN     lead_zeros,
+                            NET_ERR        *p_err)
+{
+    CPU_CHAR  *p_char;
+
+
+    (void)lead_zeros;
+
+    if ((p_addr        == DEF_NULL) ||
+        (p_addr_ip_str == DEF_NULL)) {
+       *p_err = NET_ASCII_ERR_NULL_PTR;
+        return;
+    }
+
+    (void)inet_ntop(AF_INET6, p_addr->Addr, p_addr_ip_str, NET_ASCII_LEN_MAX_ADDR_IPv6);
+
+    if (hex_lower_case == DEF_NO) {
+        for (p_char = p_addr_ip_str; *p_char != ASCII_CHAR_NULL; p_char++) {
+            if ((*p_char >= 'a') && (*p_char <= 'f')) {
+               *p_char = (CPU_CHAR)(*p_char - ('a' - 'A'));
+            }
+        }
+    }
+
+   *p_err = NET_ASCII_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         NetUtil_TS_Get_ms()
+*
+* Description : Get the current timestamp, in milliseconds.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Timestamp (see 'net_util.h  FUNCTION PROTOTYPES  Note #1').
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+NET_TS_MS  NetUtil_TS_Get_ms (void)
+{
+    struct  timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((NET_TS_MS)((CPU_INT64U)ts.tv_sec * DEF_TIME_NBR_mS_PER_SEC + (CPU_INT64U)ts.tv_nsec / 1000000u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIF_GetNbrBaseCfgd()
+*
+* Description : Get the number of the first configurable interface.
+*
+* Argument(s) : None.
+*
+* Return(s)   : NET_IF_NBR_BASE_CFGD.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+NET_IF_NBR  NetIF_GetNbrBaseCfgd (void)
+{
+    return (NET_IF_NBR_BASE_CFGD);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       NetIF_GetExtAvailCtr()
+*
+* Description : Get the number of the next interface that would be added.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IF_ERR_NONE     Number returned.
+*
+* Return(s)   : NET_IF_NBR_BASE_CFGD + 1, see 'IF/net_if.h  Note #1'.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+NET_IF_NBR  NetIF_GetExtAvailCtr (NET_ERR  *p_err)
+{
+   *p_err = NET_IF_ERR_NONE;
+
+    return (NET_IF_NBR_BASE_CFGD + 1u);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIF_LinkStateGet()
+*
+* Description : Get the link state of an interface.
+*
+* Argument(s) : if_nbr      Interface number.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_IF_ERR_NONE         Link state returned.
+*                               NET_ERR_INVALID_ADDR    Unknown interface.
+*
+* Return(s)   : Link state of the interface, NET_IF_LINK_DOWN for an unknown interface.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+NET_IF_LINK_STATE  NetIF_LinkStateGet (NET_IF_NBR   if_nbr,
+                                       NET_ERR     *p_err)
+{
+    if (if_nbr != NET_IF_NBR_BASE_CFGD) {
+       *p_err = NET_ERR_INVALID_ADDR;
+        return (NET_IF_LINK_DOWN);
+    }
+
+   *p_err = NET_IF_ERR_NONE;
+
+    return (NetIF_LinkState);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIF_LinkStateSet()
+*
+* Description : Set the link state of the interface.
+*
+* Argument(s) : link_state  New link state.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) While the link is down, every transmit fails w/ NET_ERR_IF_LINK_DOWN.
+*********************************************************************************************************
+*/
+
+void  NetIF_LinkStateSet (NET_IF_LINK_STATE  link_state)
+{
+    NetIF_LinkState = link_state;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIPv4_GetAddrHost()
+*
+* Description : Get the IPv4 host addresses of an interface.
+*
+* Argument(s) : if_nbr          Interface number.
+*
+*               p_addr_tbl      Pointer to the table that will receive the addresses, in host order.
+*
+*               p_addr_tbl_qty  Pointer to variable that :
+*
+*                                   (a) Passes the size of the table, in number of addresses.
+*                                   (b) Returns the number of addresses returned.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_IPv4_ERR_NONE       Addresses returned.
+*                                   NET_ERR_INVALID_ADDR    Unknown interface.
+*
+* Return(s)   : DEF_OK,   if the addresses are returned,
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The interface has a single address, NET_POSIX_IPv4_ADDR_HOST, taken from the range reserved
+*                   for documentation (see RFC #5737).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIPv4_GetAddrHost (NET_IF_NBR         if_nbr,
+                                  NET_IPv4_ADDR     *p_addr_tbl,
+                                  NET_IP_ADDRS_QTY  *p_addr_tbl_qty,
+                                  NET_ERR           *p_err)
+{
+    if ((if_nbr          != NET_IF_NBR_BASE_CFGD) ||
+        (*p_addr_tbl_qty  < 1u)) {
+       *p_addr_tbl_qty = 0u;
+       *p_err          = NET_ERR_INVALID_ADDR;
+        return (DEF_FAIL);
+    }
+
+    p_addr_tbl[0]   = NET_POSIX_IPv4_ADDR_HOST;                 /* See Note #1.                                         */
+   *p_addr_tbl_qty  = 1u;
+   *p_err           = NET_IPv4_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        NetIPv6_GetAddrHost()
+*
+* Description : Get the IPv6 host addresses of an interface.
+*
+* Argument(s) : if_nbr          Interface number.
+*
+*               p_addr_tbl      Pointer to the table that will receive the addresses.
+*
+*               p_addr_tbl_qty  Pointer to variable that :
+*
+*                                   (a) Passes the size of the table, in number of addresses.
+*                                   (b) Returns the number of addresses returned.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_IPv6_ERR_NONE       Addresses returned.
+*                                   NET_ERR_INVALID_ADDR    Unknown interface.
+*
+* Return(s)   : DEF_OK,   if the addresses are returned,
+*
+*               DEF_FAIL, otherwise.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The interface has a single global address, 2001:db8::1, taken from the prefix reserved for
+*                   documentation (see RFC #3849).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetIPv6_GetAddrHost (NET_IF_NBR         if_nbr,
+                                  NET_IPv6_ADDR     *p_addr_tbl,
+                                  NET_IP_ADDRS_QTY  *p_addr_tbl_qty,
+                                  NET_ERR           *p_err)
+{
+    if ((if_nbr          != NET_IF_NBR_BASE_CFGD) ||
+        (*p_addr_tbl_qty  < 1u)) {
+       *p_addr_tbl_qty = 0u;
+       *p_err          = NET_ERR_INVALID_ADDR;
+        return (DEF_FAIL);
+    }
+
+    p_addr_tbl[0]           = NET_IPv6_ADDR_ANY;                /* See Note #1.                                         */
+    p_addr_tbl[0].Addr[0]   = 0x20u;
+    p_addr_tbl[0].Addr[1]   = 0x01u;
+    p_addr_tbl[0].Addr[2]   = 0x0Du;
+    p_addr_tbl[0].Addr[3]   = 0xB8u;
+    p_addr_tbl[0].Addr[15]  = 0x01u;
+   *p_addr_tbl_qty          = 1u;
+   *p_err                   = NET_IPv6_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        NetSock_AddrToHost()
+*
+* Description : Convert a socket address to the host's format.
+*
+* Argument(s) : p_addr          Pointer to the socket address.
+*
+*               p_addr_host     Pointer to the variable that will receive the host socket address.
+*
+* Return(s)   : Length of the host socket address, 0 for an unsupported family.
+*
+* Caller(s)   : NetSock_Bind(),
+*               NetSock_Conn().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+#ifndef  NET_POSIX_SOCK_EXT
+static  socklen_t  NetSock_AddrToHost (const  NET_SOCK_ADDR            *p_addr,
+                                              struct  sockaddr_storage *p_addr_host)
+{
+    struct  sockaddr_in   *p_addr_ipv4;
+    struct  sockaddr_in6  *p_addr_ipv6;
+
+
+    Mem_Clr(p_addr_host, sizeof(struct sockaddr_storage));
+
+    switch (p_addr->AddrFamily) {
+        case NET_SOCK_ADDR_FAMILY_IP_V4:
+             p_addr_ipv4             = (struct sockaddr_in *)p_addr_host;
+             p_addr_ipv4->sin_family =  AF_INET;
+             p_addr_ipv4->sin_port   =  p_addr->Port;
+             Mem_Copy(&p_addr_ipv4->sin_addr, p_addr->Addr, NET_IPv4_ADDR_SIZE);
+             return ((socklen_t)sizeof(struct sockaddr_in));
+
+        case NET_SOCK_ADDR_FAMILY_IP_V6:
+             p_addr_ipv6              = (struct sockaddr_in6 *)p_addr_host;
+             p_addr_ipv6->sin6_family =  AF_INET6;
+             p_addr_ipv6->sin6_port   =  p_addr->Port;
+             Mem_Copy(&p_addr_ipv6->sin6_addr, p_addr->Addr, NET_IPv6_ADDR_SIZE);
+             return ((socklen_t)sizeof(struct sockaddr_in6));
+
+        default:
+             return (0u);
+    }
+}
+#endif  /* NET_POSIX_SOCK_EXT */
@@ -0,0 +1,947 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                          POSIX HOST PORT
+*                                      VIRTUAL-TIME SIMULATOR
+*
+* Filename : dns-c_sim.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) The simulator resolves a series of names for each retry policy given on the command line &
+*                reports the distribution of their resolution latency, in virtual time:
+*
+*                (a) DNSc runs in synchronous mode (DNSc_CFG_MODE_ASYNC_EN disabled), so that every
+*                    resolution runs in the caller's thread.
+*
+*                (b) The configuration's clock (see 'dns-c_type.h  DNSc_CFG_CLK') is a counter that only
+*                    moves when DNSc delays: a delay advances it instead of waiting.
+*
+*                (c) The socket functions (see 'net_posix.c  Note #3') hand each query to the stub
+*                    responder (see 'dns-c_bench_responder.h') & queue its response until the virtual time
+*                    reaches the response's delay.
+*
+*                A run therefore takes the CPU time of DNSc alone, whatever the latencies & timeouts, &
+*                replays exactly w/ the same options & seed.
+*
+*            (2) The responder is initialized again w/ the same seed before each policy, so that every
+*                policy faces the same sequence of losses & delays.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  _XOPEN_SOURCE  700
+
+#include  <stdio.h>
+#include  <stdlib.h>
+#include  <string.h>
+#include  <time.h>
+#include  <unistd.h>
+
+#include  <Source/dns-c.h>
+
+#include  "dns-c_bench_responder.h"
+
+#if (DNSc_CFG_MODE_ASYNC_EN == DEF_ENABLED)
+#error  "The simulator requires DNSc_CFG_MODE_ASYNC_EN == DEF_DISABLED [see 'dns-c_sim.c  Note #1a']"
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_SIM_LOOKUP_NBR_DFLT                       1000u
+#define  DNSc_SIM_POLICY_NBR_MAX                          16u
+#define  DNSc_SIM_POLICY_DFLT                 "1:1000,2:1000,2:500,3:250"
+
+#define  DNSc_SIM_SOCK_NBR_MAX                             8u
+#define  DNSc_SIM_RESP_NBR_MAX                            16u   /* Max nbr of queued resp per sock.                     */
+
+#define  DNSc_SIM_NAME_LEN_MAX                            64u
+#define  DNSc_SIM_ADDR_NBR_MAX                             4u
+
+#define  DNSc_SIM_SUFFIX                        "bench.test"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_sim_policy {
+    CPU_INT08U      ReqRetry;                                   /* See DNSc_REQ_CFG.                                    */
+    CPU_INT16U      ReqTimeout_ms;
+} DNSc_SIM_POLICY;
+
+
+typedef  struct  dnsc_sim_resp {
+    CPU_BOOLEAN     Used;
+    NET_TS_MS       Due_ms;                                     /* Virtual time at which the resp may be rx'd.          */
+    CPU_INT16U      Len;
+    CPU_INT08U      Msg[DNSc_BENCH_MSG_LEN_MAX];
+} DNSc_SIM_RESP;
+
+
+typedef  struct  dnsc_sim_sock {
+    CPU_BOOLEAN     Used;
+    DNSc_SIM_RESP   RespTbl[DNSc_SIM_RESP_NBR_MAX];
+} DNSc_SIM_SOCK;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  NET_TS_MS        DNScSim_TS_ms;                         /* See Note #1b.                                        */
+static  DNSc_SIM_SOCK    DNScSim_SockTbl[DNSc_SIM_SOCK_NBR_MAX];
+static  CPU_INT32U       DNScSim_RespOvf;                       /* Nbr of resp discarded on a full sock queue.          */
+
+static  CPU_INT32U  DNScSim_ClkTS_Get_ms(void);
+static  void        DNScSim_ClkDly_ms   (CPU_INT32U  dly_ms);
+
+static  const  DNSc_CFG_CLK  DNScSim_Clk = {
+    DNScSim_ClkTS_Get_ms,
+    DNScSim_ClkDly_ms
+};
+
+static  const  DNSc_BENCH_REC  DNScSim_RecTbl[] = {
+    { "www." DNSc_SIM_SUFFIX, "192.0.2.10"   },
+    { "www." DNSc_SIM_SUFFIX, "2001:db8::10" },
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U   DNScSim_PolicyParse(const  char             *p_str,
+                                                DNSc_SIM_POLICY  *p_policy_tbl);
+
+static  CPU_INT64U   DNScSim_TS_Get_us  (       void);
+
+static  int          DNScSim_LatCmp     (const  void             *p_lat_1,
+                                         const  void             *p_lat_2);
+
+static  void         DNScSim_Usage      (const  char             *p_prog);
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          GLOBAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                               main()
+*
+* Description : Initialize DNSc on the virtual clock, run the lookups of every retry policy & report the
+*               results.
+*
+* Argument(s) : argc        Nbr of command line arguments.
+*
+*               argv        Command line arguments (see DNScSim_Usage()).
+*
+* Return(s)   : EXIT_SUCCESS, if every policy ran.
+*
+*               EXIT_FAILURE, otherwise.
+*
+* Caller(s)   : Host's C runtime.
+*
+* Note(s)     : (1) Failed lookups are reported but do not fail the run: under loss, a policy w/ too few
+*                   retries is expected to fail some of them.
+*********************************************************************************************************
+*/
+
+int  main (int    argc,
+           char  *argv[])
+{
+    DNSc_BENCH_RESPONDER_CFG    responder_cfg;
+    DNSc_BENCH_RESPONDER_STATS  responder_stats;
+    DNSc_SIM_POLICY             policy_tbl[DNSc_SIM_POLICY_NBR_MAX];
+    DNSc_CFG                    cfg;
+    DNSc_REQ_CFG                req_cfg;
+    DNSc_RESOLVER_STATS         resolver_stats;
+    DNSc_ADDR_OBJ               addrs[DNSc_SIM_ADDR_NBR_MAX];
+    CPU_CHAR                    name[DNSc_SIM_NAME_LEN_MAX];
+    CPU_INT32U                 *p_lat_tbl;
+    CPU_INT32U                  lookup_nbr  = DNSc_SIM_LOOKUP_NBR_DFLT;
+    CPU_INT32U                  deadline_ms = 0u;
+    CPU_INT32U                  fails;
+    CPU_INT32U                  ix;
+    CPU_INT16U                  policy_nbr;
+    CPU_INT16U                  policy_ix;
+    CPU_INT08U                  addr_nbr;
+    CPU_INT64U                  ts_start_us;
+    CPU_INT64U                  elapsed_us;
+    NET_TS_MS                   ts_start_ms;
+    DNSc_FLAGS                  flags       = DNSc_FLAG_NONE;
+    DNSc_STATUS                 status;
+    DNSc_ERR                    err;
+    const  char                *p_policies  = DNSc_SIM_POLICY_DFLT;
+    int                         opt;
+
+
+    Mem_Clr(&responder_cfg, sizeof(responder_cfg));
+    responder_cfg.TTL_s          = 3600u;
+    responder_cfg.RecTblPtr      = DNScSim_RecTbl;
+    responder_cfg.RecNbr         = sizeof(DNScSim_RecTbl) / sizeof(DNScSim_RecTbl[0]);
+    responder_cfg.SynthSuffixPtr = DNSc_SIM_SUFFIX;
+    responder_cfg.Latency_ms     = 20u;
+    responder_cfg.Seed           = 1u;
+
+                                                                /* ------------------- PARSE OPTIONS ------------------ */
+    while ((opt = getopt(argc, argv, "P:n:D:l:j:L:s:f:")) != -1) {
+        switch (opt) {
+            case 'P':
+                 p_policies               = optarg;
+                 break;
+
+            case 'n':
+                 lookup_nbr               = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'D':
+                 deadline_ms              = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'l':
+                 responder_cfg.Latency_ms = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'j':
+                 responder_cfg.Jitter_ms  = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'L':
+                 responder_cfg.LossPct    = (CPU_INT08U)DEF_MIN(strtoul(optarg, DEF_NULL, 10), 100u);
+                 break;
+
+            case 's':
+                 responder_cfg.Seed       = (CPU_INT32U)strtoul(optarg, DEF_NULL, 10);
+                 break;
+
+            case 'f':
+                 if (strcmp(optarg, "4") == 0) {
+                     flags = DNSc_FLAG_IPv4_ONLY;
+                 } else if (strcmp(optarg, "6") == 0) {
+                     flags = DNSc_FLAG_IPv6_ONLY;
+                 } else if (strcmp(optarg, "any") == 0) {
+                     flags = DNSc_FLAG_NONE;
+                 } else {
+                     DNScSim_Usage(argv[0]);
+                     return (EXIT_FAILURE);
+                 }
+                 break;
+
+            default:
+                 DNScSim_Usage(argv[0]);
+                 return (EXIT_FAILURE);
+        }
+    }
+
+    policy_nbr = DNScSim_PolicyParse(p_policies, policy_tbl);
+    if ((policy_nbr == 0u) ||
+        (lookup_nbr <  1u)) {
+        DNScSim_Usage(argv[0]);
+        return (EXIT_FAILURE);
+    }
+
+                                                                /* ------------------ START DNSc ---------------------- */
+    cfg        = DNSc_Cfg;
+    cfg.ClkPtr = &DNScSim_Clk;                                  /* See Note #1b.                                        */
+    DNSc_Init(&cfg, DEF_NULL, &err);
+    if (err != DNSc_ERR_NONE) {
+        fprintf(stderr, "DNSc_Init() failed: %d\n", (int)err);
+        return (EXIT_FAILURE);
+    }
+
+    p_lat_tbl = (CPU_INT32U *)malloc(lookup_nbr * sizeof(CPU_INT32U));
+    if (p_lat_tbl == DEF_NULL) {
+        return (EXIT_FAILURE);
+    }
+
+    printf("responder    : latency %u ms, jitter %u ms, loss %u%%, %u lookup(s) per policy\n",
+           (unsigned)responder_cfg.Latency_ms,
+           (unsigned)responder_cfg.Jitter_ms,
+           (unsigned)responder_cfg.LossPct,
+           (unsigned)lookup_nbr);
+
+                                                                /* ------------------- RUN POLICIES ------------------- */
+    for (policy_ix = 0u; policy_ix < policy_nbr; policy_ix++) {
+                                                                /* See Note #2.                                         */
+        if (DNScBench_ResponderInit(&responder_cfg) != DEF_OK) {
+            return (EXIT_FAILURE);
+        }
+        DNSc_CacheClrAll(&err);
+        DNSc_CacheStatsReset(&err);
+        DNSc_ResolverStatsReset(&err);
+
+        Mem_Clr(&req_cfg, sizeof(req_cfg));
+        req_cfg.ServerAddrPtr  = DEF_NULL;
+        req_cfg.ServerPort     = NET_PORT_NBR_NONE;
+        req_cfg.TaskDly_ms     = cfg.TaskDly_ms;
+        req_cfg.ReqTimeout_ms  = policy_tbl[policy_ix].ReqTimeout_ms;
+        req_cfg.ReqRetry       = policy_tbl[policy_ix].ReqRetry;
+        req_cfg.ReqDeadline_ms = deadline_ms;                   /* 0 for none.                                          */
+
+        fails       = 0u;
+        ts_start_us = DNScSim_TS_Get_us();
+        for (ix = 0u; ix < lookup_nbr; ix++) {
+            (void)snprintf(name, sizeof(name), "s%u.%s", (unsigned)ix, DNSc_SIM_SUFFIX);
+
+            ts_start_ms = DNScSim_TS_ms;
+            addr_nbr    = DNSc_SIM_ADDR_NBR_MAX;
+            status      = DNSc_GetHost(name,
+                                       DEF_NULL,
+                                       0u,
+                                       addrs,
+                                      &addr_nbr,
+                                       flags,
+                                      &req_cfg,
+                                      &err);
+            if ((status   != DNSc_STATUS_RESOLVED) ||
+                (addr_nbr == 0u)) {
+                fails++;                                        /* See Note #1.                                         */
+            }
+            p_lat_tbl[ix] = (CPU_INT32U)(DNScSim_TS_ms - ts_start_ms);
+        }
+        elapsed_us = DNScSim_TS_Get_us() - ts_start_us;
+
+        qsort(p_lat_tbl, lookup_nbr, sizeof(CPU_INT32U), DNScSim_LatCmp);
+        DNSc_ResolverStatsGet(&resolver_stats, &err);
+        DNScBench_ResponderStatsGet(&responder_stats);
+
+        printf("policy %u:%-5u: ok %.2f%%, latency (ms) p50 %u, p90 %u, p99 %u, max %u; "
+               "req %u, retx %u, timeouts %u, deadlines %u, dropped %u; %.3f s\n",
+               (unsigned)policy_tbl[policy_ix].ReqRetry,
+               (unsigned)policy_tbl[policy_ix].ReqTimeout_ms,
+               (double)(lookup_nbr - fails) * 100.0 / (double)lookup_nbr,
+               (unsigned)p_lat_tbl[(lookup_nbr * 50u) / 100u],
+               (unsigned)p_lat_tbl[(lookup_nbr * 90u) / 100u],
+               (unsigned)p_lat_tbl[(lookup_nbr * 99u) / 100u],
+               (unsigned)p_lat_tbl[lookup_nbr - 1u],
+               (unsigned)resolver_stats.Req,
+               (unsigned)resolver_stats.ReTx,
+               (unsigned)resolver_stats.Timeouts,
+               (unsigned)resolver_stats.Errs[DNSc_STATS_ERR_DEADLINE],
+               (unsigned)responder_stats.Dropped,
+               (double)elapsed_us / 1000000.0);
+    }
+
+    if (DNScSim_RespOvf > 0u) {
+        printf("warning      : %u response(s) discarded on a full socket queue\n", (unsigned)DNScSim_RespOvf);
+    }
+
+    free(p_lat_tbl);
+
+    return (EXIT_SUCCESS);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Open()
+*
+* Description : Open a simulated socket.
+*
+* Argument(s) : protocol_family     Protocol family (unused).
+*
+*               sock_type           Socket type (unused).
+*
+*               protocol            Protocol (unused).
+*
+*               p_err               Pointer to variable that will receive the return error code from this function :
+*
+*                                       NET_SOCK_ERR_NONE               Socket opened.
+*                                       NET_SOCK_ERR_NONE_AVAIL         No free socket.
+*
+* Return(s)   : Socket ID,        if no error.
+*
+*               NET_SOCK_ID_NONE, otherwise.
+*
+* Caller(s)   : DNScReq_ServerInit().
+*
+* Note(s)     : (1) See 'dns-c_sim.c  Note #1c'.
+*********************************************************************************************************
+*/
+
+NET_SOCK_ID  NetSock_Open (NET_SOCK_PROTOCOL_FAMILY   protocol_family,
+                           NET_SOCK_TYPE              sock_type,
+                           NET_SOCK_PROTOCOL          protocol,
+                           NET_ERR                   *p_err)
+{
+    CPU_INT16U  ix;
+
+
+    (void)protocol_family;
+    (void)sock_type;
+    (void)protocol;
+
+    for (ix = 0u; ix < DNSc_SIM_SOCK_NBR_MAX; ix++) {
+        if (DNScSim_SockTbl[ix].Used == DEF_NO) {
+            Mem_Clr(&DNScSim_SockTbl[ix], sizeof(DNScSim_SockTbl[ix]));
+            DNScSim_SockTbl[ix].Used = DEF_YES;
+           *p_err = NET_SOCK_ERR_NONE;
+            return ((NET_SOCK_ID)ix);
+        }
+    }
+
+   *p_err = NET_SOCK_ERR_NONE_AVAIL;
+
+    return (NET_SOCK_ID_NONE);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Close()
+*
+* Description : Close a simulated socket & discard its queued responses.
+*
+* Argument(s) : sock_id     Socket ID.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Socket closed.
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket ID.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  NetSock_Close (NET_SOCK_ID   sock_id,
+                     NET_ERR      *p_err)
+{
+    if ((sock_id < 0) ||
+        (sock_id >= (NET_SOCK_ID)DNSc_SIM_SOCK_NBR_MAX)) {
+       *p_err = NET_SOCK_ERR_INVALID_SOCK;
+        return;
+    }
+
+    DNScSim_SockTbl[sock_id].Used = DEF_NO;
+   *p_err = NET_SOCK_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Bind()
+*
+* Description : Bind a simulated socket; always succeeds.
+*
+* Argument(s) : sock_id         Socket ID (unused).
+*
+*               p_addr_local    Pointer to the local socket address (unused).
+*
+*               addr_len        Length of the socket address (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Socket bound.
+*
+* Return(s)   : 0.
+*
+* Caller(s)   : DNScReq_ServerInit().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_Bind (NET_SOCK_ID         sock_id,
+                          NET_SOCK_ADDR      *p_addr_local,
+                          NET_SOCK_ADDR_LEN   addr_len,
+                          NET_ERR            *p_err)
+{
+    (void)sock_id;
+    (void)p_addr_local;
+    (void)addr_len;
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_Conn()
+*
+* Description : Connect a simulated socket; every socket reaches the stub responder, whatever the address.
+*
+* Argument(s) : sock_id         Socket ID (unused).
+*
+*               p_addr_remote   Pointer to the remote socket address (unused).
+*
+*               addr_len        Length of the socket address (unused).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Socket connected.
+*
+* Return(s)   : 0.
+*
+* Caller(s)   : DNScReq_ServerInit().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_Conn (NET_SOCK_ID         sock_id,
+                          NET_SOCK_ADDR      *p_addr_remote,
+                          NET_SOCK_ADDR_LEN   addr_len,
+                          NET_ERR            *p_err)
+{
+    (void)sock_id;
+    (void)p_addr_remote;
+    (void)addr_len;
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (0);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_TxData()
+*
+* Description : Hand a query to the stub responder & queue its response.
+*
+* Argument(s) : sock_id     Socket ID.
+*
+*               p_data      Pointer to the query.
+*
+*               data_len    Length of the query, in octets.
+*
+*               flags       Flags (unused).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Query transmitted, possibly dropped.
+*                               NET_SOCK_ERR_INVALID_SOCK       Invalid socket ID.
+*
+* Return(s)   : Number of octets transmitted, if no error.
+*
+*               -1,                           otherwise.
+*
+* Caller(s)   : DNScReq_TxData().
+*
+* Note(s)     : (1) A response that finds its socket's queue full is discarded, as a lost datagram would be,
+*                   & counted so that the report warns about it.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_TxData (NET_SOCK_ID          sock_id,
+                            void                *p_data,
+                            CPU_INT16U           data_len,
+                            NET_SOCK_API_FLAGS   flags,
+                            NET_ERR             *p_err)
+{
+    DNSc_SIM_SOCK  *p_sock;
+    DNSc_SIM_RESP  *p_resp;
+    CPU_INT08U      msg[DNSc_BENCH_MSG_LEN_MAX];
+    CPU_INT32U      dly_ms;
+    CPU_INT16U      len;
+    CPU_INT16U      ix;
+
+
+    (void)flags;
+
+    if ((sock_id  <  0)                                     ||
+        (sock_id  >= (NET_SOCK_ID)DNSc_SIM_SOCK_NBR_MAX)    ||
+        (DNScSim_SockTbl[sock_id].Used == DEF_NO)           ||
+        (data_len >  DNSc_BENCH_MSG_LEN_MAX)) {
+       *p_err = NET_SOCK_ERR_INVALID_SOCK;
+        return (-1);
+    }
+
+    p_sock = &DNScSim_SockTbl[sock_id];
+    Mem_Copy(msg, p_data, data_len);
+    len    =  DNScBench_ResponderProcess(msg, data_len, &dly_ms);
+    if (len > 0u) {
+        for (ix = 0u; ix < DNSc_SIM_RESP_NBR_MAX; ix++) {
+            p_resp = &p_sock->RespTbl[ix];
+            if (p_resp->Used == DEF_NO) {
+                p_resp->Used   = DEF_YES;
+                p_resp->Due_ms = DNScSim_TS_ms + dly_ms;
+                p_resp->Len    = len;
+                Mem_Copy(p_resp->Msg, msg, len);
+                break;
+            }
+        }
+        if (ix >= DNSc_SIM_RESP_NBR_MAX) {                      /* See Note #1.                                         */
+            DNScSim_RespOvf++;
+        }
+    }
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return ((CPU_INT32S)data_len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          NetSock_RxData()
+*
+* Description : Receive the earliest queued response whose delay has elapsed.
+*
+* Argument(s) : sock_id         Socket ID.
+*
+*               p_data_buf      Pointer to the buffer that will receive the data.
+*
+*               data_buf_len    Size of the buffer, in octets.
+*
+*               flags           Flags (unused, never blocks).
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   NET_SOCK_ERR_NONE               Data received.
+*                                   NET_SOCK_ERR_RX_Q_EMPTY         No response due yet.
+*                                   NET_SOCK_ERR_INVALID_SOCK       Invalid socket ID.
+*
+* Return(s)   : Number of octets received, if no error.
+*
+*               -1,                        otherwise.
+*
+* Caller(s)   : DNScReq_RxData().
+*
+* Note(s)     : (1) A response longer than the buffer is truncated, as a datagram would be.
+*********************************************************************************************************
+*/
+
+CPU_INT32S  NetSock_RxData (NET_SOCK_ID          sock_id,
+                            void                *p_data_buf,
+                            CPU_INT16U           data_buf_len,
+                            NET_SOCK_API_FLAGS   flags,
+                            NET_ERR             *p_err)
+{
+    DNSc_SIM_SOCK  *p_sock;
+    DNSc_SIM_RESP  *p_resp;
+    DNSc_SIM_RESP  *p_resp_due;
+    CPU_INT16U      len;
+    CPU_INT16U      ix;
+
+
+    (void)flags;
+
+    if ((sock_id <  0)                                      ||
+        (sock_id >= (NET_SOCK_ID)DNSc_SIM_SOCK_NBR_MAX)     ||
+        (DNScSim_SockTbl[sock_id].Used == DEF_NO)) {
+       *p_err = NET_SOCK_ERR_INVALID_SOCK;
+        return (-1);
+    }
+
+    p_sock     = &DNScSim_SockTbl[sock_id];
+    p_resp_due =  DEF_NULL;
+    for (ix = 0u; ix < DNSc_SIM_RESP_NBR_MAX; ix++) {
+        p_resp = &p_sock->RespTbl[ix];
+        if ((p_resp->Used == DEF_YES) &&
+            ((NET_TS_MS)(DNScSim_TS_ms - p_resp->Due_ms) < DEF_INT_32U_MAX_VAL / 2u)) {
+            if ((p_resp_due == DEF_NULL) ||
+                ((NET_TS_MS)(p_resp->Due_ms - p_resp_due->Due_ms) > DEF_INT_32U_MAX_VAL / 2u)) {
+                p_resp_due = p_resp;
+            }
+        }
+    }
+
+    if (p_resp_due == DEF_NULL) {
+       *p_err = NET_SOCK_ERR_RX_Q_EMPTY;
+        return (-1);
+    }
+
+    len              = DEF_MIN(p_resp_due->Len, data_buf_len);  /* See Note #1.                                         */
+    Mem_Copy(p_data_buf, p_resp_due->Msg, len);
+    p_resp_due->Used = DEF_NO;
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return ((CPU_INT32S)len);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           NetSock_CfgIF()
+*
+* Description : Configure the interface of a simulated socket; always succeeds.
+*
+* Argument(s) : sock_id     Socket ID (unused).
+*
+*               if_nbr      Interface number (unused).
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               NET_SOCK_ERR_NONE               Interface configured.
+*
+* Return(s)   : DEF_OK.
+*
+* Caller(s)   : DNSc.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  NetSock_CfgIF (NET_SOCK_ID   sock_id,
+                            NET_IF_NBR    if_nbr,
+                            NET_ERR      *p_err)
+{
+    (void)sock_id;
+    (void)if_nbr;
+
+   *p_err = NET_SOCK_ERR_NONE;
+
+    return (DEF_OK);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                       DNScSim_ClkTS_Get_ms()
+*
+* Description : Get the virtual time.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Virtual time, in milliseconds.
+*
+* Caller(s)   : Referenced by DNScSim_Clk.
+*
+* Note(s)     : (1) See 'dns-c_sim.c  Note #1b'.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DNScSim_ClkTS_Get_ms (void)
+{
+    return ((CPU_INT32U)DNScSim_TS_ms);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScSim_ClkDly_ms()
+*
+* Description : Advance the virtual time.
+*
+* Argument(s) : dly_ms      Delay, in milliseconds.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Referenced by DNScSim_Clk.
+*
+* Note(s)     : (1) A null delay still advances the time by one millisecond, so that a loop that polls w/o
+*                   delay cannot stall the virtual time.
+*********************************************************************************************************
+*/
+
+static  void  DNScSim_ClkDly_ms (CPU_INT32U  dly_ms)
+{
+    DNScSim_TS_ms += DEF_MAX(dly_ms, 1u);                       /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScSim_PolicyParse()
+*
+* Description : Parse a list of retry policies.
+*
+* Argument(s) : p_str           Pointer to the list, "retry:timeout_ms[,retry:timeout_ms ...]".
+*
+*               p_policy_tbl    Pointer to a DNSc_SIM_POLICY_NBR_MAX entries table that will receive the
+*                               policies.
+*
+* Return(s)   : Number of policies, 0 if the list is invalid.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DNScSim_PolicyParse (const  char             *p_str,
+                                                DNSc_SIM_POLICY  *p_policy_tbl)
+{
+    CPU_INT16U     nbr = 0u;
+    unsigned long  retry;
+    unsigned long  timeout_ms;
+    char          *p_end;
+
+
+    while (*p_str != '\0') {
+        if (nbr >= DNSc_SIM_POLICY_NBR_MAX) {
+            return (0u);
+        }
+
+        retry = strtoul(p_str, &p_end, 10);
+        if ((p_end == p_str) ||
+            (*p_end != ':')) {
+            return (0u);
+        }
+        p_str      = p_end + 1;
+        timeout_ms = strtoul(p_str, &p_end, 10);
+        if ((p_end      == p_str)          ||
+            (retry      <  1u)             ||
+            (retry      >  DEF_INT_08U_MAX_VAL) ||
+            (timeout_ms <  1u)             ||
+            (timeout_ms >  DEF_INT_16U_MAX_VAL)) {
+            return (0u);
+        }
+
+        p_policy_tbl[nbr].ReqRetry      = (CPU_INT08U)retry;
+        p_policy_tbl[nbr].ReqTimeout_ms = (CPU_INT16U)timeout_ms;
+        nbr++;
+
+        p_str = p_end;
+        if (*p_str == ',') {
+            p_str++;
+        } else if (*p_str != '\0') {
+            return (0u);
+        }
+    }
+
+    return (nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScSim_TS_Get_us()
+*
+* Description : Get the host's monotonic time, in microseconds.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Timestamp, in microseconds.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT64U  DNScSim_TS_Get_us (void)
+{
+    struct  timespec  ts;
+
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (((CPU_INT64U)ts.tv_sec * DEF_TIME_NBR_uS_PER_SEC) + ((CPU_INT64U)ts.tv_nsec / 1000u));
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScSim_LatCmp()
+*
+* Description : Compare two latencies, for qsort().
+*
+* Argument(s) : p_lat_1     Pointer to the first latency.
+*
+*               p_lat_2     Pointer to the second latency.
+*
+* Return(s)   : Negative, zero or positive, as the first latency is lower, equal or higher.
+*
+* Caller(s)   : Referenced by main().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  int  DNScSim_LatCmp (const  void  *p_lat_1,
+                             const  void  *p_lat_2)
+{
+    CPU_INT32U  lat_1 = *(const CPU_INT32U *)p_lat_1;
+    CPU_INT32U  lat_2 = *(const CPU_INT32U *)p_lat_2;
+
+
+    return ((lat_1 > lat_2) - (lat_1 < lat_2));
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DNScSim_Usage()
+*
+* Description : Print the command line usage.
+*
+* Argument(s) : p_prog      Pointer to the program name.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : main().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScSim_Usage (const  char  *p_prog)
+{
+    fprintf(stderr,
+            "usage: %s [options]\n"
+            "  -P r:t[,r:t ...]   retry policies, as request retries & timeout in ms (default %s)\n"
+            "  -n nbr             number of lookups per policy (default %u)\n"
+            "  -D ms              overall deadline of each lookup (default 0, none)\n"
+            "  -f 4|6|any         address family (default any)\n"
+            "  -l ms              responder latency (default 20)\n"
+            "  -j ms              responder jitter (default 0)\n"
+            "  -L pct             responder loss (default 0)\n"
+            "  -s seed            seed of the loss & jitter generator (default 1)\n",
+            p_prog,
+            DNSc_SIM_POLICY_DFLT,
+            (unsigned)DNSc_SIM_LOOKUP_NBR_DFLT);
+}
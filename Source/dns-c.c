@@ -49,10 +49,44 @@
 #include  "dns-c.h"
 #include  "dns-c_req.h"
 #include  "dns-c_cache.h"
+#include  "dns-c_hosts.h"
+#include  "dns-c_addr.h"
 #include  "dns-c_task.h"
 #include  <Source/net_ascii.h>
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+                                                                /* Error code per counter, in DNSc_STATS_ERR order.     */
+static  const  DNSc_ERR  DNSc_StatsErrTbl[DNSc_STATS_ERR_OTHER] = {
+    DNSc_ERR_NO_SERVER,
+    DNSc_ERR_DEADLINE,
+    DNSc_ERR_CANCELED,
+    DNSc_ERR_NAME_NOT_EXIST,
+    DNSc_ERR_SERVER_FAIL,
+    DNSc_ERR_FMT,
+    DNSc_ERR_NOT_A_RESPONSE,
+    DNSc_ERR_NO_RESPONSE,
+    DNSc_ERR_BAD_RESPONSE_TYPE,
+    DNSc_ERR_BAD_QUESTION_COUNT,
+    DNSc_ERR_BAD_RESPONSE_ID,
+    DNSc_ERR_SOCK_OPEN_FAIL,
+    DNSc_ERR_TX,
+    DNSc_ERR_TX_FAULT,
+    DNSc_ERR_RX_FAULT,
+    DNSc_ERR_IF_LINK_DOWN,
+    DNSc_ERR_BUF_LEN,
+    DNSc_ERR_MEM_ALLOC,
+    DNSc_ERR_INVALID_HOST_NAME
+};
+
+
 /*
 *********************************************************************************************************
 *                                             DNSc_Init()
@@ -72,6 +106,9 @@
 *                               RETURNED BY DNScCache_Init():
 *                                   See DNScCache_Init() for additional return error codes.
 *
+*                               RETURNED BY DNScHosts_Init():
+*                                   See DNScHosts_Init() for additional return error codes.
+*
 *                               RETURNED BY DNScTask_Init():
 *                                   See DNScTask_Init() for additional return error codes.
 *
@@ -102,6 +139,11 @@ void  DNSc_Init (const  DNSc_CFG       *p_cfg,
         goto exit;
     }
 
+    DNScHosts_Init(p_cfg, p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+        goto exit;
+    }
+
     DNScReq_ServerInit(p_cfg, p_err);
     if (*p_err != DNSc_ERR_NONE) {
         goto exit;
@@ -421,10 +463,12 @@ void  DNSc_GetServerByAddr (DNSc_ADDR_OBJ  *p_addr,
 *                                       DNSc_FLAG_FORCE_CACHE       Take host from the cache, don't send new DNS request.
 *                                       DNSc_FLAG_FORCE_RENEW       Force DNS request, remove existing entry in the cache.
 *                                       DNSc_FLAG_FORCE_RESOLUTION  Force DNS to resolve given host name.
-*                                       DNSc_FLAG_IPv4_ONLY         Return only IPv4 address(es).                (A     type).
-*                                       DNSc_FLAG_IPv6_ONLY         Return only IPv6 address(es).                (AAAA  type).
+*                                       DNSc_FLAG_IPv4_ONLY         Resolve only IPv4 address(es).               (A     type).
+*                                       DNSc_FLAG_IPv6_ONLY         Resolve only IPv6 address(es).               (AAAA  type).
 *                                       DNSc_FLAG_REVERSE_LOOKUP    Issue a reverse DNS lookup for an IPv4 addr. (PTR   type).
 *                                       DNSc_FLAG_CANON             Handle canonical name in DNS answer(s).      (CNAME type).
+*                                       DNSc_FLAG_ADDR_SORT         Order the address(es) by preference. (See Note #7).
+*                                       DNSc_FLAG_PARTIAL           Return the IPv4 address(es) first.   (See Note #8).
 *
 *               p_cfg               Pointer to a request configuration. Should be set to overwrite default DNS configuration
 *                                   (such as DNS server, request timeout, etc.).
@@ -459,6 +503,42 @@ void  DNSc_GetServerByAddr (DNSc_ADDR_OBJ  *p_addr,
 *               (2) If the DNSc_FLAG_CANON flag is set, this function will handle canonical names and update
 *                   the host entry's .CanonicalNamePtr until a TYPE A, TYPE AAAA answer is found or the
 *                   end of the message is reached.
+*
+*               (3) Forward lookups that don't force a new resolution are first searched in the cache's front
+*                   table, which is keyed by the 'p_host_name' pointer. Callers that repeatedly resolve the
+*                   same name from the same buffer skip the cache lock & search entirely.
+*
+*               (4) Forward lookups of a name found in the static hosts table are answered from the table,
+*                   whatever the cache flags, & never reach the cache or the DNS server. With DNSc_FLAG_CANON,
+*                   the host name itself is returned as the canonical name.
+*
+*               (5) If 'p_cfg->ReqDeadline_ms' is not 0, the resolution fails once that time has elapsed since
+*                   this call, whatever the retries & interfaces left. A non-blocking request can also be
+*                   stopped earlier w/ DNSc_Cancel().
+*
+*               (6) DNSc's task advances the pending requests by priority ('p_cfg->ReqPrio'): high, then normal,
+*                   then low. The number of low-priority requests on the wire is bounded (see 'dns-c_cfg.h
+*                   DNSc_CFG_REQ_PRIO_LOW_NBR_MAX'). Requests without configuration have the normal priority.
+*
+*               (7) If the DNSc_FLAG_ADDR_SORT flag is set, the addresses of a resolved forward lookup are ordered
+*                   from the best destination to the worst, following RFC #6724 against the addresses of the
+*                   local interfaces, & the families are interleaved (see 'dns-c_addr.c  DNScAddr_Sort()').
+*                   The flag is ignored if DNSc_CFG_ADDR_SORT_EN is DISABLED.
+*
+*               (8) If the DNSc_FLAG_PARTIAL flag is set, a forward lookup of both families is reported resolved
+*                   as soon as its IPv4 addresses are, w/ these addresses only: a blocking call returns early &
+*                   a non-blocking one reports DNSc_STATUS_RESOLVED. DNSc's task keeps resolving the IPv6
+*                   addresses in the background & adds them to the cache entry; a later call returns both
+*                   families. The flag only shortens blocking calls when DNSc's task is enabled.
+*
+*               (9) A forward lookup only queries the address families it requests: w/ DNSc_FLAG_IPv4_ONLY, only
+*                   the A query is sent; w/ DNSc_FLAG_IPv6_ONLY, only the AAAA query. A later lookup of the
+*                   same host for a family its cache entry lacks resolves that family only & adds its addresses
+*                   to the entry (see 'dns-c_cache.c  DNScCache_HostObjGet()  Note #1').
+*
+*               (10) If another call resolves the host's entry again first, for a missing family or a reverse
+*                    lookup, this call does not restart it & returns DNSc_STATUS_PENDING w/
+*                    DNSc_ERR_CACHE_HOST_PENDING, as for any entry being resolved.
 *********************************************************************************************************
 */
 
@@ -479,6 +559,7 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
     CPU_BOOLEAN          is_canonical;
     CPU_BOOLEAN          is_force_res;
     CPU_BOOLEAN          is_reverse;
+    CPU_BOOLEAN          is_reused;
     CPU_INT08U           addr_nbr;
     CPU_SIZE_T           len;
     DNSc_HOST_OBJ       *p_host;
@@ -514,7 +595,8 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
     }
 
     flag_set = (DEF_BIT_IS_SET(flags, DNSc_FLAG_UPDATE_PREF) || /* Caller should never use these internal flags.        */
-                DEF_BIT_IS_SET(flags, DNSc_FLAG_RESET_REQ));
+                DEF_BIT_IS_SET(flags, DNSc_FLAG_RESET_REQ)   ||
+                DEF_BIT_IS_SET(flags, DNSc_FLAG_NO_STATS));
     if (flag_set == DEF_TRUE) {
        *p_err = DNSc_ERR_INVALID_ARG;
         goto exit;
@@ -555,8 +637,49 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
        *p_err = DNSc_ERR_INVALID_CFG;
         goto exit;
     }
+
+    if ((p_cfg          != DEF_NULL) &&
+        (p_cfg->ReqPrio >= DNSc_REQ_PRIO_NBR)) {
+       *p_err = DNSc_ERR_INVALID_CFG;
+        goto exit;
+    }
 #endif
 
+                                                                /* Static hosts answer every fwd lookup (see Note #4).  */
+    if (DEF_BIT_IS_CLR(flags, DNSc_FLAG_REVERSE_LOOKUP)) {
+        flag_set = DNScHosts_Srch(p_host_name,
+                                  p_addrs,
+                                 *p_addr_nbr,
+                                  p_addr_nbr,
+                                  flags);
+        if (flag_set == DEF_YES) {
+            if ((DEF_BIT_IS_SET(flags, DNSc_FLAG_CANON)) &&
+                (p_res_host_name != DEF_NULL)) {
+                Str_Copy_N(p_res_host_name, p_host_name, res_hostname_len);
+            }
+            status = DNSc_STATUS_RESOLVED;
+           *p_err  = DNSc_ERR_NONE;
+            goto exit;
+        }
+    }
+
+                                                                /* Try front cache for plain fwd lookups (see Note #3). */
+    if (DEF_BIT_IS_CLR(flags, DNSc_FLAG_REVERSE_LOOKUP   |
+                              DNSc_FLAG_CANON            |
+                              DNSc_FLAG_FORCE_RENEW      |
+                              DNSc_FLAG_FORCE_RESOLUTION)) {
+        flag_set = DNScCache_FrontSrch(p_host_name,
+                                       p_addrs,
+                                      *p_addr_nbr,
+                                       p_addr_nbr,
+                                       flags);
+        if (flag_set == DEF_YES) {
+            status = DNSc_STATUS_RESOLVED;
+           *p_err  = DNSc_ERR_NONE;
+            goto exit;
+        }
+    }
+
     is_canonical =  DEF_BIT_IS_SET(flags, DNSc_FLAG_CANON);
     is_reverse   =  DEF_BIT_IS_SET(flags, DNSc_FLAG_REVERSE_LOOKUP);
     addr_nbr     = *p_addr_nbr;
@@ -571,17 +694,21 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
                                               &err);
 
     if (p_cfg != DEF_NULL) {                                    /* Populate request configuration based on p_cfg value. */
-        local_req_cfg.ServerAddrPtr = p_cfg->ServerAddrPtr;
-        local_req_cfg.ServerPort    = p_cfg->ServerPort;
-        local_req_cfg.ReqTimeout_ms = p_cfg->ReqTimeout_ms;
-        local_req_cfg.ReqRetry      = p_cfg->ReqRetry;
-        local_req_cfg.TaskDly_ms    = p_cfg->TaskDly_ms;
+        local_req_cfg.ServerAddrPtr  = p_cfg->ServerAddrPtr;
+        local_req_cfg.ServerPort     = p_cfg->ServerPort;
+        local_req_cfg.ReqTimeout_ms  = p_cfg->ReqTimeout_ms;
+        local_req_cfg.ReqDeadline_ms = p_cfg->ReqDeadline_ms;
+        local_req_cfg.ReqRetry       = p_cfg->ReqRetry;
+        local_req_cfg.ReqPrio        = p_cfg->ReqPrio;
+        local_req_cfg.TaskDly_ms     = p_cfg->TaskDly_ms;
     } else {
-        local_req_cfg.ServerAddrPtr = (DNSc_ADDR_OBJ *)DEF_NULL;
-        local_req_cfg.ServerPort    = NET_PORT_NBR_NONE;
-        local_req_cfg.ReqTimeout_ms = DNSc_Cfg.ReqRetryTimeout_ms;
-        local_req_cfg.ReqRetry      = DNSc_Cfg.ReqRetryNbrMax;
-        local_req_cfg.TaskDly_ms    = DNSc_Cfg.TaskDly_ms;
+        local_req_cfg.ServerAddrPtr  = (DNSc_ADDR_OBJ *)DEF_NULL;
+        local_req_cfg.ServerPort     = NET_PORT_NBR_NONE;
+        local_req_cfg.ReqTimeout_ms  = DNSc_Cfg.ReqRetryTimeout_ms;
+        local_req_cfg.ReqDeadline_ms = 0u;
+        local_req_cfg.ReqRetry       = DNSc_Cfg.ReqRetryNbrMax;
+        local_req_cfg.ReqPrio        = DNSc_REQ_PRIO_NORMAL;
+        local_req_cfg.TaskDly_ms     = DNSc_Cfg.TaskDly_ms;
     }
 
     local_req_cfg.ReqFlags = DNSc_FLAG_NONE;
@@ -721,14 +848,26 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
                                                                 /*...reset DNSc request state machine.                  */
                          if (is_force_res == DEF_TRUE) {
                              DEF_BIT_SET(local_req_cfg.ReqFlags, DNSc_FLAG_RESET_REQ);
-                             p_host = DNScCache_HostObjGet(p_host_name, local_req_cfg.ReqFlags, &local_req_cfg, p_err);
+                             p_host = DNScCache_HostObjGet(p_host_name, local_req_cfg.ReqFlags, &local_req_cfg, &is_reused, p_err);
 
+                             if (*p_err == DNSc_ERR_CACHE_HOST_PENDING) {
+                                 status = DNSc_STATUS_PENDING;  /* Reset by another caller (see Note #10).              */
+                                 goto exit;
+                             }
                              if (*p_err != DNSc_ERR_NONE) {
                                  goto exit_free_host;
                              }
 
                              DEF_BIT_CLR(p_host->ReqCfgPtr->ReqFlags, DNSc_FLAG_RESET_REQ);
                              DEF_BIT_CLR(local_req_cfg.ReqFlags,      DNSc_FLAG_RESET_REQ);
+
+                             if (is_reused == DEF_NO) {
+                                 DNScCache_HostInsert(p_host, p_err);
+                                 if (*p_err != DNSc_ERR_NONE) {
+                                     status = DNSc_STATUS_FAILED;
+                                     goto exit_free_host;
+                                 }
+                             }
                          } else {
                              goto exit_copy_name;
                          }
@@ -748,6 +887,9 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
                  goto exit;
 
             case DNSc_STATUS_FAILED:
+                 if (*p_err == DNSc_ERR_CACHE_HOST_NO_FAMILY) { /* Resolve missing family in entry (see Note #9).       */
+                     DEF_BIT_SET(local_req_cfg.ReqFlags, DNSc_FLAG_RESET_REQ);
+                 }
                  break;
 
             default:
@@ -760,12 +902,29 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
     }
 
                                                                 /* ----------- ACQUIRE HOST OBJ FOR THE REQ ----------- */
-    p_host = DNScCache_HostObjGet(p_host_name, local_req_cfg.ReqFlags, &local_req_cfg, p_err);
+    p_host = DNScCache_HostObjGet(p_host_name, local_req_cfg.ReqFlags, &local_req_cfg, &is_reused, p_err);
+    if (*p_err == DNSc_ERR_CACHE_HOST_PENDING) {                /* Reset by another caller (see Note #10).              */
+         status = DNSc_STATUS_PENDING;
+         goto exit;
+    }
     if (*p_err != DNSc_ERR_NONE) {
          status = DNSc_STATUS_FAILED;
          goto exit;
     }
 
+    if (DEF_BIT_IS_SET(local_req_cfg.ReqFlags, DNSc_FLAG_RESET_REQ)) {
+        DEF_BIT_CLR(p_host->ReqCfgPtr->ReqFlags, DNSc_FLAG_RESET_REQ);
+        DEF_BIT_CLR(local_req_cfg.ReqFlags,      DNSc_FLAG_RESET_REQ);
+    }
+
+    if (is_reused == DEF_NO) {                                  /* Insert new host obj in the cache.                    */
+        DNScCache_HostInsert(p_host, p_err);
+        if (*p_err != DNSc_ERR_NONE) {
+            status = DNSc_STATUS_FAILED;
+            goto exit_free_host;
+        }
+    }
+
     status = DNScTask_HostResolve(p_host, local_req_cfg.ReqFlags, &local_req_cfg, p_err);
     if (*p_err != DNSc_ERR_NONE) {
          goto exit;
@@ -782,20 +941,20 @@ DNSc_STATUS  DNSc_GetHost (const  CPU_CHAR       *p_host_name,
         case DNSc_STATUS_UNKNOWN:
              break;
 
-        case DNSc_STATUS_FAILED:
-             goto exit_free_host;
+        case DNSc_STATUS_FAILED:                                /* Host already released by DNScTask_HostResolve().     */
+             goto exit;
 
         default:
             *p_err = DNSc_ERR_FAULT;
              goto exit;
     }
 
-    status = DNScCache_Srch( p_host_name,
+    status = DNScCache_Srch( p_host_name,                       /* Copy the answer; the lookup was already counted.     */
                             &p_host,
                              p_addrs,
                              addr_nbr,
                              p_addr_nbr,
-                             local_req_cfg.ReqFlags,
+                            (local_req_cfg.ReqFlags | DNSc_FLAG_NO_STATS),
                              p_err);
 
 
@@ -803,7 +962,7 @@ exit_copy_name:
 
     if (is_reverse == DEF_YES) {
         if (p_host->AddrsCount == 1u) {                         /* If only one resolved addr in host, set as preferred. */
-            p_host->AddrsFirstPtr->AddrPtr->RevPreferred = DEF_TRUE;
+            p_host->AddrsTblPtr[0].RevPreferred = DEF_TRUE;
         }
         if (p_host->State == DNSc_STATE_RESOLVED) {
             Str_Copy_N(p_res_host_name,                         /* Copy reverse lookup name. (See Note #1).             */
@@ -827,10 +986,68 @@ exit_free_host:
     DNScCache_HostObjFree(p_host);
 
 exit:
+#if (DNSc_CFG_ADDR_SORT_EN == DEF_ENABLED)
+                                                                /* Order the fwd lookup's addrs (see Note #7).          */
+    if ((status == DNSc_STATUS_RESOLVED)                &&
+        (DEF_BIT_IS_SET(flags, DNSc_FLAG_ADDR_SORT))    &&
+        (DEF_BIT_IS_CLR(flags, DNSc_FLAG_REVERSE_LOOKUP))) {
+        DNScAddr_Sort(p_addrs, *p_addr_nbr);
+    }
+#endif
     return (status);
 }
 
 
+/*
+*********************************************************************************************************
+*                                            DNSc_Cancel()
+*
+* Description : Cancel the pending resolution of a host.
+*
+* Argument(s) : p_host_name     Pointer to a string that contains the host name, as given to DNSc_GetHost().
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   DNSc_ERR_NONE           Resolution canceled, or already completed.
+*                                   DNSc_ERR_NULL_PTR       Invalid pointer.
+*                                   DNSc_ERR_INVALID_CFG    DNSc's task is not enabled.
+*
+*                                   RETURNED BY DNScCache_HostCancel():
+*                                       See DNScCache_HostCancel() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The request's socket & query ID are released right away, & the entry is left failed, as after
+*                   any other failed resolution: a later DNSc_GetHost() call for the name issues a new request.
+*
+*               (2) Only resolutions processed by DNSc's task can be canceled.
+*********************************************************************************************************
+*/
+
+void  DNSc_Cancel (const  CPU_CHAR  *p_host_name,
+                          DNSc_ERR  *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_host_name == DEF_NULL) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+#ifdef  DNSc_TASK_MODULE_EN
+    DNScCache_HostCancel(p_host_name, p_err);
+#else
+   *p_err = DNSc_ERR_INVALID_CFG;                               /* See Note #2.                                         */
+#endif
+}
+
+
 /*
 *********************************************************************************************************
 *                                            DNSc_CacheClr()
@@ -883,3 +1100,487 @@ void  DNSc_CacheClrHost (CPU_CHAR  *p_host_name,
     DNScCache_HostSrchRemove(p_host_name, p_err);
 }
 
+
+
+/*
+*********************************************************************************************************
+*                                         DNSc_CacheStatsGet()
+*
+* Description : Get the cache statistics.
+*
+* Argument(s) : p_stats     Pointer to the structure that will receive the statistics.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NULL_PTR       Invalid pointer.
+*
+*                               RETURNED BY DNScCache_StatsGet():
+*                                   See DNScCache_StatsGet() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Counters wrap around once they reach their maximum value.
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheStatsGet (DNSc_CACHE_STATS  *p_stats,
+                          DNSc_ERR          *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_stats == DEF_NULL) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    DNScCache_StatsGet(p_stats, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNSc_CacheStatsReset()
+*
+* Description : Reset the cache statistics.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               RETURNED BY DNScCache_StatsReset():
+*                                   See DNScCache_StatsReset() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The current number of entries is kept & becomes the new peak number of entries.
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheStatsReset (DNSc_ERR  *p_err)
+{
+    DNScCache_StatsReset(p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DNSc_ResolverStatsGet()
+*
+* Description : Get the resolver statistics: request, retransmission & timeout counters, error counters &
+*               response latency histograms per query type & per server.
+*
+* Argument(s) : p_stats     Pointer to the structure that will receive the statistics.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NULL_PTR       Invalid pointer.
+*
+*                               RETURNED BY DNScCache_ResolverStatsGet():
+*                                   See DNScCache_ResolverStatsGet() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The latency of a response is measured from the transmission of the request it answers. Use
+*                   DNSc_StatsLatPctGet() to get percentiles from a histogram.
+*
+*               (2) .Errs[] is indexed by DNSc_STATS_ERR value: use DNSc_StatsErrIxGet() to get the counter of an
+*                   error code, & DNSc_StatsErrGet() to get the error code of a counter.
+*********************************************************************************************************
+*/
+
+void  DNSc_ResolverStatsGet (DNSc_RESOLVER_STATS  *p_stats,
+                             DNSc_ERR             *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_stats == DEF_NULL) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    DNScCache_ResolverStatsGet(p_stats, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNSc_ResolverStatsReset()
+*
+* Description : Reset the resolver statistics.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               RETURNED BY DNScCache_ResolverStatsReset():
+*                                   See DNScCache_ResolverStatsReset() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The servers already seen keep their slot in the statistics.
+*********************************************************************************************************
+*/
+
+void  DNSc_ResolverStatsReset (DNSc_ERR  *p_err)
+{
+    DNScCache_ResolverStatsReset(p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNSc_StatsLatAdd()
+*
+* Description : Add a latency sample to a latency histogram.
+*
+* Argument(s) : p_hist      Pointer to the histogram.
+*
+*               lat_ms      Latency, in milliseconds.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_Resp(),
+*               Application.
+*
+* Note(s)     : (1) Bucket 0 holds the latencies under 1 ms, & bucket n the latencies in [2^(n-1), 2^n) ms. The
+*                   last bucket also holds all the latencies above its lower bound.
+*********************************************************************************************************
+*/
+
+void  DNSc_StatsLatAdd (DNSc_LAT_HIST  *p_hist,
+                        CPU_INT32U      lat_ms)
+{
+    CPU_INT32U  val = lat_ms;
+    CPU_INT08U  ix  = 0u;
+
+
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_hist == DEF_NULL) {
+        return;
+    }
+#endif
+
+    while ((val != 0u) &&                                       /* See Note #1.                                         */
+           (ix  < (DNSc_STATS_LAT_BUCKET_NBR - 1u))) {
+        val >>= 1u;
+        ix++;
+    }
+
+    p_hist->Buckets[ix]++;
+    p_hist->Nbr++;
+    if (lat_ms > p_hist->Max_ms) {
+        p_hist->Max_ms = lat_ms;
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNSc_StatsLatPctGet()
+*
+* Description : Get a percentile of a latency histogram.
+*
+* Argument(s) : p_hist      Pointer to the histogram.
+*
+*               pct         Percentile, between 1 & 100.
+*
+* Return(s)   : Upper bound, in milliseconds, of the bucket holding the percentile (see Note #1).
+*
+*               0, if the histogram is empty.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Bucket 0 holds the latencies under 1 ms, & bucket n the latencies in [2^(n-1), 2^n) ms. The
+*                   returned value is bounded by the highest latency of the histogram, which is also returned
+*                   for the last bucket since it has no upper bound.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  DNSc_StatsLatPctGet (const  DNSc_LAT_HIST  *p_hist,
+                                        CPU_INT08U      pct)
+{
+    CPU_INT32U  rank;
+    CPU_INT32U  nbr;
+    CPU_INT32U  lat_ms = 0u;
+    CPU_INT08U  ix;
+
+
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_hist == DEF_NULL) {
+        return (0u);
+    }
+#endif
+
+    if (p_hist->Nbr == 0u) {
+        goto exit;
+    }
+
+    pct  = DEF_MIN(pct, 100u);
+    rank = (CPU_INT32U)(((CPU_INT64U)p_hist->Nbr * pct + 99u) / 100u);
+    if (rank == 0u) {
+        rank = 1u;
+    }
+
+    nbr = 0u;
+    for (ix = 0u; ix < DNSc_STATS_LAT_BUCKET_NBR; ix++) {
+        nbr += p_hist->Buckets[ix];
+        if (nbr >= rank) {
+            break;
+        }
+    }
+
+    if (ix == 0u) {                                             /* See Note #1.                                         */
+        lat_ms = 0u;
+    } else if (ix >= (DNSc_STATS_LAT_BUCKET_NBR - 1u)) {
+        lat_ms = p_hist->Max_ms;
+    } else {
+        lat_ms = DEF_MIN((1u << ix) - 1u, p_hist->Max_ms);
+    }
+
+exit:
+    return (lat_ms);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNSc_StatsErrIxGet()
+*
+* Description : Get the error counter of an error code, in the resolver statistics.
+*
+* Argument(s) : err         Error code.
+*
+* Return(s)   : Index of the counter in .Errs[] (see DNSc_ResolverStatsGet() Note #2).
+*
+* Caller(s)   : DNScCache_Resolve(),
+*               Application.
+*
+* Note(s)     : (1) Only the errors that end a resolution have their own counter; any other error code is
+*                   counted in DNSc_STATS_ERR_OTHER.
+*********************************************************************************************************
+*/
+
+DNSc_STATS_ERR  DNSc_StatsErrIxGet (DNSc_ERR  err)
+{
+    CPU_INT08U  ix;
+
+
+    for (ix = 0u; ix < DNSc_STATS_ERR_OTHER; ix++) {
+        if (DNSc_StatsErrTbl[ix] == err) {
+            break;
+        }
+    }
+
+    return ((DNSc_STATS_ERR)ix);                                /* See Note #1.                                         */
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNSc_StatsErrGet()
+*
+* Description : Get the error code of an error counter, in the resolver statistics.
+*
+* Argument(s) : ix          Index of the counter in .Errs[] (see DNSc_ResolverStatsGet() Note #2).
+*
+* Return(s)   : Error code counted,
+*
+*               DNSc_ERR_NONE, for DNSc_STATS_ERR_OTHER or an invalid index.
+*
+* Caller(s)   : DNScCmd_Stats(),
+*               Application.
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+DNSc_ERR  DNSc_StatsErrGet (DNSc_STATS_ERR  ix)
+{
+    if (ix >= DNSc_STATS_ERR_OTHER) {
+        return (DNSc_ERR_NONE);
+    }
+
+    return (DNSc_StatsErrTbl[ix]);
+}
+
+
+
+/*
+*********************************************************************************************************
+*                                         DNSc_CacheEntryGet()
+*
+* Description : Get a copy of a cache entry, to list the content of the cache.
+*
+* Argument(s) : ix              Index of the entry, starting at 0.
+*
+*               p_name          Pointer to the buffer that will receive the host name.
+*
+*               name_len_max    Size of the host name buffer.
+*
+*               p_state         Pointer to a variable that will receive the state of the entry.
+*
+*               p_ttl_ms        Pointer to a variable that will receive the remaining TTL of the entry, in ms.
+*
+*               p_addrs         Pointer to the table that will receive the addresses of the entry.
+*
+*               p_addr_nbr      Pointer to a variable that contains the number of addresses that the table can
+*                               hold & that will receive the number of addresses copied.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   DNSc_ERR_NULL_PTR       Invalid pointer.
+*                                   DNSc_ERR_INVALID_ARG    Invalid argument.
+*
+*                                   RETURNED BY DNScCache_EntryGet():
+*                                       See DNScCache_EntryGet() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) Call with increasing indexes until DNSc_ERR_CACHE_HOST_NOT_FOUND is returned.
+*
+*               (2) Addresses are returned as by DNSc_GetHost().
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheEntryGet (CPU_INT16U      ix,
+                          CPU_CHAR       *p_name,
+                          CPU_INT16U      name_len_max,
+                          DNSc_STATE     *p_state,
+                          CPU_INT32U     *p_ttl_ms,
+                          DNSc_ADDR_OBJ  *p_addrs,
+                          CPU_INT08U     *p_addr_nbr,
+                          DNSc_ERR       *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if ((p_name     == DEF_NULL) ||
+        (p_state    == DEF_NULL) ||
+        (p_ttl_ms   == DEF_NULL) ||
+        (p_addrs    == DEF_NULL) ||
+        (p_addr_nbr == DEF_NULL)) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+
+    if (name_len_max == 0u) {
+       *p_err = DNSc_ERR_INVALID_ARG;
+        return;
+    }
+#endif
+
+    DNScCache_EntryGet(ix, p_name, name_len_max, p_state, p_ttl_ms, p_addrs, p_addr_nbr, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNSc_CacheExport()
+*
+* Description : Save the resolved entries of the cache, with their remaining TTL, in a buffer.
+*
+* Argument(s) : p_buf       Pointer to the buffer that will receive the cache entries.
+*
+*               buf_len     Length of the buffer.
+*
+*               p_len_rtn   Pointer to a variable that will receive the length of the data written in the buffer.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NULL_PTR       Invalid pointer.
+*
+*                               RETURNED BY DNScCache_Export():
+*                                   See DNScCache_Export() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The data can be stored by the application (e.g. in flash) & restored after a restart using
+*                   DNSc_CacheImport().
+*
+*               (2) Each entry takes 7 octets, plus the length of its name, plus 1 octet & the length of each
+*                   of its addresses. The header takes 8 octets.
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheExport (CPU_INT08U  *p_buf,
+                        CPU_SIZE_T   buf_len,
+                        CPU_SIZE_T  *p_len_rtn,
+                        DNSc_ERR    *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if ((p_buf     == DEF_NULL) ||
+        (p_len_rtn == DEF_NULL)) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    DNScCache_Export(p_buf, buf_len, p_len_rtn, p_err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNSc_CacheImport()
+*
+* Description : Restore in the cache the entries saved by DNSc_CacheExport().
+*
+* Argument(s) : p_buf       Pointer to the data returned by DNSc_CacheExport().
+*
+*               buf_len     Length of the data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NULL_PTR       Invalid pointer.
+*
+*                               RETURNED BY DNScCache_Import():
+*                                   See DNScCache_Import() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Application.
+*
+* Note(s)     : (1) The remaining TTL of every entry restarts from the moment this function is called. Time
+*                   elapsed while the data was stored is not accounted for.
+*********************************************************************************************************
+*/
+
+void  DNSc_CacheImport (const  CPU_INT08U  *p_buf,
+                               CPU_SIZE_T   buf_len,
+                               DNSc_ERR    *p_err)
+{
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if (p_err == DEF_NULL) {
+        CPU_SW_EXCEPTION(DEF_NULL);
+    }
+
+    if (p_buf == DEF_NULL) {
+       *p_err = DNSc_ERR_NULL_PTR;
+        return;
+    }
+#endif
+
+    DNScCache_Import(p_buf, buf_len, p_err);
+}
@@ -183,6 +183,46 @@
 #endif
 
 
+#ifndef  DNSc_CFG_CACHE_SLAB_EN
+    #error  "DNSc_CFG_CACHE_SLAB_EN not #define'd in 'dns-c_cfg.h' [MUST be  DEF_DISABLED ||  DEF_ENABLED ] "
+#elif  ((DNSc_CFG_CACHE_SLAB_EN != DEF_ENABLED ) && \
+        (DNSc_CFG_CACHE_SLAB_EN != DEF_DISABLED))
+    #error  "DNSc_CFG_CACHE_SLAB_EN not #define'd in 'dns-c_cfg.h' [MUST be  DEF_DISABLED ||  DEF_ENABLED ] "
+#endif
+
+#ifndef  DNSc_CFG_ADDR_SORT_EN
+    #error  "DNSc_CFG_ADDR_SORT_EN not #define'd in 'dns-c_cfg.h' [MUST be  DEF_DISABLED ||  DEF_ENABLED ] "
+#elif  ((DNSc_CFG_ADDR_SORT_EN != DEF_ENABLED ) && \
+        (DNSc_CFG_ADDR_SORT_EN != DEF_DISABLED))
+    #error  "DNSc_CFG_ADDR_SORT_EN not #define'd in 'dns-c_cfg.h' [MUST be  DEF_DISABLED ||  DEF_ENABLED ] "
+#endif
+
+#ifndef  DNSc_CFG_CACHE_FRONT_NBR_ENTRIES
+    #error  "DNSc_CFG_CACHE_FRONT_NBR_ENTRIES not #define'd in 'dns-c_cfg.h' [MUST be  >= 0 ] "
+#endif
+
+#ifndef  DNSc_CFG_REQ_PRIO_LOW_NBR_MAX
+    #error  "DNSc_CFG_REQ_PRIO_LOW_NBR_MAX not #define'd in 'dns-c_cfg.h' [MUST be  >= 0 ] "
+#endif
+
+#ifndef  DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX
+    #error  "DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX not #define'd in 'dns-c_cfg.h' [MUST be  >= 0 ] "
+#endif
+
+#ifndef  DNSc_CFG_REQ_SERVER_QPS_MAX
+    #error  "DNSc_CFG_REQ_SERVER_QPS_MAX not #define'd in 'dns-c_cfg.h' [MUST be  >= 0 && <= 1000000 ] "
+#elif   (DNSc_CFG_REQ_SERVER_QPS_MAX > 1000000u)
+    #error  "DNSc_CFG_REQ_SERVER_QPS_MAX illegally #define'd in 'dns-c_cfg.h' [MUST be  >= 0 && <= 1000000 ] "
+#endif
+
+#ifndef  DNSc_CFG_STATS_SERVER_NBR_MAX
+    #error  "DNSc_CFG_STATS_SERVER_NBR_MAX not #define'd in 'dns-c_cfg.h' [MUST be  >= 1 && < 255 ] "
+#elif  ((DNSc_CFG_STATS_SERVER_NBR_MAX <   1u) || \
+        (DNSc_CFG_STATS_SERVER_NBR_MAX > 254u))
+    #error  "DNSc_CFG_STATS_SERVER_NBR_MAX illegally #define'd in 'dns-c_cfg.h' [MUST be  >= 1 && < 255 ] "
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -219,6 +259,16 @@
 #define  DNSc_FLAG_CANON                           DEF_BIT_07
 #define  DNSc_FLAG_RESET_REQ                       DEF_BIT_08
 #define  DNSc_FLAG_UPDATE_PREF                     DEF_BIT_09
+#define  DNSc_FLAG_NO_STATS                        DEF_BIT_10
+#define  DNSc_FLAG_ADDR_SORT                       DEF_BIT_11
+#define  DNSc_FLAG_PARTIAL                         DEF_BIT_12
+
+#define  DNSc_FAMILY_NONE                          DEF_BIT_NONE /* Addr families of a host (see .FamReq & .FamDone).    */
+#define  DNSc_FAMILY_IPv4                          DEF_BIT_00
+#define  DNSc_FAMILY_IPv6                          DEF_BIT_01
+
+#define  DNSc_STATS_LAT_BUCKET_NBR                   16u        /* Bucket n > 0 holds latencies in [2^(n-1), 2^n) ms.   */
+#define  DNSc_STATS_SERVER_IX_NONE                  255u
 
 
 /*
@@ -247,6 +297,7 @@ typedef  enum  DNSc_err {
     DNSc_ERR_CACHE_HOST_NOT_FOUND =  31,
     DNSc_ERR_CACHE_HOST_PENDING   =  32,
     DNSc_ERR_CACHE_HOST_FAILED    =  33,
+    DNSc_ERR_CACHE_HOST_NO_FAMILY =  34,
 
     DNSc_ERR_NO_SERVER            =  50,
     DNSc_ERR_GIVING_UP            =  51,
@@ -256,6 +307,8 @@ typedef  enum  DNSc_err {
     DNSc_ERR_NOT_A_RESPONSE       =  55,
     DNSc_ERR_RESOLUTION_FAIL      =  56,
     DNSc_ERR_NO_RESPONSE          =  57,
+    DNSc_ERR_DEADLINE             =  58,
+    DNSc_ERR_CANCELED             =  59,
 
     DNSc_ERR_SOCK_OPEN_FAIL       =  70,
     DNSc_ERR_SOCK_CONN_FAIL       =  71,
@@ -316,13 +369,6 @@ typedef  struct  dnsc_ip_addr {
     CPU_BOOLEAN  RevPreferred;
 } DNSc_ADDR_OBJ;
 
-typedef  struct  DNSc_addr_item   DNSc_ADDR_ITEM;
-
-struct  DNSc_addr_item {
-    DNSc_ADDR_OBJ   *AddrPtr;
-    DNSc_ADDR_ITEM  *NextPtr;
-};
-
 typedef  enum  dnsc_req_type {
     DNSc_REQ_TYPE_NONE,
     DNSc_REQ_TYPE_IPv4,
@@ -332,12 +378,22 @@ typedef  enum  dnsc_req_type {
 } DNSc_REQ_TYPE;
 
 
+typedef  enum  dnsc_req_prio {                                  /* Serviced in the order HIGH, NORMAL, LOW.             */
+    DNSc_REQ_PRIO_NORMAL = 0,                                   /* Dflt, also for a zero-initialized DNSc_REQ_CFG.      */
+    DNSc_REQ_PRIO_HIGH,
+    DNSc_REQ_PRIO_LOW,                                          /* See 'dns-c_cfg.h  DNSc_CFG_REQ_PRIO_LOW_NBR_MAX'.    */
+    DNSc_REQ_PRIO_NBR
+} DNSc_REQ_PRIO;
+
+
 typedef  struct  DNSc_req_cfg {
     DNSc_ADDR_OBJ  *ServerAddrPtr;
     NET_PORT_NBR    ServerPort;
     CPU_INT16U      TaskDly_ms;
     CPU_INT16U      ReqTimeout_ms;
+    CPU_INT32U      ReqDeadline_ms;                             /* Overall time allowed to the req, 0 for none.         */
     CPU_INT08U      ReqRetry;
+    DNSc_REQ_PRIO   ReqPrio;                                    /* Priority of the req in DNSc's task.                  */
     DNSc_REQ_TYPE   ReqType;
     DNSc_FLAGS      ReqFlags;
 } DNSc_REQ_CFG;
@@ -348,9 +404,12 @@ typedef  struct  DNSc_host {
     CPU_CHAR        *CanonicalNamePtr;
     CPU_CHAR        *ReverseNamePtr;
     CPU_INT16U       NameLenMax;
+    CPU_INT16U       NameLen;                                   /* Len of .NamePtr, set w/ the name.                    */
+    CPU_INT32U       NameHash;                                  /* Case-folded hash of .NamePtr, set w/ the name.       */
     DNSc_STATE       State;
-    DNSc_ADDR_ITEM  *AddrsFirstPtr;
-    DNSc_ADDR_ITEM  *AddrsEndPtr;
+    DNSc_ADDR_OBJ   *AddrsTblPtr;                               /* Contiguous tbl of resolved addrs (IPv4 & IPv6).      */
+    CPU_INT08U      *QueryMsgPtr;                               /* Query msg, encoded once per resolution.              */
+    CPU_INT16U       QueryMsgLen;                               /* Len of .QueryMsgPtr, 0 until encoded.                */
     CPU_INT08U       AddrsCount;
     CPU_INT08U       AddrsIPv4Count;
     CPU_INT08U       AddrsIPv6Count;
@@ -358,14 +417,105 @@ typedef  struct  DNSc_host {
     NET_SOCK_ID      SockID;
     NET_IF_NBR       IF_Nbr;
     CPU_INT16U       QueryID;
-    NET_TS_MS        TS_ms;
+    NET_TS_MS        TS_ms;                                     /* TS of last req tx, or of resolution once resolved.   */
+    NET_TS_MS        ReqTS_ms;                                  /* TS the req was issued at, for .ReqDeadline_ms.       */
+    CPU_INT08U       ServerStatsIx;                             /* Ix of the server in the resolver stats.              */
+    CPU_INT32U       TTL_s;                                     /* Lowest TTL of the answers, in seconds.               */
+    CPU_BOOLEAN      PartialAvail;                              /* IPv4 addrs avail while the IPv6 query is pending.    */
+    CPU_INT08U       FamReq;                                    /* Addr families requested (DNSc_FAMILY_xxx).           */
+    CPU_INT08U       FamDone;                                   /* Addr families resolved, w/ or w/o addrs.             */
     DNSc_REQ_CFG    *ReqCfgPtr;
 #ifdef  DNSc_SIGNAL_TASK_MODULE_EN
     KAL_SEM_HANDLE   TaskSignal;
 #endif
+#ifdef  DNSc_TASK_MODULE_EN
+    struct  DNSc_host  *PendPrevPtr;                            /* Links in the list of hosts being resolved ...        */
+    struct  DNSc_host  *PendNextPtr;                            /* ... (see 'dns-c_cache.c  DNScCache_PendLink()').     */
+    CPU_BOOLEAN         PendLinked;
+    DNSc_REQ_PRIO       PendPrio;                               /* Pending list the host is linked in.                  */
+    CPU_BOOLEAN         PendInFlight;                           /* Req past DNSc_STATE_INIT_REQ, not completed yet.     */
+#endif
 } DNSc_HOST_OBJ;
 
 
+typedef  struct  dnsc_cache_stats {
+    CPU_INT32U       Hits;                                      /* Lookups answered by a resolved cache entry.          */
+    CPU_INT32U       FrontHits;                                 /* Lookups answered by the front cache.                 */
+    CPU_INT32U       PendingHits;                               /* Lookups of an entry being resolved.                  */
+    CPU_INT32U       Misses;                                    /* Lookups of a missing, expired or failed entry.       */
+    CPU_INT32U       Expirations;                               /* Entries removed because their TTL expired.           */
+    CPU_INT32U       Evictions;                                 /* Entries reused for another host when cache is full.  */
+    CPU_INT32U       AllocFailHost;                             /* Alloc failures of host objects (or slab slots).      */
+    CPU_INT32U       AllocFailName;                             /* Alloc failures of host names.                        */
+    CPU_INT32U       AllocFailCanonName;                        /* Alloc failures of canonical names.                   */
+    CPU_INT32U       AllocFailRevName;                          /* Alloc failures of reverse names.                     */
+    CPU_INT32U       AllocFailReqCfg;                           /* Alloc failures of request configurations.            */
+    CPU_INT32U       AllocFailItem;                             /* Alloc failures of cache list items.                  */
+    CPU_INT16U       EntriesCur;                                /* Nbr of entries currently in the cache.               */
+    CPU_INT16U       EntriesPeak;                               /* Highest nbr of entries since init or last reset.     */
+    CPU_INT16U       EntriesMax;                                /* Cfg'd max nbr of entries.                            */
+} DNSc_CACHE_STATS;
+
+
+typedef  enum  dnsc_stats_qtype {
+    DNSc_STATS_QTYPE_A = 0,
+    DNSc_STATS_QTYPE_AAAA,
+    DNSc_STATS_QTYPE_PTR,
+    DNSc_STATS_QTYPE_NBR
+} DNSc_STATS_QTYPE;
+
+
+typedef  enum  dnsc_stats_err {                                 /* Ix of the error counters (see DNSc_StatsErrIxGet()). */
+    DNSc_STATS_ERR_NO_SERVER = 0,
+    DNSc_STATS_ERR_DEADLINE,
+    DNSc_STATS_ERR_CANCELED,
+    DNSc_STATS_ERR_NAME_NOT_EXIST,
+    DNSc_STATS_ERR_SERVER_FAIL,
+    DNSc_STATS_ERR_FMT,
+    DNSc_STATS_ERR_NOT_A_RESPONSE,
+    DNSc_STATS_ERR_NO_RESPONSE,
+    DNSc_STATS_ERR_BAD_RESPONSE_TYPE,
+    DNSc_STATS_ERR_BAD_QUESTION_COUNT,
+    DNSc_STATS_ERR_BAD_RESPONSE_ID,
+    DNSc_STATS_ERR_SOCK_OPEN_FAIL,
+    DNSc_STATS_ERR_TX,
+    DNSc_STATS_ERR_TX_FAULT,
+    DNSc_STATS_ERR_RX_FAULT,
+    DNSc_STATS_ERR_IF_LINK_DOWN,
+    DNSc_STATS_ERR_BUF_LEN,
+    DNSc_STATS_ERR_MEM_ALLOC,
+    DNSc_STATS_ERR_INVALID_HOST_NAME,
+    DNSc_STATS_ERR_OTHER,                                       /* Any other error code.                                */
+    DNSc_STATS_ERR_NBR
+} DNSc_STATS_ERR;
+
+
+typedef  struct  dnsc_lat_hist {
+    CPU_INT32U       Buckets[DNSc_STATS_LAT_BUCKET_NBR];        /* Nbr of resp per latency bucket.                      */
+    CPU_INT32U       Nbr;                                       /* Total nbr of resp.                                   */
+    CPU_INT32U       Max_ms;                                    /* Highest latency, in ms.                              */
+} DNSc_LAT_HIST;
+
+
+typedef  struct  dnsc_server_stats {
+    DNSc_ADDR_OBJ    Addr;                                      /* Server addr, .Len is 0 if the slot is unused.        */
+    CPU_INT32U       Req;                                       /* Nbr of req tx'd, including retransmissions.          */
+    CPU_INT32U       ReTx;                                      /* Nbr of retransmissions.                              */
+    CPU_INT32U       Timeouts;                                  /* Nbr of req that timed out.                           */
+    DNSc_LAT_HIST    Lat;                                       /* Latency of the resp rx'd from the server.            */
+} DNSc_SERVER_STATS;
+
+
+typedef  struct  dnsc_resolver_stats {
+    CPU_INT32U         Req;                                     /* Nbr of req tx'd, including retransmissions.          */
+    CPU_INT32U         ReTx;                                    /* Nbr of retransmissions.                              */
+    CPU_INT32U         Timeouts;                                /* Nbr of req that timed out.                           */
+    CPU_INT32U         Errs[DNSc_STATS_ERR_NBR];                /* Nbr of resolution errors, indexed by DNSc_STATS_ERR. */
+    DNSc_LAT_HIST      QTypeLat[DNSc_STATS_QTYPE_NBR];          /* Latency per query type.                              */
+    DNSc_SERVER_STATS  Servers[DNSc_CFG_STATS_SERVER_NBR_MAX];
+} DNSc_RESOLVER_STATS;
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -400,10 +550,51 @@ DNSc_STATUS  DNSc_GetHost         (const  CPU_CHAR       *p_host_name,
                                           DNSc_REQ_CFG   *p_cfg,
                                           DNSc_ERR       *p_err);
 
+void         DNSc_Cancel          (const  CPU_CHAR       *p_host_name,
+                                          DNSc_ERR       *p_err);
+
 void         DNSc_CacheClrAll     (       DNSc_ERR       *p_err);
 
 void         DNSc_CacheClrHost    (       CPU_CHAR       *p_host_name,
                                           DNSc_ERR       *p_err);
 
+void         DNSc_CacheStatsGet   (       DNSc_CACHE_STATS *p_stats,
+                                          DNSc_ERR       *p_err);
+
+void         DNSc_CacheStatsReset (       DNSc_ERR       *p_err);
+
+void         DNSc_ResolverStatsGet(       DNSc_RESOLVER_STATS *p_stats,
+                                          DNSc_ERR       *p_err);
+
+void         DNSc_ResolverStatsReset(     DNSc_ERR       *p_err);
+
+void         DNSc_StatsLatAdd     (       DNSc_LAT_HIST  *p_hist,
+                                          CPU_INT32U      lat_ms);
+
+CPU_INT32U   DNSc_StatsLatPctGet  (const  DNSc_LAT_HIST  *p_hist,
+                                          CPU_INT08U      pct);
+
+DNSc_STATS_ERR  DNSc_StatsErrIxGet(       DNSc_ERR        err);
+
+DNSc_ERR     DNSc_StatsErrGet     (       DNSc_STATS_ERR  ix);
+
+void         DNSc_CacheEntryGet   (       CPU_INT16U      ix,
+                                          CPU_CHAR       *p_name,
+                                          CPU_INT16U      name_len_max,
+                                          DNSc_STATE     *p_state,
+                                          CPU_INT32U     *p_ttl_ms,
+                                          DNSc_ADDR_OBJ  *p_addrs,
+                                          CPU_INT08U     *p_addr_nbr,
+                                          DNSc_ERR       *p_err);
+
+void         DNSc_CacheExport     (       CPU_INT08U     *p_buf,
+                                          CPU_SIZE_T      buf_len,
+                                          CPU_SIZE_T     *p_len_rtn,
+                                          DNSc_ERR       *p_err);
+
+void         DNSc_CacheImport     (const  CPU_INT08U     *p_buf,
+                                          CPU_SIZE_T      buf_len,
+                                          DNSc_ERR       *p_err);
+
 #endif
 
@@ -0,0 +1,760 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                   DNS CLIENT ADDRESS SELECTION MODULE
+*
+* Filename : dns-c_addr.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file orders the addresses returned for a host so that a connection tries the best
+*                destination first, following the destination address selection rules of RFC #6724,
+*                Section 6, against the addresses of the local interfaces. The families are then
+*                interleaved, as recommended for connection racing by RFC #8305, Section 4.
+*
+*            (2) Assumes the following versions (or more recent) of software modules are included
+*                in the project build :
+*
+*                (a) uC/LIB    V1.37
+*                (b) uC/TCPIP  V3.00.00
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "dns-c_addr.h"
+#include  <IF/net_if.h>
+#ifdef  NET_IPv4_MODULE_EN
+#include  <IP/IPv4/net_ipv4.h>
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+#include  <IP/IPv6/net_ipv6.h>
+#endif
+#include  <lib_mem.h>
+
+
+#if (DNSc_CFG_ADDR_SORT_EN == DEF_ENABLED)
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_ADDR_SORT_NBR_MAX                           16u   /* See DNScAddr_Sort() Note #3.                         */
+#define  DNSc_ADDR_SRC_NBR_MAX                             8u   /* Max nbr of local addrs per family.                   */
+
+#define  DNSc_ADDR_MAPPED_LEN                             16u   /* See 'ADDRESS KEY DEFINES' Note #2.                   */
+
+#define  DNSc_ADDR_SCOPE_LINK_LOCAL                     0x02u
+#define  DNSc_ADDR_SCOPE_SITE_LOCAL                     0x05u
+#define  DNSc_ADDR_SCOPE_GLOBAL                         0x0Eu
+
+
+/*
+*********************************************************************************************************
+*                                         ADDRESS KEY DEFINES
+*
+* Note(s) : (1) The rules of RFC #6724, Section 6 that apply to a destination alone are folded in a key, so
+*               that a higher key is a better destination:
+*
+*                   Rule 1 : Avoid unusable destinations   .USABLE       A local addr of the family exists.
+*                   Rule 2 : Prefer matching scope         .SCOPE_MATCH  Same scope as its src addr.
+*                   Rule 5 : Prefer matching label         .LABEL_MATCH  Same label as its src addr.
+*                   Rule 6 : Prefer higher precedence      .PREC         Precedence of the policy table.
+*                   Rule 8 : Prefer smaller scope          .SCOPE        0xF minus the scope.
+*                   Rule 9 : Use longest matching prefix   .PREFIX       Bits in common w/ its src addr.
+*
+*               Rules 3, 4 & 7 (deprecated, home & native addresses) are not known to DNSc & are skipped.
+*               Rule 9 only orders two IPv6 destinations; rule 10 leaves the others in their order.
+*
+*           (2) IPv4 addresses are mapped to IPv6 (::ffff:0:0/96) to be looked up in the policy table, so
+*               that both families are ranked together (see RFC #6724, Section 2.1).
+*********************************************************************************************************
+*/
+
+#define  DNSc_ADDR_KEY_USABLE                     0x80000000u
+#define  DNSc_ADDR_KEY_SCOPE_MATCH                0x40000000u
+#define  DNSc_ADDR_KEY_LABEL_MATCH                0x20000000u
+#define  DNSc_ADDR_KEY_PREC_SHIFT                         16u
+#define  DNSc_ADDR_KEY_SCOPE_SHIFT                         8u
+#define  DNSc_ADDR_KEY_PREFIX_MASK                0x000000FFu
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                         POLICY ENTRY DATA TYPE
+*
+* Note(s) : (1) See RFC #6724, Section 2.1.
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_addr_policy {
+    CPU_INT08U  Prefix[DNSc_ADDR_MAPPED_LEN];
+    CPU_INT08U  PrefixLen;                                      /* Prefix len, in bits.                                 */
+    CPU_INT08U  Prec;
+    CPU_INT08U  Label;
+} DNSc_ADDR_POLICY;
+
+
+/*
+*********************************************************************************************************
+*                                     LOCAL ADDRESSES DATA TYPE
+*
+* Note(s) : (1) Addresses of every configured interface, as returned by uC/TCP-IP. IPv4 addresses are in
+*               host order.
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_addr_src_tbl {
+#ifdef  NET_IPv4_MODULE_EN
+    NET_IPv4_ADDR     IPv4Tbl[DNSc_ADDR_SRC_NBR_MAX];
+    NET_IP_ADDRS_QTY  IPv4Nbr;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    NET_IPv6_ADDR     IPv6Tbl[DNSc_ADDR_SRC_NBR_MAX];
+    NET_IP_ADDRS_QTY  IPv6Nbr;
+#endif
+} DNSc_ADDR_SRC_TBL;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  const  DNSc_ADDR_POLICY  DNScAddr_PolicyTbl[] = {       /* Dflt policy tbl (see RFC #6724, Section 2.1).        */
+    {{0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* ::1/128                                              */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x01u}, 128u, 50u,  0u},
+    {{0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* ::/0                                                 */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},   0u, 40u,  1u},
+    {{0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* ::ffff:0:0/96                                        */
+      0x00u, 0x00u, 0xFFu, 0xFFu, 0x00u, 0x00u, 0x00u, 0x00u},  96u, 35u,  4u},
+    {{0x20u, 0x02u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* 2002::/16                                            */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},  16u, 30u,  2u},
+    {{0x20u, 0x01u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* 2001::/32                                            */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},  32u,  5u,  5u},
+    {{0xFCu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* fc00::/7                                             */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},   7u,  3u, 13u},
+    {{0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* ::/96                                                */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},  96u,  1u,  3u},
+    {{0xFEu, 0xC0u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* fec0::/10                                            */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},  10u,  1u, 11u},
+    {{0x3Fu, 0xFEu, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u,   /* 3ffe::/16                                            */
+      0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u, 0x00u},  16u,  1u, 12u}
+};
+
+#define  DNSc_ADDR_POLICY_NBR          (sizeof(DNScAddr_PolicyTbl) / sizeof(DNScAddr_PolicyTbl[0]))
+
+#define  DNSc_ADDR_POLICY_IX_LOOPBACK                      0u   /* ::1/128.                                             */
+#define  DNSc_ADDR_POLICY_IX_DFLT                          1u   /* ::/0.                                                */
+#define  DNSc_ADDR_POLICY_IX_IPv4                          2u   /* ::ffff:0:0/96.                                       */
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  void                     DNScAddr_SrcTblGet  (       DNSc_ADDR_SRC_TBL  *p_src_tbl);
+
+static  CPU_BOOLEAN              DNScAddr_SrcGet     (const  DNSc_ADDR_SRC_TBL  *p_src_tbl,
+                                                             CPU_INT08U          len,
+                                                             CPU_INT08U          ix,
+                                                             CPU_INT08U         *p_mapped);
+
+static  CPU_INT32U               DNScAddr_KeyGet     (const  DNSc_ADDR_OBJ      *p_addr,
+                                                      const  DNSc_ADDR_SRC_TBL  *p_src_tbl);
+
+static  CPU_BOOLEAN              DNScAddr_KeyIsBefore(       CPU_INT32U          key_1,
+                                                             CPU_INT08U          len_1,
+                                                             CPU_INT32U          key_2,
+                                                             CPU_INT08U          len_2);
+
+static  void                     DNScAddr_Map        (const  DNSc_ADDR_OBJ      *p_addr,
+                                                             CPU_INT08U         *p_mapped);
+
+static  CPU_INT08U               DNScAddr_ScopeGet   (const  CPU_INT08U         *p_mapped);
+
+static  const  DNSc_ADDR_POLICY *DNScAddr_PolicyGet  (const  CPU_INT08U         *p_mapped);
+
+static  CPU_INT08U               DNScAddr_PrefixLenGet(const CPU_INT08U         *p_mapped_1,
+                                                      const  CPU_INT08U         *p_mapped_2);
+
+
+/*
+*********************************************************************************************************
+*                                           DNScAddr_Sort()
+*
+* Description : Order the addresses of a host from the best destination to the worst.
+*
+* Argument(s) : p_addrs     Pointer to the addresses array.
+*
+*               addr_nbr    Number of addresses in the array.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_GetHost().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The addresses are sorted by key (see 'ADDRESS KEY DEFINES' Note #1). The sort is stable, so
+*                   that equivalent destinations keep the order of the answer (RFC #6724, Section 6, Rule 10).
+*
+*               (2) The usable addresses are then reordered so that the families alternate, starting with the
+*                   family of the best address; the order within each family is kept. The unusable addresses
+*                   stay last.
+*
+*               (3) Only the first DNSc_ADDR_SORT_NBR_MAX addresses are sorted; the others follow in their
+*                   order.
+*********************************************************************************************************
+*/
+
+void  DNScAddr_Sort (DNSc_ADDR_OBJ  *p_addrs,
+                     CPU_INT08U      addr_nbr)
+{
+    DNSc_ADDR_SRC_TBL  src_tbl;
+    CPU_INT32U         key_tbl[DNSc_ADDR_SORT_NBR_MAX];
+    CPU_INT32U         key;
+    DNSc_ADDR_OBJ      addr;
+    CPU_INT08U         nbr;
+    CPU_INT08U         usable_nbr;
+    CPU_INT08U         i;
+    CPU_INT08U         j;
+
+
+    nbr = DEF_MIN(addr_nbr, DNSc_ADDR_SORT_NBR_MAX);            /* See Note #3.                                         */
+    if (nbr < 2u) {
+        goto exit;
+    }
+
+    DNScAddr_SrcTblGet(&src_tbl);
+
+    for (i = 0u; i < nbr; i++) {
+        key_tbl[i] = DNScAddr_KeyGet(&p_addrs[i], &src_tbl);
+    }
+                                                                /* Insertion sort (see Note #1).                        */
+    for (i = 1u; i < nbr; i++) {
+        key  = key_tbl[i];
+        addr = p_addrs[i];
+        j    = i;
+        while ((j > 0u) &&
+               (DNScAddr_KeyIsBefore(key, addr.Len, key_tbl[j - 1u], p_addrs[j - 1u].Len) == DEF_YES)) {
+            key_tbl[j] = key_tbl[j - 1u];
+            p_addrs[j] = p_addrs[j - 1u];
+            j--;
+        }
+        key_tbl[j] = key;
+        p_addrs[j] = addr;
+    }
+
+    usable_nbr = 0u;
+    while ((usable_nbr < nbr) &&
+           (DEF_BIT_IS_SET(key_tbl[usable_nbr], DNSc_ADDR_KEY_USABLE))) {
+        usable_nbr++;
+    }
+                                                                /* Interleave the families (see Note #2).               */
+    for (i = 1u; i < usable_nbr; i++) {
+        if (p_addrs[i].Len == p_addrs[i - 1u].Len) {
+            j = i + 1u;                                         /* Find the next addr of the other family ...           */
+            while ((j < usable_nbr) &&
+                   (p_addrs[j].Len == p_addrs[i - 1u].Len)) {
+                j++;
+            }
+            if (j >= usable_nbr) {                              /* ... none left: the rest is of one family.            */
+                break;
+            }
+
+            key  = key_tbl[j];                                  /* Move it before the addrs it followed.                */
+            addr = p_addrs[j];
+            while (j > i) {
+                key_tbl[j] = key_tbl[j - 1u];
+                p_addrs[j] = p_addrs[j - 1u];
+                j--;
+            }
+            key_tbl[i] = key;
+            p_addrs[i] = addr;
+        }
+    }
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        DNScAddr_SrcTblGet()
+*
+* Description : Get the addresses of the configured interfaces.
+*
+* Argument(s) : p_src_tbl   Pointer to the table that will receive the addresses.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScAddr_Sort().
+*
+* Note(s)     : (1) The interfaces are the ones walked by DNSc_ReqIF_Sel(). An interface whose addresses do not
+*                   fit in the space left in the table is skipped.
+*********************************************************************************************************
+*/
+
+static  void  DNScAddr_SrcTblGet (DNSc_ADDR_SRC_TBL  *p_src_tbl)
+{
+    NET_IF_NBR        if_nbr;
+    NET_IF_NBR        if_nbr_cfgd;
+    NET_IF_NBR        if_nbr_base;
+    NET_IP_ADDRS_QTY  qty;
+    NET_ERR           net_err;
+
+
+#ifdef  NET_IPv4_MODULE_EN
+    p_src_tbl->IPv4Nbr = 0u;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    p_src_tbl->IPv6Nbr = 0u;
+#endif
+
+    if_nbr_base  = NetIF_GetNbrBaseCfgd();
+    if_nbr_cfgd  = NetIF_GetExtAvailCtr(&net_err);
+    if_nbr_cfgd -= if_nbr_base;
+
+    for (if_nbr = if_nbr_base; if_nbr <= if_nbr_cfgd; if_nbr++) {
+#ifdef  NET_IPv4_MODULE_EN
+        qty = DNSc_ADDR_SRC_NBR_MAX - p_src_tbl->IPv4Nbr;
+        if (qty > 0u) {
+            (void)NetIPv4_GetAddrHost( if_nbr,
+                                      &p_src_tbl->IPv4Tbl[p_src_tbl->IPv4Nbr],
+                                      &qty,
+                                      &net_err);
+            if (net_err == NET_IPv4_ERR_NONE) {
+                p_src_tbl->IPv4Nbr += qty;
+            }
+        }
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+        qty = DNSc_ADDR_SRC_NBR_MAX - p_src_tbl->IPv6Nbr;
+        if (qty > 0u) {
+            (void)NetIPv6_GetAddrHost( if_nbr,
+                                      &p_src_tbl->IPv6Tbl[p_src_tbl->IPv6Nbr],
+                                      &qty,
+                                      &net_err);
+            if (net_err == NET_IPv6_ERR_NONE) {
+                p_src_tbl->IPv6Nbr += qty;
+            }
+        }
+#endif
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScAddr_SrcGet()
+*
+* Description : Get a local address of a family, mapped to IPv6.
+*
+* Argument(s) : p_src_tbl   Pointer to the table of local addresses.
+*
+*               len         Length of the family's addresses (NET_IPv4_ADDR_LEN or NET_IPv6_ADDR_LEN).
+*
+*               ix          Index of the address among the family's addresses.
+*
+*               p_mapped    Pointer to the buffer that will receive the mapped address.
+*
+* Return(s)   : DEF_YES, if the family has an address at this index,
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNScAddr_KeyGet().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DNScAddr_SrcGet (const  DNSc_ADDR_SRC_TBL  *p_src_tbl,
+                                             CPU_INT08U          len,
+                                             CPU_INT08U          ix,
+                                             CPU_INT08U         *p_mapped)
+{
+#ifdef  NET_IPv4_MODULE_EN
+    DNSc_ADDR_OBJ  addr;
+#endif
+    CPU_BOOLEAN    found = DEF_NO;
+
+
+    switch (len) {
+#ifdef  NET_IPv4_MODULE_EN
+        case NET_IPv4_ADDR_LEN:
+             if (ix < p_src_tbl->IPv4Nbr) {
+                 Mem_Copy(addr.Addr, &p_src_tbl->IPv4Tbl[ix], NET_IPv4_ADDR_LEN);
+                 addr.Len = NET_IPv4_ADDR_LEN;
+                 DNScAddr_Map(&addr, p_mapped);
+                 found    = DEF_YES;
+             }
+             break;
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+        case NET_IPv6_ADDR_LEN:
+             if (ix < p_src_tbl->IPv6Nbr) {
+                 Mem_Copy(p_mapped, &p_src_tbl->IPv6Tbl[ix], NET_IPv6_ADDR_LEN);
+                 found = DEF_YES;
+             }
+             break;
+#endif
+
+        default:
+             break;
+    }
+
+    return (found);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScAddr_KeyGet()
+*
+* Description : Compute the sort key of a destination address.
+*
+* Argument(s) : p_addr      Pointer to the destination address.
+*
+*               p_src_tbl   Pointer to the table of local addresses.
+*
+* Return(s)   : Sort key (see 'ADDRESS KEY DEFINES' Note #1).
+*
+* Caller(s)   : DNScAddr_Sort().
+*
+* Note(s)     : (1) The source address of the destination is the local address of the same family chosen by
+*                   the source address selection rules of RFC #6724, Section 5: the destination itself (rule
+*                   1), an appropriate scope (rule 2), then the longest matching prefix (rule 8).
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DNScAddr_KeyGet (const  DNSc_ADDR_OBJ      *p_addr,
+                                     const  DNSc_ADDR_SRC_TBL  *p_src_tbl)
+{
+    CPU_INT08U                dest[DNSc_ADDR_MAPPED_LEN];
+    CPU_INT08U                src[DNSc_ADDR_MAPPED_LEN];
+    CPU_INT08U                src_best[DNSc_ADDR_MAPPED_LEN];
+    const  DNSc_ADDR_POLICY  *p_policy;
+    CPU_INT08U                scope_dest;
+    CPU_INT08U                scope_src;
+    CPU_INT08U                scope_best  = 0u;
+    CPU_INT08U                prefix_src;
+    CPU_INT08U                prefix_best = 0u;
+    CPU_BOOLEAN               found       = DEF_NO;
+    CPU_BOOLEAN               is_better;
+    CPU_INT08U                ix;
+    CPU_INT32U                key;
+
+
+    DNScAddr_Map(p_addr, dest);
+    scope_dest = DNScAddr_ScopeGet(dest);
+    p_policy   = DNScAddr_PolicyGet(dest);
+
+    key = ((CPU_INT32U)p_policy->Prec                          << DNSc_ADDR_KEY_PREC_SHIFT) |
+          ((CPU_INT32U)(0x0Fu - scope_dest)                    << DNSc_ADDR_KEY_SCOPE_SHIFT);
+
+                                                                /* Select the src addr (see Note #1).                   */
+    for (ix = 0u; DNScAddr_SrcGet(p_src_tbl, p_addr->Len, ix, src) == DEF_YES; ix++) {
+        scope_src  = DNScAddr_ScopeGet(src);
+        prefix_src = DNScAddr_PrefixLenGet(src, dest);
+
+        if (found == DEF_NO) {
+            is_better = DEF_YES;
+        } else if (scope_best < scope_src) {                    /* Rule 2: prefer a scope that reaches the dest.        */
+            is_better = (scope_best < scope_dest) ? DEF_YES : DEF_NO;
+        } else if (scope_src < scope_best) {
+            is_better = (scope_src >= scope_dest) ? DEF_YES : DEF_NO;
+        } else {                                                /* Rule 8: longest matching prefix.                     */
+            is_better = (prefix_src > prefix_best) ? DEF_YES : DEF_NO;
+        }
+
+        if (is_better == DEF_YES) {
+            Mem_Copy(src_best, src, DNSc_ADDR_MAPPED_LEN);
+            scope_best  = scope_src;
+            prefix_best = prefix_src;
+            found       = DEF_YES;
+        }
+
+        if (prefix_src == (DNSc_ADDR_MAPPED_LEN * DEF_OCTET_NBR_BITS)) {
+            break;                                              /* Rule 1: the dest is a local addr.                    */
+        }
+    }
+
+    if (found == DEF_YES) {
+        DEF_BIT_SET(key, DNSc_ADDR_KEY_USABLE);
+        if (scope_best == scope_dest) {
+            DEF_BIT_SET(key, DNSc_ADDR_KEY_SCOPE_MATCH);
+        }
+        if (DNScAddr_PolicyGet(src_best)->Label == p_policy->Label) {
+            DEF_BIT_SET(key, DNSc_ADDR_KEY_LABEL_MATCH);
+        }
+        if (p_addr->Len == NET_IPv6_ADDR_LEN) {
+            key |= prefix_best;
+        }
+    }
+
+    return (key);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DNScAddr_KeyIsBefore()
+*
+* Description : Compare the sort keys of two destination addresses.
+*
+* Argument(s) : key_1       Key of the first destination.
+*
+*               len_1       Length of the first destination.
+*
+*               key_2       Key of the second destination.
+*
+*               len_2       Length of the second destination.
+*
+* Return(s)   : DEF_YES, if the first destination is strictly better than the second,
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNScAddr_Sort().
+*
+* Note(s)     : (1) The prefix length only orders two IPv6 destinations (see 'ADDRESS KEY DEFINES' Note #1).
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DNScAddr_KeyIsBefore (CPU_INT32U  key_1,
+                                           CPU_INT08U  len_1,
+                                           CPU_INT32U  key_2,
+                                           CPU_INT08U  len_2)
+{
+    CPU_BOOLEAN  is_before;
+
+
+    if ((len_1 != NET_IPv6_ADDR_LEN) ||                         /* See Note #1.                                         */
+        (len_2 != NET_IPv6_ADDR_LEN)) {
+        key_1 &= ~DNSc_ADDR_KEY_PREFIX_MASK;
+        key_2 &= ~DNSc_ADDR_KEY_PREFIX_MASK;
+    }
+
+    is_before = (key_1 > key_2) ? DEF_YES : DEF_NO;
+
+    return (is_before);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DNScAddr_Map()
+*
+* Description : Map an address to IPv6.
+*
+* Argument(s) : p_addr      Pointer to the address.
+*
+*               p_mapped    Pointer to the buffer that will receive the mapped address.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScAddr_KeyGet(),
+*               DNScAddr_SrcGet().
+*
+* Note(s)     : (1) IPv4 addresses are kept in host order (see 'dns-c_cache.c  DNScCache_HostAddrInsert()'),
+*                   & mapped to ::ffff:a.b.c.d in network order (see 'ADDRESS KEY DEFINES' Note #2).
+*********************************************************************************************************
+*/
+
+static  void  DNScAddr_Map (const  DNSc_ADDR_OBJ  *p_addr,
+                                   CPU_INT08U     *p_mapped)
+{
+    CPU_INT32U  addr_ipv4;
+
+
+    if (p_addr->Len == NET_IPv4_ADDR_LEN) {                     /* See Note #1.                                         */
+        Mem_Copy(&addr_ipv4, p_addr->Addr, NET_IPv4_ADDR_LEN);
+        Mem_Clr(p_mapped, 10u);
+        p_mapped[10] = 0xFFu;
+        p_mapped[11] = 0xFFu;
+        p_mapped[12] = (CPU_INT08U)(addr_ipv4 >> 24u);
+        p_mapped[13] = (CPU_INT08U)(addr_ipv4 >> 16u);
+        p_mapped[14] = (CPU_INT08U)(addr_ipv4 >>  8u);
+        p_mapped[15] = (CPU_INT08U) addr_ipv4;
+    } else {
+        Mem_Copy(p_mapped, p_addr->Addr, DNSc_ADDR_MAPPED_LEN);
+    }
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScAddr_ScopeGet()
+*
+* Description : Get the scope of an address.
+*
+* Argument(s) : p_mapped    Pointer to the address, mapped to IPv6.
+*
+* Return(s)   : Scope of the address (see RFC #4291, Section 2.7 & RFC #6724, Section 3.2).
+*
+* Caller(s)   : DNScAddr_KeyGet().
+*
+* Note(s)     : (1) IPv4 loopback (127/8) & auto-configuration (169.254/16) addresses have a link-local scope;
+*                   the other IPv4 addresses, private ones included, have a global scope.
+*
+*               (2) The IPv6 loopback address (::1) has a link-local scope.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  DNScAddr_ScopeGet (const  CPU_INT08U  *p_mapped)
+{
+    CPU_INT08U  scope = DNSc_ADDR_SCOPE_GLOBAL;
+
+
+    if (DNScAddr_PrefixLenGet(p_mapped, DNScAddr_PolicyTbl[DNSc_ADDR_POLICY_IX_IPv4].Prefix) >= 96u) {
+        if ((p_mapped[12] == 127u) ||                           /* See Note #1.                                         */
+           ((p_mapped[12] == 169u) && (p_mapped[13] == 254u))) {
+            scope = DNSc_ADDR_SCOPE_LINK_LOCAL;
+        }
+
+    } else if (p_mapped[0] == 0xFFu) {                          /* Multicast: scope field.                              */
+        scope = p_mapped[1] & 0x0Fu;
+
+    } else if ((p_mapped[0] == 0xFEu) && ((p_mapped[1] & 0xC0u) == 0x80u)) {
+        scope = DNSc_ADDR_SCOPE_LINK_LOCAL;                     /* fe80::/10.                                           */
+
+    } else if ((p_mapped[0] == 0xFEu) && ((p_mapped[1] & 0xC0u) == 0xC0u)) {
+        scope = DNSc_ADDR_SCOPE_SITE_LOCAL;                     /* fec0::/10.                                           */
+
+    } else if (DNScAddr_PrefixLenGet(p_mapped, DNScAddr_PolicyTbl[DNSc_ADDR_POLICY_IX_LOOPBACK].Prefix) == 128u) {
+        scope = DNSc_ADDR_SCOPE_LINK_LOCAL;                     /* See Note #2.                                         */
+    }
+
+    return (scope);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScAddr_PolicyGet()
+*
+* Description : Get the policy table entry of an address.
+*
+* Argument(s) : p_mapped    Pointer to the address, mapped to IPv6.
+*
+* Return(s)   : Pointer to the entry w/ the longest prefix matching the address.
+*
+* Caller(s)   : DNScAddr_KeyGet().
+*
+* Note(s)     : (1) The ::/0 entry matches every address.
+*********************************************************************************************************
+*/
+
+static  const  DNSc_ADDR_POLICY  *DNScAddr_PolicyGet (const  CPU_INT08U  *p_mapped)
+{
+    const  DNSc_ADDR_POLICY  *p_policy;
+    CPU_INT08U                ix;
+
+
+                                                                /* See Note #1.                                         */
+    p_policy = &DNScAddr_PolicyTbl[DNSc_ADDR_POLICY_IX_DFLT];
+    for (ix = 0u; ix < DNSc_ADDR_POLICY_NBR; ix++) {
+        if ((DNScAddr_PolicyTbl[ix].PrefixLen > p_policy->PrefixLen) &&
+            (DNScAddr_PrefixLenGet(p_mapped, DNScAddr_PolicyTbl[ix].Prefix) >= DNScAddr_PolicyTbl[ix].PrefixLen)) {
+            p_policy = &DNScAddr_PolicyTbl[ix];
+        }
+    }
+
+    return (p_policy);
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DNScAddr_PrefixLenGet()
+*
+* Description : Get the length of the prefix common to two addresses.
+*
+* Argument(s) : p_mapped_1  Pointer to the first address, mapped to IPv6.
+*
+*               p_mapped_2  Pointer to the second address, mapped to IPv6.
+*
+* Return(s)   : Number of leading bits in common, from 0 to 128.
+*
+* Caller(s)   : DNScAddr_KeyGet(),
+*               DNScAddr_PolicyGet(),
+*               DNScAddr_ScopeGet().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  DNScAddr_PrefixLenGet (const  CPU_INT08U  *p_mapped_1,
+                                           const  CPU_INT08U  *p_mapped_2)
+{
+    CPU_INT08U  len = 0u;
+    CPU_INT08U  ix  = 0u;
+    CPU_INT08U  diff;
+
+
+    while ((ix < DNSc_ADDR_MAPPED_LEN) &&
+           (p_mapped_1[ix] == p_mapped_2[ix])) {
+        len += DEF_OCTET_NBR_BITS;
+        ix++;
+    }
+
+    if (ix < DNSc_ADDR_MAPPED_LEN) {
+        diff = p_mapped_1[ix] ^ p_mapped_2[ix];
+        while ((diff & 0x80u) == 0u) {
+            diff <<= 1u;
+            len++;
+        }
+    }
+
+    return (len);
+}
+#endif
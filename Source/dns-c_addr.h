@@ -0,0 +1,63 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                   DNS CLIENT ADDRESS SELECTION MODULE
+*
+* Filename : dns-c_addr.h
+* Version  : V2.02.00
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  DNSc_ADDR_PRESENT
+#define  DNSc_ADDR_PRESENT
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "dns-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_ADDR_SORT_EN == DEF_ENABLED)
+void  DNScAddr_Sort(DNSc_ADDR_OBJ  *p_addrs,
+                    CPU_INT08U      addr_nbr);
+#endif
+
+#endif  /* DNSc_ADDR_PRESENT */
@@ -44,10 +44,38 @@
 
 #include  "dns-c_cache.h"
 #include  "dns-c_req.h"
+#include  "dns-c_task.h"
 #include  <Source/net_ascii.h>
 #include  <Source/net_util.h>
 #include  <IF/net_if.h>
 #include  <lib_mem.h>
+#include  <lib_ascii.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            LOCAL DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#define  DNSc_CACHE_ALIGN(size)                 (((size) + sizeof(CPU_ALIGN) - 1u) & ~(sizeof(CPU_ALIGN) - 1u))
+
+#define  DNSc_CACHE_HASH_FNV_OFFSET                 2166136261u /* FNV-1a 32-bit hash parameters.                       */
+#define  DNSc_CACHE_HASH_FNV_PRIME                    16777619u
+
+#define  DNSc_CACHE_FRONT_ADDR_NBR_MAX                       4u /* Max nbr of addrs kept by a front cache entry.        */
+
+#define  DNSc_CACHE_FRONT_FLAGS                   (DNSc_FLAG_IPv4_ONLY | DNSc_FLAG_IPv6_ONLY)
+
+#define  DNSc_CACHE_TTL_MIN_S                                5u /* Min & max lifetime of a resolved entry.              */
+#define  DNSc_CACHE_TTL_MAX_S                           604800u
+
+#define  DNSc_CACHE_EXPORT_MAGIC                    0x444E5363u /* 'DNSc'.                                              */
+#define  DNSc_CACHE_EXPORT_VER                               1u
+#define  DNSc_CACHE_EXPORT_HDR_SIZE                          8u /* Magic, version, reserved & entry count.              */
+#define  DNSc_CACHE_EXPORT_ENTRY_HDR_SIZE                    7u /* Name len, TTL & addr count.                          */
 
 
 /*
@@ -58,6 +86,183 @@
 *********************************************************************************************************
 */
 
+/*
+*********************************************************************************************************
+*                                     CACHE ENTRY ELEMENT DATA TYPE
+*
+* Note(s) : (1) Elements of a cache entry that are only acquired when required by the request.
+*********************************************************************************************************
+*/
+
+typedef  enum  dnsc_cache_elem {
+    DNSc_CACHE_ELEM_CANON_NAME,
+    DNSc_CACHE_ELEM_REV_NAME,
+    DNSc_CACHE_ELEM_REQ_CFG
+} DNSc_CACHE_ELEM;
+
+
+/*
+*********************************************************************************************************
+*                                         CACHE SLAB DATA TYPE
+*
+* Note(s) : (1) The slab is a single memory region divided in one fixed slot per cache entry :
+*
+*                   +----------+----------+-------+------+----------+------------+---------+------+
+*                   | Host obj | Addr tbl | Query | Name | Rev name | Canon name | Req cfg | Item |
+*                   +----------+----------+-------+------+----------+------------+---------+------+
+*
+*               Every element is located at a fixed offset from the start of the slot, the host object being
+*               at offset 0. Free slots are tracked by a stack of slot indexes located after the last slot.
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                   CACHE ADDRESS INDEX DATA TYPE
+*
+* Note(s) : (1) The address index is an open addressing hash table (linear probing) keyed by the binary value
+*               of every address stored in the cache. An entry refers to the address through its host object
+*               & its index in the host's addresses table.
+*
+*           (2) The table is sized to the next power of 2 that is at least twice the maximum number of
+*               addresses in the cache, so that it can never be full & probe sequences remain short.
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_cache_addr_ix {
+    DNSc_HOST_OBJ  *HostPtr;                                    /* Ptr to host holding the addr, DEF_NULL if free.      */
+    CPU_INT08U      AddrIx;                                     /* Ix of the addr in the host's addr tbl.               */
+} DNSc_CACHE_ADDR_IX;
+
+
+/*
+*********************************************************************************************************
+*                                   CACHE QUERY ID INDEX DATA TYPE
+*
+* Note(s) : (1) The query ID index is an open addressing hash table (linear probing) keyed by the ID of every
+*               query in flight, so that an ID is allocated unique & a response is matched to its host w/o a
+*               search (see DNScCache_QueryIxAdd() & DNScCache_QueryIxSrch()). IDs are random, so that the
+*               ID itself is the hash.
+*
+*           (2) A host has at most one query in flight. The table is sized to the next power of 2 that is at
+*               least twice the maximum number of hosts in the cache.
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_cache_query_ix {
+    DNSc_HOST_OBJ  *HostPtr;                                    /* Ptr to host of the query, DEF_NULL if free.          */
+    CPU_INT16U      QueryID;                                    /* ID of the query.                                     */
+} DNSc_CACHE_QUERY_IX;
+
+
+/*
+*********************************************************************************************************
+*                                     FRONT CACHE ENTRY DATA TYPE
+*
+* Note(s) : (1) The front cache holds copies of the last forward answers returned by DNScCache_Srch(). An
+*               entry is keyed by the name of its host, the name's hash & length, & the address family flags.
+*               It is only valid while the cache generation it was filled at is the current one & until the
+*               host's TTL expires. While the generation is current, the host & its name are unchanged, so
+*               that a lookup confirms the name of a matching entry against the name of its host.
+*
+*           (2) Entries are only accessed within critical sections, so that a lookup never waits for the
+*               cache lock.
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+typedef  struct  dnsc_cache_front {
+    const  CPU_CHAR       *NamePtr;                             /* Ptr to the name of the host.                         */
+           CPU_INT32U      NameHash;                            /* Case-folded hash of the name.                        */
+           CPU_INT16U      NameLen;                             /* Len of the name.                                     */
+           DNSc_FLAGS      Flags;                               /* Addr family flags of the lookup.                     */
+           CPU_INT32U      Gen;                                 /* Cache generation the entry was filled at.            */
+           NET_TS_MS       TS_ms;                               /* TS the entry was filled at.                          */
+           CPU_INT32U      Life_ms;                             /* Remaining TTL of the host when the entry was filled. */
+           CPU_INT08U      AddrsCount;                          /* Nbr of addrs in the entry, 0 if entry is free.       */
+           DNSc_ADDR_OBJ   Addrs[DNSc_CACHE_FRONT_ADDR_NBR_MAX];
+} DNSc_CACHE_FRONT;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       PENDING LIST DATA TYPE
+*
+* Note(s) : (1) One list per request priority holds the hosts submitted to DNSc's task & not completed yet, in
+*               submission order (see DNScCache_PendLink()).
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+typedef  struct  dnsc_cache_pend_list {
+    DNSc_HOST_OBJ  *HeadPtr;                                    /* Oldest pending host.                                 */
+    DNSc_HOST_OBJ  *TailPtr;                                    /* Last pending host.                                   */
+    CPU_INT16U      InFlightNbr;                                /* Nbr of hosts w/ .PendInFlight set.                   */
+} DNSc_CACHE_PEND_LIST;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        SERVER RATE DATA TYPE
+*
+* Note(s) : (1) Token bucket limiting the requests sent to a server to DNSc_CFG_REQ_SERVER_QPS_MAX per second
+*               (see DNScCache_ServerRateGet()). Tokens are counted in thousandths of a request, so that the
+*               bucket refills by DNSc_CFG_REQ_SERVER_QPS_MAX every millisecond, & holds up to one second of
+*               requests.
+*
+*           (2) One bucket per server of the resolver statistics, plus one shared by the servers w/o a slot
+*               (see 'dns-c_cfg.h  DNSc_CFG_STATS_SERVER_NBR_MAX').
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)
+#define  DNSc_CACHE_SERVER_RATE_TOKEN                   1000u   /* Tokens per req.                                      */
+#define  DNSc_CACHE_SERVER_RATE_TOKEN_MAX              (DNSc_CFG_REQ_SERVER_QPS_MAX * DNSc_CACHE_SERVER_RATE_TOKEN)
+
+typedef  struct  dnsc_cache_server_rate {
+    NET_TS_MS   TS_ms;                                          /* TS of the last refill.                               */
+    CPU_INT32U  Tokens;                                         /* Tokens left at .TS_ms.                               */
+} DNSc_CACHE_SERVER_RATE;
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                     SERVER INTERFACE DATA TYPE
+*
+* Note(s) : (1) Last interface through which a server answered, so that the next requests to this server
+*               start on it instead of walking the interfaces (see DNScCache_ServerIF_Get()).
+*
+*           (2) The record is valid while .LinkGen equals DNScCache_LinkGen, which is incremented each time
+*               a link is found down. The record is also cleared when the server does not answer.
+*
+*           (3) One record per server of the resolver statistics, plus one shared by the servers w/o a slot
+*               (see 'dns-c_cfg.h  DNSc_CFG_STATS_SERVER_NBR_MAX').
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_cache_server_if {
+    NET_IF_NBR  IF_Nbr;                                         /* Last IF the server answered through.                 */
+    CPU_INT32U  LinkGen;                                        /* DNScCache_LinkGen when .IF_Nbr was set.              */
+} DNSc_CACHE_SERVER_IF;
+
+
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+typedef  struct  dnsc_cache_slab {
+    CPU_INT08U  *BasePtr;                                       /* Ptr to first slot.                                   */
+    CPU_SIZE_T   SlotSize;                                      /* Size of a slot, in octets.                           */
+    CPU_SIZE_T   NameOffset;                                    /* Offset of the host name in a slot.                   */
+    CPU_SIZE_T   RevNameOffset;                                 /* Offset of the reverse name in a slot.                */
+    CPU_SIZE_T   CanonNameOffset;                               /* Offset of the canonical name in a slot.              */
+    CPU_SIZE_T   ReqCfgOffset;                                  /* Offset of the req cfg in a slot.                     */
+    CPU_SIZE_T   ItemOffset;                                    /* Offset of the cache list item in a slot.             */
+    CPU_INT16U  *FreeTblPtr;                                    /* Stack of free slot indexes.                          */
+    CPU_INT16U   FreeNbr;                                       /* Nbr of free slots.                                   */
+} DNSc_CACHE_SLAB;
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -68,15 +273,53 @@
 */
 
 static  KAL_LOCK_HANDLE   DNScCache_LockHandle;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+static  DNSc_CACHE_SLAB   DNScCache_Slab;
+#else
 static  MEM_DYN_POOL      DNScCache_ItemPool;
 static  MEM_DYN_POOL      DNScCache_HostObjPool;
 static  MEM_DYN_POOL      DNScCache_HostNamePool;
 static  MEM_DYN_POOL      DNScCache_HostRevNamePool;
 static  MEM_DYN_POOL      DNScCache_HostCanonNamePool;
-static  MEM_DYN_POOL      DNScCache_AddrItemPool;
-static  MEM_DYN_POOL      DNScCache_AddrObjPool;
 static  MEM_DYN_POOL      DNScCache_ReqCfgPool;
+#endif
 static  DNSc_CACHE_ITEM  *DNSc_CacheItemListHead;
+#ifdef  DNSc_TASK_MODULE_EN
+                                                                /* Pending lists, indexed by DNSc_REQ_PRIO.             */
+static  DNSc_CACHE_PEND_LIST  DNScCache_PendListTbl[DNSc_REQ_PRIO_NBR];
+                                                                /* Order in which the pending lists are serviced.       */
+static  const  DNSc_REQ_PRIO  DNScCache_PendPrioOrderTbl[DNSc_REQ_PRIO_NBR] = {
+    DNSc_REQ_PRIO_HIGH,
+    DNSc_REQ_PRIO_NORMAL,
+    DNSc_REQ_PRIO_LOW
+};
+#endif
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)                          /* See 'SERVER RATE DATA TYPE' Note #2.                 */
+static  DNSc_CACHE_SERVER_RATE  DNScCache_ServerRateTbl[DNSc_CFG_STATS_SERVER_NBR_MAX + 1u];
+#endif
+                                                                /* See 'SERVER INTERFACE DATA TYPE' Note #3.            */
+static  DNSc_CACHE_SERVER_IF    DNScCache_ServerIF_Tbl[DNSc_CFG_STATS_SERVER_NBR_MAX + 1u];
+static  CPU_INT32U              DNScCache_LinkGen;              /* See 'SERVER INTERFACE DATA TYPE' Note #2.            */
+static  CPU_INT08U        DNScCache_AddrPerHostMax;
+static  CPU_INT16U        DNScCache_NameLenMax;
+static  CPU_INT16U        DNScCache_QueryLenMax;                /* Size of a host's query msg buf.                      */
+
+static  DNSc_CACHE_ADDR_IX  *DNScCache_AddrIxTbl;
+static  CPU_INT32U           DNScCache_AddrIxMask;
+
+static  DNSc_CACHE_QUERY_IX *DNScCache_QueryIxTbl;
+static  CPU_INT32U           DNScCache_QueryIxMask;
+
+static  CPU_INT32U           DNScCache_Gen;                     /* Incremented each time a cache entry is modified.     */
+
+static  const  DNSc_CFG     *DNScCache_CfgPtr;
+
+static  DNSc_CACHE_STATS     DNScCache_Stats;                   /* Updated w/ the cache lock, except .FrontHits.        */
+static  DNSc_RESOLVER_STATS  DNScCache_ResolverStats;           /* Updated w/ the cache lock.                           */
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+static  DNSc_CACHE_FRONT     DNScCache_FrontTbl[DNSc_CFG_CACHE_FRONT_NBR_ENTRIES];
+static  CPU_INT08U           DNScCache_FrontIxNext;
+#endif
 
 
 /*
@@ -94,6 +337,32 @@ static  void              DNScCache_LockRelease      (       void);
 
 static  void              DNScCache_HostRemoveHandler(       DNSc_HOST_OBJ    *p_host);
 
+static  void              DNScCache_HostAbort        (       DNSc_HOST_OBJ    *p_host);
+
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+static  void              DNScCache_HostSignal       (       DNSc_HOST_OBJ    *p_host);
+#endif
+
+static  CPU_BOOLEAN       DNScCache_HostDeadlineGet  (const  DNSc_HOST_OBJ    *p_host,
+                                                             NET_TS_MS        *p_dly_ms);
+
+#ifdef  DNSc_TASK_MODULE_EN
+static  void              DNScCache_PendLink         (       DNSc_HOST_OBJ    *p_host);
+
+static  void              DNScCache_PendUnlink       (       DNSc_HOST_OBJ    *p_host);
+
+static  CPU_BOOLEAN       DNScCache_PendHold         (const  DNSc_HOST_OBJ    *p_host,
+                                                             NET_TS_MS        *p_dly_ms);
+#endif
+
+static  void              DNScCache_HostLink         (       DNSc_HOST_OBJ    *p_host,
+                                                             DNSc_ERR         *p_err);
+
+static  CPU_INT32U        DNScCache_HostTTL_Get      (       DNSc_HOST_OBJ    *p_host,
+                                                             NET_TS_MS         ts_cur_ms);
+
+static  CPU_INT08U        DNScCache_FamGet           (       DNSc_FLAGS        flags);
+
 static  void              DNScCache_HostObjNameSet   (       DNSc_HOST_OBJ    *p_host,
                                                       const  CPU_CHAR         *p_host_name,
                                                              DNSc_ERR         *p_err);
@@ -101,11 +370,46 @@ static  void              DNScCache_HostObjNameSet   (       DNSc_HOST_OBJ    *p
 static  DNSc_HOST_OBJ    *DNScCache_HostSrchByName   (const  CPU_CHAR         *p_host_name,
                                                              DNSc_FLAGS        flags);
 
+static  DNSc_HOST_OBJ    *DNScCache_HostSrchByAddr   (const  CPU_CHAR         *p_host_name,
+                                                             DNSc_FLAGS        flags);
+
 static  CPU_BOOLEAN       DNScCache_HostNameCmp      (       DNSc_HOST_OBJ    *p_host,
                                                       const  CPU_CHAR         *p_host_name,
+                                                             CPU_INT32U        name_hash,
+                                                             CPU_INT16U        name_len);
+
+static  CPU_INT32U        DNScCache_AddrHash         (const  DNSc_ADDR_OBJ    *p_addr);
+
+static  void              DNScCache_AddrIxAdd        (       DNSc_HOST_OBJ    *p_host,
+                                                             CPU_INT08U        addr_ix);
+
+static  void              DNScCache_AddrIxRemove     (       DNSc_HOST_OBJ    *p_host,
+                                                             CPU_INT08U        addr_ix);
+
+static  DNSc_HOST_OBJ    *DNScCache_AddrIxSrch       (const  DNSc_ADDR_OBJ    *p_addr,
+                                                             CPU_INT08U       *p_addr_ix);
+
+static  void              DNScCache_QueryIxAdd       (       DNSc_HOST_OBJ    *p_host);
+
+static  void              DNScCache_QueryIxRemove    (       DNSc_HOST_OBJ    *p_host);
+
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+static  void              DNScCache_FrontUpdate      (       DNSc_HOST_OBJ    *p_host,
                                                              DNSc_FLAGS        flags);
+#endif
+
+static  CPU_INT08U        DNScCache_StatsServerIxGet (const  DNSc_ADDR_OBJ    *p_server_addr);
+
+static  DNSc_HOST_OBJ    *DNScCache_HostBlkGet       (       DNSc_ERR         *p_err);
+
+static  void              DNScCache_HostBlkFree      (       DNSc_HOST_OBJ    *p_host);
+
+static  void             *DNScCache_HostElemGet      (       DNSc_HOST_OBJ    *p_host,
+                                                             DNSc_CACHE_ELEM   elem,
+                                                             DNSc_ERR         *p_err);
 
-static  DNSc_CACHE_ITEM  *DNScCache_ItemGet          (       DNSc_ERR         *p_err);
+static  DNSc_CACHE_ITEM  *DNScCache_ItemGet          (       DNSc_HOST_OBJ    *p_host,
+                                                             DNSc_ERR         *p_err);
 
 static  void              DNScCache_ItemFree         (       DNSc_CACHE_ITEM  *p_cache);
 
@@ -115,10 +419,6 @@ static  void              DNScCache_ItemRelease      (       DNSc_CACHE_ITEM  *p
 
 static  void              DNScCache_ItemRemove       (       DNSc_CACHE_ITEM  *p_cache);
 
-static  DNSc_ADDR_ITEM   *DNScCache_AddrItemGet      (       DNSc_ERR         *p_err);
-
-static  void              DNScCache_AddrItemFree     (       DNSc_ADDR_ITEM   *p_item);
-
 static  void              DNScCache_HostRelease      (       DNSc_HOST_OBJ    *p_host);
 
 static  void              DNScCache_HostAddrClr      (       DNSc_HOST_OBJ    *p_host);
@@ -134,6 +434,18 @@ static  DNSc_STATUS       DNScCache_Resp             (const  DNSc_CFG         *p
                                                              DNSc_HOST_OBJ    *p_host,
                                                              DNSc_ERR         *p_err);
 
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)
+static  NET_TS_MS         DNScCache_ServerRateGet    (const  DNSc_HOST_OBJ    *p_host,
+                                                             CPU_BOOLEAN       take);
+#endif
+
+static  DNSc_CACHE_SERVER_IF  *DNScCache_ServerIF_Get(const  DNSc_HOST_OBJ    *p_host);
+
+#ifdef  DNSc_TASK_MODULE_EN
+static  NET_TS_MS         DNScCache_HostDlyGet       (const  DNSc_CFG         *p_cfg,
+                                                      const  DNSc_HOST_OBJ    *p_host);
+#endif
+
 
 /*
 *********************************************************************************************************
@@ -155,16 +467,33 @@ static  DNSc_STATUS       DNScCache_Resp             (const  DNSc_CFG         *p
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The addresses of a host are stored in a contiguous table that directly follows the host
+*                   object in the same block. The table is sized to hold every IPv4 & IPv6 address allowed per
+*                   host, so that no further allocation is needed when an answer is received. The buffer of the
+*                   host's query message follows the table (see DNScCache_Req() Note #3).
+*
+*               (2) When DNSc_CFG_CACHE_SLAB_EN is enabled, all cache entries are carved out of a single region
+*                   allocated here (see 'CACHE SLAB DATA TYPE' Note #1). Otherwise, each element of an entry is
+*                   allocated from its own dynamic pool.
+*
+*               (3) See 'CACHE ADDRESS INDEX DATA TYPE' Note #2.
+*
+*               (4) See 'CACHE QUERY ID INDEX DATA TYPE' Note #2.
 *********************************************************************************************************
 */
 
 void  DNScCache_Init (const  DNSc_CFG  *p_cfg,
                              DNSc_ERR  *p_err)
 {
-    CPU_SIZE_T  nb_addr;
-    LIB_ERR     err;
-    KAL_ERR     kal_err;
+    CPU_SIZE_T   nb_addr;
+    CPU_INT32U   ix_nbr;
+    CPU_INT32U   ix;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    CPU_SIZE_T   slot_size;
+    CPU_INT16U   i;
+#endif
+    LIB_ERR      err;
+    KAL_ERR      kal_err;
 
 
     DNScCache_LockHandle = KAL_LockCreate("DNSc Lock",
@@ -183,7 +512,80 @@ void  DNScCache_Init (const  DNSc_CFG  *p_cfg,
              goto exit;
     }
 
+    DNSc_CacheItemListHead = DEF_NULL;
+#ifdef  DNSc_TASK_MODULE_EN
+    Mem_Clr(DNScCache_PendListTbl, sizeof(DNScCache_PendListTbl));
+#endif
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)
+    for (ix = 0u; ix <= DNSc_CFG_STATS_SERVER_NBR_MAX; ix++) {  /* Start w/ full buckets.                               */
+        DNScCache_ServerRateTbl[ix].TS_ms  = 0u;
+        DNScCache_ServerRateTbl[ix].Tokens = DNSc_CACHE_SERVER_RATE_TOKEN_MAX;
+    }
+#endif
+    for (ix = 0u; ix <= DNSc_CFG_STATS_SERVER_NBR_MAX; ix++) {  /* No IF known to work yet.                             */
+        DNScCache_ServerIF_Tbl[ix].IF_Nbr  = NET_IF_NBR_NONE;
+        DNScCache_ServerIF_Tbl[ix].LinkGen = 0u;
+    }
+    DNScCache_LinkGen      = 0u;
+    DNScCache_NameLenMax   = p_cfg->HostNameLenMax;
+    DNScCache_QueryLenMax  = DNSc_REQ_QUERY_LEN_MAX(p_cfg->HostNameLenMax);
+    DNScCache_Gen          = 0u;
+    DNScCache_CfgPtr       = p_cfg;
+
+    Mem_Clr(&DNScCache_Stats, sizeof(DNScCache_Stats));
+    DNScCache_Stats.EntriesMax = p_cfg->CacheEntriesMaxNbr;
+    Mem_Clr(&DNScCache_ResolverStats, sizeof(DNScCache_ResolverStats));
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+    Mem_Clr(DNScCache_FrontTbl, sizeof(DNScCache_FrontTbl));
+    DNScCache_FrontIxNext  = 0u;
+#endif
+
+
+    nb_addr = 0u;
+#ifdef  NET_IPv4_MODULE_EN
+    nb_addr += p_cfg->AddrIPv4MaxPerHost;
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    nb_addr += p_cfg->AddrIPv6MaxPerHost;
+#endif
+    DNScCache_AddrPerHostMax = (CPU_INT08U)nb_addr;
+
+
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)                     /* ------------- CREATE CACHE SLAB (Note #2) ---------- */
+                                                                /* Host obj followed by its addr tbl & query msg buf.   */
+    slot_size                      = DNSc_CACHE_ALIGN(sizeof(DNSc_HOST_OBJ)                  +
+                                                     (nb_addr * sizeof(DNSc_ADDR_OBJ))      +
+                                                      DNScCache_QueryLenMax);
+    DNScCache_Slab.NameOffset      = slot_size;
+    slot_size                     += DNSc_CACHE_ALIGN(p_cfg->HostNameLenMax);
+    DNScCache_Slab.RevNameOffset   = slot_size;
+    slot_size                     += DNSc_CACHE_ALIGN(p_cfg->HostNameLenMax);
+    DNScCache_Slab.CanonNameOffset = slot_size;
+    slot_size                     += DNSc_CACHE_ALIGN(p_cfg->HostNameLenMax);
+    DNScCache_Slab.ReqCfgOffset    = slot_size;
+    slot_size                     += DNSc_CACHE_ALIGN(sizeof(DNSc_REQ_CFG));
+    DNScCache_Slab.ItemOffset      = slot_size;
+    slot_size                     += DNSc_CACHE_ALIGN(sizeof(DNSc_CACHE_ITEM));
+    DNScCache_Slab.SlotSize        = slot_size;
+
+    DNScCache_Slab.BasePtr = (CPU_INT08U *)Mem_SegAllocExt("DNSc Cache Slab",
+                                                            p_cfg->MemSegPtr,
+                                                          ((slot_size + sizeof(CPU_INT16U)) * p_cfg->CacheEntriesMaxNbr),
+                                                            sizeof(CPU_ALIGN),
+                                                            DEF_NULL,
+                                                           &err);
+    if (err != LIB_MEM_ERR_NONE) {
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+
+    DNScCache_Slab.FreeTblPtr = (CPU_INT16U *)(DNScCache_Slab.BasePtr + (slot_size * p_cfg->CacheEntriesMaxNbr));
+    DNScCache_Slab.FreeNbr    =  p_cfg->CacheEntriesMaxNbr;
+    for (i = 0u; i < p_cfg->CacheEntriesMaxNbr; i++) {          /* Lowest slots are popped first.                       */
+        DNScCache_Slab.FreeTblPtr[i] = (CPU_INT16U)(p_cfg->CacheEntriesMaxNbr - 1u - i);
+    }
 
+#else                                                           /* --------------- CREATE CACHE POOLS ----------------- */
     Mem_DynPoolCreate("DNSc Cache Item Pool",
                       &DNScCache_ItemPool,
                        p_cfg->MemSegPtr,
@@ -197,13 +599,10 @@ void  DNScCache_Init (const  DNSc_CFG  *p_cfg,
         goto exit;
     }
 
-    DNSc_CacheItemListHead = DEF_NULL;
-
-
-    Mem_DynPoolCreate("DNSc Cache Host Obj Pool",
+    Mem_DynPoolCreate("DNSc Cache Host Obj Pool",               /* Host obj followed by its addr tbl & query msg buf.   */
                       &DNScCache_HostObjPool,
                        p_cfg->MemSegPtr,
-                       sizeof(DNSc_HOST_OBJ),
+                      (sizeof(DNSc_HOST_OBJ) + (nb_addr * sizeof(DNSc_ADDR_OBJ)) + DNScCache_QueryLenMax),
                        sizeof(CPU_ALIGN),
                        1u,
                        p_cfg->CacheEntriesMaxNbr,
@@ -252,56 +651,60 @@ void  DNScCache_Init (const  DNSc_CFG  *p_cfg,
         goto exit;
     }
 
-    nb_addr = 0u;
-#ifdef  NET_IPv4_MODULE_EN
-    nb_addr += p_cfg->AddrIPv4MaxPerHost;
-#endif
-#ifdef  NET_IPv6_MODULE_EN
-    nb_addr += p_cfg->AddrIPv6MaxPerHost;
-#endif
-    nb_addr *= p_cfg->CacheEntriesMaxNbr;
-
-    Mem_DynPoolCreate("DNSc Cache Addr Item Pool",
-                      &DNScCache_AddrItemPool,
+    Mem_DynPoolCreate("DNSc Cache Req Cfg Pool",
+                      &DNScCache_ReqCfgPool,
                        p_cfg->MemSegPtr,
-                       sizeof(DNSc_ADDR_ITEM),
+                       sizeof(DNSc_REQ_CFG),
                        sizeof(CPU_ALIGN),
                        1u,
-                       nb_addr,
+                       p_cfg->CacheEntriesMaxNbr,
                       &err);
     if (err != LIB_MEM_ERR_NONE) {
        *p_err = DNSc_ERR_MEM_ALLOC;
         goto exit;
     }
+#endif
 
-    nb_addr++;
+                                                                /* ------------- CREATE ADDR INDEX (Note #3) ---------- */
+    ix_nbr = 2u;
+    while (ix_nbr < (2u * p_cfg->CacheEntriesMaxNbr * nb_addr)) {
+        ix_nbr <<= 1u;
+    }
 
-    Mem_DynPoolCreate("DNSc Cache Addr Obj Pool",
-                      &DNScCache_AddrObjPool,
-                       p_cfg->MemSegPtr,
-                       sizeof(DNSc_ADDR_OBJ),
-                       sizeof(CPU_ALIGN),
-                       1u,
-                       nb_addr,
-                      &err);
+    DNScCache_AddrIxTbl = (DNSc_CACHE_ADDR_IX *)Mem_SegAlloc("DNSc Cache Addr Index",
+                                                              p_cfg->MemSegPtr,
+                                                             (ix_nbr * sizeof(DNSc_CACHE_ADDR_IX)),
+                                                             &err);
     if (err != LIB_MEM_ERR_NONE) {
        *p_err = DNSc_ERR_MEM_ALLOC;
         goto exit;
     }
 
-    Mem_DynPoolCreate("DNSc Cache Req Cfg Pool",
-                      &DNScCache_ReqCfgPool,
-                       p_cfg->MemSegPtr,
-                       sizeof(DNSc_REQ_CFG),
-                       sizeof(CPU_ALIGN),
-                       1u,
-                       p_cfg->CacheEntriesMaxNbr,
-                      &err);
+    for (ix = 0u; ix < ix_nbr; ix++) {
+        DNScCache_AddrIxTbl[ix].HostPtr = DEF_NULL;
+    }
+    DNScCache_AddrIxMask = ix_nbr - 1u;
+
+                                                                /* ----------- CREATE QUERY ID INDEX (Note #4) -------- */
+    ix_nbr = 2u;
+    while (ix_nbr < (2u * p_cfg->CacheEntriesMaxNbr)) {
+        ix_nbr <<= 1u;
+    }
+
+    DNScCache_QueryIxTbl = (DNSc_CACHE_QUERY_IX *)Mem_SegAlloc("DNSc Cache Query ID Index",
+                                                                p_cfg->MemSegPtr,
+                                                               (ix_nbr * sizeof(DNSc_CACHE_QUERY_IX)),
+                                                               &err);
     if (err != LIB_MEM_ERR_NONE) {
        *p_err = DNSc_ERR_MEM_ALLOC;
         goto exit;
     }
 
+    for (ix = 0u; ix < ix_nbr; ix++) {
+        DNScCache_QueryIxTbl[ix].HostPtr = DEF_NULL;
+    }
+    DNScCache_QueryIxMask = ix_nbr - 1u;
+
 
    *p_err = DNSc_ERR_NONE;
 
@@ -391,12 +794,12 @@ exit:
 *                           RETURNED BY DNScCache_LockAcquire():
 *                               See DNScCache_LockAcquire() for additional return error codes.
 *
-*                           RETURNED BY DNScCache_ItemGet():
-*                               See DNScCache_ItemGet() for additional return error codes.
+*                           RETURNED BY DNScCache_HostLink():
+*                               See DNScCache_HostLink() for additional return error codes.
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScTask_ResolveHost().
+* Caller(s)   : DNSc_GetHost().
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
@@ -407,37 +810,62 @@ exit:
 void  DNScCache_HostInsert (DNSc_HOST_OBJ  *p_host,
                             DNSc_ERR       *p_err)
 {
-    DNSc_CACHE_ITEM  *p_cache;
-
-
     DNScCache_LockAcquire(p_err);
     if (*p_err != DNSc_ERR_NONE) {
          goto exit;
     }
 
-    p_cache = DNScCache_ItemGet(p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-         goto exit_release;
-    }
+    DNScCache_HostLink(p_host, p_err);
 
-    p_cache->HostPtr = p_host;
+    DNScCache_LockRelease();
 
-    if (DNSc_CacheItemListHead == DEF_NULL) {
-        p_cache->NextPtr        = DEF_NULL;
-        DNSc_CacheItemListHead  = p_cache;
-    } else {
-        p_cache->NextPtr        = DNSc_CacheItemListHead;
-        DNSc_CacheItemListHead  = p_cache;
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostPendInsert()
+*
+* Description : Add a host to the list of hosts being resolved by the task.
+*
+* Argument(s) : p_host  Pointer to host object, already in the cache.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE   Host added, or already in the list.
+*
+*                           RETURNED BY DNScCache_LockAcquire():
+*                               See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScTask_HostResolve().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+void  DNScCache_HostPendInsert (DNSc_HOST_OBJ  *p_host,
+                                DNSc_ERR       *p_err)
+{
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
     }
 
-   *p_err = DNSc_ERR_NONE;
+    DNScCache_PendLink(p_host);
 
-exit_release:
     DNScCache_LockRelease();
 
 exit:
     return;
 }
+#endif
 
 
 
@@ -521,13 +949,87 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_HostRemove()
+*                                        DNScCache_HostCancel()
 *
-* Description : Remove host from the cache.
+* Description : Search host name in cache and cancel its pending resolution.
 *
-* Argument(s) : p_host  Pointer to the host object.
+* Argument(s) : p_host_name     Pointer to a string that contains the host name.
 *
-* Return(s)   : None.
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   DNSc_ERR_NONE                   Resolution canceled, or already completed.
+*                                   DNSc_ERR_CACHE_HOST_NOT_FOUND   Host not found in the cache.
+*
+*                                   RETURNED BY DNScCache_LockAcquire():
+*                                       See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_Cancel().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The entry is left in the cache as failed, as after any other failed resolution.
+*
+*               (2) A caller blocked on the resolution is released, & gets the failure.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+void  DNScCache_HostCancel (const  CPU_CHAR  *p_host_name,
+                                   DNSc_ERR  *p_err)
+{
+    DNSc_HOST_OBJ  *p_host;
+
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+
+    p_host = DNScCache_HostSrchByName(p_host_name, DNSc_FLAG_NONE);
+    if (p_host == DEF_NULL) {
+       *p_err = DNSc_ERR_CACHE_HOST_NOT_FOUND;
+        goto exit_release;
+    }
+
+    switch (p_host->State) {
+        case DNSc_STATE_RESOLVED:
+        case DNSc_STATE_FAILED:
+             break;
+
+        default:
+             DNScCache_HostAbort(p_host);                       /* See Note #1.                                         */
+             DNScCache_PendUnlink(p_host);
+             DNScCache_ResolverStats.Errs[DNSc_STATS_ERR_CANCELED]++;
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+             DNScCache_HostSignal(p_host);
+#endif
+             break;
+    }
+
+   *p_err = DNSc_ERR_NONE;
+
+
+exit_release:
+    DNScCache_LockRelease();
+
+exit:
+    return;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostRemove()
+*
+* Description : Remove host from the cache.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : None.
 *
 * Caller(s)   : DNScTask_HostResolve().
 *
@@ -557,211 +1059,264 @@ exit:
 
 /*
 *********************************************************************************************************
-*                                           DNScCache_Srch()
+*                                         DNScCache_StatsGet()
 *
-* Description : Search host in cache and return IP addresses, if found.
+* Description : Get a copy of the cache statistics.
 *
-* Argument(s) : p_host_name         Pointer to a string that contains the host name.
+* Argument(s) : p_stats     Pointer to the structure that will receive the statistics.
 *
-*               p_host_obj          Pointer to a pointer to the host entry in the cache (if found).
+*               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*               p_addrs             Pointer to addresses array.
+*                               DNSc_ERR_NONE   Statistics successfully copied.
 *
-*               addr_nbr_max        Number of address the address array can contain.
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
 *
-*               p_addr_nbr_rtn      Pointer to a variable that will receive number of addresses copied.
+* Return(s)   : None.
 *
-*               flags           DNS client flag:
+* Caller(s)   : DNSc_CacheStatsGet().
 *
-*                                   DNSc_FLAG_NONE              By default all IP address can be returned.
-*                                   DNSc_FLAG_IPv4_ONLY         Return only IPv4 address(es).
-*                                   DNSc_FLAG_IPv6_ONLY         Return only IPv6 address(es).
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-*               p_err               Pointer to variable that will receive the return error code from this function :
+* Note(s)     : (1) .FrontHits is incremented without the cache lock (see 'FRONT CACHE ENTRY DATA TYPE'
+*                   Note #2), the copy is done within a critical section.
+*********************************************************************************************************
+*/
+
+void  DNScCache_StatsGet (DNSc_CACHE_STATS  *p_stats,
+                          DNSc_ERR          *p_err)
+{
+    CPU_SR_ALLOC();
+
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+   *p_stats = DNScCache_Stats;
+    CPU_CRITICAL_EXIT();
+
+    DNScCache_LockRelease();
+
+   *p_err = DNSc_ERR_NONE;
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_StatsReset()
 *
-*                                       DNSc_ERR_NONE                   Host found.
-*                                       DNSc_ERR_CACHE_HOST_PENDING     Host resolution is pending.
-*                                       DNSc_ERR_CACHE_HOST_NOT_FOUND   Host not found in the cache.
+* Description : Reset the cache statistics.
 *
-*                                       RETURNED BY DNScCache_LockAcquire():
-*                                           See DNScCache_LockAcquire() for additional return error codes.
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
 *
-* Return(s)   : Resolution status:
-*                       DNSc_STATUS_PENDING         Host resolution is pending, call again to see the status. (Processed by DNSc's task)
-*                       DNSc_STATUS_RESOLVED        Host is resolved.
-*                       DNSc_STATUS_FAILED          Host resolution has failed.
+*                               DNSc_ERR_NONE   Statistics successfully reset.
 *
-* Caller(s)   : DNSc_GetHost().
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_CacheStatsReset().
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : (1) 'p_host_obj' is dereferenced & assigned a value of DEF_NULL if cache entry is NOT found.
+* Note(s)     : (1) The number of entries currently in the cache is kept & becomes the new peak.
 *********************************************************************************************************
 */
 
-DNSc_STATUS  DNScCache_Srch (const  CPU_CHAR        *p_host_name,
-                                    DNSc_HOST_OBJ  **p_host_obj,
-                                    DNSc_ADDR_OBJ   *p_addrs,
-                                    CPU_INT08U       addr_nbr_max,
-                                    CPU_INT08U      *p_addr_nbr_rtn,
-                                    DNSc_FLAGS       flags,
-                                    DNSc_ERR        *p_err)
+void  DNScCache_StatsReset (DNSc_ERR  *p_err)
 {
-    CPU_INT08U       i          = 0u;
-    DNSc_HOST_OBJ   *p_host     = DEF_NULL;
-    DNSc_ADDR_OBJ   *p_addr     = DEF_NULL;
-    DNSc_ADDR_ITEM  *p_item     = DEF_NULL;
-    DNSc_STATUS      status     = DNSc_STATUS_FAILED;
-    CPU_BOOLEAN      no_ipv4    = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv6_ONLY);
-    CPU_BOOLEAN      no_ipv6    = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv4_ONLY);
+    CPU_INT16U  entries_cur;
+    CPU_INT16U  entries_max;
+    CPU_SR_ALLOC();
 
 
-   *p_addr_nbr_rtn = 0u;
-
     DNScCache_LockAcquire(p_err);
     if (*p_err != DNSc_ERR_NONE) {
          goto exit;
     }
 
-    p_host = DNScCache_HostSrchByName(p_host_name, flags);
-    if (p_host != DEF_NULL) {
-        switch(p_host->State) {
-#ifdef  DNSc_TASK_MODULE_EN
-            case DNSc_STATE_IF_SEL:                             /* A req for host may have been started by another task.*/
-            case DNSc_STATE_INIT_REQ:
-#endif
-            case DNSc_STATE_TX_REQ_IPv4:
-            case DNSc_STATE_RX_RESP_IPv4:
-            case DNSc_STATE_TX_REQ_IPv6:
-            case DNSc_STATE_RX_RESP_IPv6:
-            case DNSc_STATE_TX_REQ_PTR_IPv4:
-            case DNSc_STATE_RX_RESP_PTR_IPv4:
-            case DNSc_STATE_TX_REQ_PTR_IPv6:
-            case DNSc_STATE_RX_RESP_PTR_IPv6:
-                 status = DNSc_STATUS_PENDING;
-                *p_err  = DNSc_ERR_CACHE_HOST_PENDING;
-                 goto exit_release;
+    CPU_CRITICAL_ENTER();
+    entries_cur = DNScCache_Stats.EntriesCur;                   /* See Note #1.                                         */
+    entries_max = DNScCache_Stats.EntriesMax;
+    Mem_Clr(&DNScCache_Stats, sizeof(DNScCache_Stats));
+    DNScCache_Stats.EntriesCur  = entries_cur;
+    DNScCache_Stats.EntriesPeak = entries_cur;
+    DNScCache_Stats.EntriesMax  = entries_max;
+    CPU_CRITICAL_EXIT();
 
-            case DNSc_STATE_RESOLVED:
-                 status = DNSc_STATUS_RESOLVED;
-                 goto exit_found;
+    DNScCache_LockRelease();
 
-            case DNSc_STATE_FAILED:
-            default:
-                *p_err = DNSc_ERR_NONE;
-                 goto exit_release;
-        }
-    }
+   *p_err = DNSc_ERR_NONE;
 
-   *p_err = DNSc_ERR_CACHE_HOST_NOT_FOUND;                      /* Not found.                                           */
+exit:
+    return;
+}
 
-    goto exit_release;
 
+/*
+*********************************************************************************************************
+*                                     DNScCache_ResolverStatsGet()
+*
+* Description : Get a copy of the resolver statistics.
+*
+* Argument(s) : p_stats     Pointer to the structure that will receive the statistics.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE   Statistics successfully copied.
+*
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_ResolverStatsGet().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The resolver statistics are only updated by DNScCache_Resolve(), which always runs with the
+*                   cache lock held.
+*********************************************************************************************************
+*/
 
-exit_found:
+void  DNScCache_ResolverStatsGet (DNSc_RESOLVER_STATS  *p_stats,
+                                  DNSc_ERR             *p_err)
+{
+    DNScCache_LockAcquire(p_err);                               /* See Note #1.                                         */
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
 
-    p_item = p_host->AddrsFirstPtr;
+   *p_stats = DNScCache_ResolverStats;
 
+    DNScCache_LockRelease();
 
-    for (i = 0u; i < p_host->AddrsCount; i++) {                 /* Copy Addresses                                       */
-        p_addr = p_item->AddrPtr;
-        if (*p_addr_nbr_rtn < addr_nbr_max) {
-            CPU_BOOLEAN  add_addr = DEF_YES;
+   *p_err = DNSc_ERR_NONE;
 
+exit:
+    return;
+}
 
-            switch (p_addr->Len) {
-                case NET_IPv4_ADDR_SIZE:
-                     if (no_ipv4 == DEF_YES) {
-                         add_addr = DEF_NO;
-                     }
-                     break;
 
-                case NET_IPv6_ADDR_SIZE:
-                     if (no_ipv6 == DEF_YES) {
-                         add_addr = DEF_NO;
-                     }
-                     break;
+/*
+*********************************************************************************************************
+*                                    DNScCache_ResolverStatsReset()
+*
+* Description : Reset the resolver statistics.
+*
+* Argument(s) : p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE   Statistics successfully reset.
+*
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_ResolverStatsReset().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The servers keep their slot, since requests in progress refer to it by index.
+*********************************************************************************************************
+*/
 
-                default:
-                     add_addr = DEF_NO;
-                     break;
-            }
+void  DNScCache_ResolverStatsReset (DNSc_ERR  *p_err)
+{
+    DNSc_SERVER_STATS  *p_server;
+    DNSc_ADDR_OBJ       addr;
+    CPU_INT08U          ix;
 
-            if (add_addr == DEF_YES) {
-                p_addrs[*p_addr_nbr_rtn] = *p_addr;
-               *p_addr_nbr_rtn += 1u;
-            }
 
-            p_item = p_item->NextPtr;
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
 
-        } else {
-            goto exit_release;
-        }
+    DNScCache_ResolverStats.Req      = 0u;
+    DNScCache_ResolverStats.ReTx     = 0u;
+    DNScCache_ResolverStats.Timeouts = 0u;
+    Mem_Clr(DNScCache_ResolverStats.Errs,     sizeof(DNScCache_ResolverStats.Errs));
+    Mem_Clr(DNScCache_ResolverStats.QTypeLat, sizeof(DNScCache_ResolverStats.QTypeLat));
+
+    for (ix = 0u; ix < DNSc_CFG_STATS_SERVER_NBR_MAX; ix++) {   /* See Note #1.                                         */
+        p_server = &DNScCache_ResolverStats.Servers[ix];
+        addr     =  p_server->Addr;
+        Mem_Clr(p_server, sizeof(DNSc_SERVER_STATS));
+        p_server->Addr = addr;
     }
 
-   (void)&p_addr_nbr_rtn;
+    DNScCache_LockRelease();
 
    *p_err = DNSc_ERR_NONE;
 
-exit_release:
-    DNScCache_LockRelease();
-
 exit:
-   *p_host_obj = p_host;
-    return (status);
+    return;
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_HostObjGet()
+*                                         DNScCache_EntryGet()
 *
-* Description : Get a free host object.
+* Description : Get a copy of a cache entry.
 *
-* Argument(s) : p_host_name     Pointer to a string that contains the domain name.
+* Argument(s) : ix              Index of the entry in the cache list.
 *
-*               flags           DNS client flag:
+*               p_name          Pointer to the buffer that will receive the host name.
 *
-*                                   DNSc_FLAG_NONE              By default this function is blocking.
-*                                   DNSc_FLAG_NO_BLOCK          Don't block (only possible if DNSc's task is enabled).
-*                                   DNSc_FLAG_FORCE_CACHE       Take host from the cache, don't send new DNS request.
-*                                   DNSc_FLAG_FORCE_RENEW       Force DNS request, remove existing entry in the cache.
-*                                   DNSc_FLAG_CANON             Force this function to allocate a canonical name object.
-*                                   DNSc_FLAG_REVERSE_LOOKUP    Force this function to allocate a reverse name object.
+*               name_len_max    Size of the host name buffer.
 *
-*               p_cfg           Pointer to a request configuration. Should be set to overwrite default DNS configuration
-*                               (such as DNS server, request timeout, etc.). Must be set to DEF_NULL to use default
-*                               configuration.
+*               p_state         Pointer to a variable that will receive the state of the entry.
 *
-*               p_err           Pointer to variable that will receive the return error code from this function :
+*               p_ttl_ms        Pointer to a variable that will receive the remaining TTL of the entry, in ms.
 *
-*                                   DNSc_ERR_NONE           Successfully acquired a host object.
-*                                   DNSc_ERR_MEM_ALLOC      Not able to allocate a host object.
+*               p_addrs         Pointer to the table that will receive the addresses of the entry.
+*
+*               p_addr_nbr      Pointer to a variable that contains the number of addresses that the table can
+*                               hold & that will receive the number of addresses copied.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   DNSc_ERR_NONE                   Entry successfully copied.
+*                                   DNSc_ERR_CACHE_HOST_NOT_FOUND   No entry at this index.
 *
 *                                   RETURNED BY DNScCache_LockAcquire():
 *                                       See DNScCache_LockAcquire() for additional return error codes.
 *
-*                                   RETURNED BY DNScCache_HostObjNameSet():
-*                                       See DNScCache_HostObjNameSet() for additional return error codes.
+* Return(s)   : None.
 *
-* Return(s)   : Pointer to the host object acquired.
+* Caller(s)   : DNSc_CacheEntryGet().
 *
-* Caller(s)   : DNSc_GetHost().
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The remaining TTL is only set for resolved entries, it is 0 otherwise.
+*
+*               (2) The list is walked from its head on each call; it is meant for diagnostics, not for the
+*                   resolution path. Entries may move between two calls if the cache is modified.
 *********************************************************************************************************
 */
 
-DNSc_HOST_OBJ  *DNScCache_HostObjGet (const  CPU_CHAR      *p_host_name,
-                                             DNSc_FLAGS     flags,
-                                             DNSc_REQ_CFG  *p_cfg,
-                                             DNSc_ERR      *p_err)
+void  DNScCache_EntryGet (CPU_INT16U      ix,
+                          CPU_CHAR       *p_name,
+                          CPU_INT16U      name_len_max,
+                          DNSc_STATE     *p_state,
+                          CPU_INT32U     *p_ttl_ms,
+                          DNSc_ADDR_OBJ  *p_addrs,
+                          CPU_INT08U     *p_addr_nbr,
+                          DNSc_ERR       *p_err)
 {
-#ifdef DNSc_SIGNAL_TASK_MODULE_EN
-    KAL_SEM_HANDLE   sem    = KAL_SemHandleNull;
-#endif
-    DNSc_HOST_OBJ   *p_host = DEF_NULL;
-    LIB_ERR          err;
+    DNSc_CACHE_ITEM  *p_item;
+    DNSc_HOST_OBJ    *p_host;
+    CPU_INT08U        addr_nbr;
+    CPU_INT16U        i;
 
 
     DNScCache_LockAcquire(p_err);
@@ -769,863 +1324,2882 @@ DNSc_HOST_OBJ  *DNScCache_HostObjGet (const  CPU_CHAR      *p_host_name,
          goto exit;
     }
 
-    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_RESET_REQ)) {
-        p_host = DNScCache_HostSrchByName(p_host_name, flags);
-        if (p_host != DEF_NULL) {
-            goto host_assign_req_params;
-        }
-    }
-
-    p_host = (DNSc_HOST_OBJ *)Mem_DynPoolBlkGet(&DNScCache_HostObjPool, &err);
-    if (err == LIB_MEM_ERR_NONE) {
-        p_host->NamePtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&DNScCache_HostNamePool, &err);
-        if (err != LIB_MEM_ERR_NONE) {
-           *p_err = DNSc_ERR_MEM_ALLOC;
-            goto exit_free_host_obj;
-        }
-    } else {
-        p_host = DNScCache_ItemHostGet();
+    p_item = DNSc_CacheItemListHead;                            /* See Note #2.                                         */
+    for (i = 0u; (i < ix) && (p_item != DEF_NULL); i++) {
+        p_item = p_item->NextPtr;
     }
 
-    if (p_host == DEF_NULL) {
-       *p_err = DNSc_ERR_MEM_ALLOC;
+    if (p_item == DEF_NULL) {
+       *p_err = DNSc_ERR_CACHE_HOST_NOT_FOUND;
         goto exit_release;
     }
-                                                                /* ---------- ACQUIRE SIGNAL TASK SEMAPHORE ----------- */
-
-
-    if (p_host->NamePtr == DEF_NULL) {
-        p_host->NameLenMax = DNScCache_HostNamePool.BlkSize - 1;
-    }
-
-    p_host->NameLenMax = DNScCache_HostNamePool.BlkSize;
-    Mem_Clr(p_host->NamePtr, p_host->NameLenMax);
-
-    if (p_host->CanonicalNamePtr == DEF_NULL) {
-        if (DEF_BIT_IS_SET(flags, DNSc_FLAG_CANON) == DEF_YES) {
-            p_host->CanonicalNamePtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&DNScCache_HostCanonNamePool, &err);
-            if (err != LIB_MEM_ERR_NONE) {
-               *p_err = DNSc_ERR_MEM_ALLOC;
-                goto exit_free_host_obj;
-            }
-            Mem_Clr(p_host->CanonicalNamePtr, p_host->NameLenMax);
-        }
-    }
-
-    p_host->AddrsCount     = 0u;
-    p_host->AddrsIPv4Count = 0u;
-    p_host->AddrsIPv6Count = 0u;
-    p_host->QueryID        = DNSc_QUERY_ID_NONE;
-    p_host->ReqCtr         = 0u;
-    p_host->AddrsFirstPtr  = DEF_NULL;
-    p_host->AddrsEndPtr    = DEF_NULL;
-    p_host->State          = DNSc_STATE_INIT_REQ;
-
-    DNScCache_HostObjNameSet(p_host, p_host_name, p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-         goto exit_release;
-    }
-
-host_assign_req_params:
-#ifdef DNSc_SIGNAL_TASK_MODULE_EN
-    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_NO_BLOCK) == DEF_NO) {
-        KAL_ERR  kal_err;
-
-
-        if (p_host->TaskSignal.SemObjPtr == KAL_SemHandleNull.SemObjPtr) {
-            sem = KAL_SemCreate("DNSc Block Task Signal", DEF_NULL, &kal_err);
-            if (kal_err != KAL_ERR_NONE) {
-               *p_err = DNSc_ERR_MEM_ALLOC;
-                goto exit_free_host_obj;
-            }
-        }
-        p_host->TaskSignal = sem;
-    }
-#endif
-
-    if (p_host->ReverseNamePtr == DEF_NULL) {
-        if (DEF_BIT_IS_SET(flags, DNSc_FLAG_REVERSE_LOOKUP) == DEF_YES) {
-            p_host->ReverseNamePtr = (CPU_CHAR *)Mem_DynPoolBlkGet(&DNScCache_HostRevNamePool, &err);
-            if (err != LIB_MEM_ERR_NONE) {
-               *p_err = DNSc_ERR_MEM_ALLOC;
-                goto exit_free_host_obj;
-            }
-            Mem_Clr(p_host->ReverseNamePtr, p_host->NameLenMax);
-        }
-    }
-
-
-    if (p_host->ReqCfgPtr == DEF_NULL) {
-        p_host->ReqCfgPtr = (DNSc_REQ_CFG *)Mem_DynPoolBlkGet(&DNScCache_ReqCfgPool, &err);
-        if (err != LIB_MEM_ERR_NONE) {
-           *p_err  = DNSc_ERR_MEM_ALLOC;
-            goto exit_free_host_obj;
-        }
-    }
 
-    p_host->ReqCfgPtr->ReqFlags      = p_cfg->ReqFlags;
-    p_host->ReqCfgPtr->ReqRetry      = p_cfg->ReqRetry;
-    p_host->ReqCfgPtr->ReqTimeout_ms = p_cfg->ReqTimeout_ms;
-    p_host->ReqCfgPtr->ReqType       = p_cfg->ReqType;
-    p_host->ReqCfgPtr->ServerAddrPtr = p_cfg->ServerAddrPtr;
-    p_host->ReqCfgPtr->ServerPort    = p_cfg->ServerPort;
-    p_host->ReqCfgPtr->TaskDly_ms    = p_cfg->TaskDly_ms;
+    p_host = p_item->HostPtr;
 
+    Str_Copy_N(p_name, p_host->NamePtr, name_len_max);
+    p_name[name_len_max - 1u] = ASCII_CHAR_NULL;
 
-    p_host->TS_ms  = 0u;
-    p_host->IF_Nbr = NET_IF_NBR_WILDCARD;
-    p_host->SockID = NET_SOCK_ID_NONE;
-
-    if ((DEF_BIT_IS_SET(flags, DNSc_FLAG_RESET_REQ) && (p_host->State == DNSc_STATE_RESOLVED))) {
-        p_host->State = DNSc_STATE_INIT_REQ;
+   *p_state  = p_host->State;
+   *p_ttl_ms = 0u;
+    if (p_host->State == DNSc_STATE_RESOLVED) {                 /* See Note #1.                                         */
+       *p_ttl_ms = DNScCache_HostTTL_Get(p_host, DNScTask_TS_Get_ms());
     }
 
-    goto exit_release;
-
+    addr_nbr = DEF_MIN(*p_addr_nbr, p_host->AddrsCount);
+    Mem_Copy(p_addrs, p_host->AddrsTblPtr, addr_nbr * sizeof(DNSc_ADDR_OBJ));
+   *p_addr_nbr = addr_nbr;
 
-exit_free_host_obj:
-    Mem_DynPoolBlkFree(&DNScCache_HostObjPool, p_host, &err);
+   *p_err = DNSc_ERR_NONE;
 
 exit_release:
     DNScCache_LockRelease();
 
 exit:
-    return (p_host);
+    return;
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_HostObjFree()
+*                                          DNScCache_Export()
 *
-* Description : Free a host object.
+* Description : Serialize the resolved entries of the cache in a buffer.
 *
-* Argument(s) : p_host  Pointer to the host object to free.
+* Argument(s) : p_buf       Pointer to the buffer that will receive the serialized entries.
+*
+*               buf_len     Length of the buffer.
+*
+*               p_len_rtn   Pointer to a variable that will receive the length of the serialized data.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE       All resolved entries successfully serialized.
+*                               DNSc_ERR_BUF_LEN    Buffer too small, only the entries that fit were serialized.
+*
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScCache_HostRelease(),
-*               DNSc_GetHost().
+* Caller(s)   : DNSc_CacheExport().
 *
-* Note(s)     : None.
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The data is made of a header followed by one record per entry. Every multi-octet value,
+*                   IPv4 addresses included, is stored in network order :
+*
+*                       Header : Magic 'DNSc' (4), version (1), reserved (1), number of entries (2).
+*
+*                       Entry  : Name length (2), name (n), remaining TTL in seconds (4), number of
+*                                addresses (1), then for every address its length (1) & its octets.
+*
+*               (2) Only forward entries that are resolved & whose TTL has not expired are serialized.
+*
+*               (3) When DNSc_ERR_BUF_LEN is returned, the data in the buffer is still valid & can be imported.
 *********************************************************************************************************
 */
 
-void  DNScCache_HostObjFree (DNSc_HOST_OBJ  *p_host)
+void  DNScCache_Export (CPU_INT08U  *p_buf,
+                        CPU_SIZE_T   buf_len,
+                        CPU_SIZE_T  *p_len_rtn,
+                        DNSc_ERR    *p_err)
 {
-    LIB_ERR  err;
+    DNSc_CACHE_ITEM  *p_cache;
+    DNSc_HOST_OBJ    *p_host;
+    DNSc_ADDR_OBJ    *p_addr;
+    CPU_INT08U       *p_data;
+    CPU_SIZE_T        len;
+    CPU_SIZE_T        entry_len;
+    CPU_INT32U        ttl_ms;
+    CPU_INT32U        data_32;
+    CPU_INT16U        data_16;
+    CPU_INT16U        entry_nbr = 0u;
+    NET_TS_MS         ts_cur_ms;
+    CPU_INT08U        i;
+
+
+   *p_len_rtn = 0u;
+
+    if (buf_len < DNSc_CACHE_EXPORT_HDR_SIZE) {
+       *p_err = DNSc_ERR_BUF_LEN;
+        goto exit;
+    }
 
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
 
-#ifdef DNSc_SIGNAL_TASK_MODULE_EN
-    if (p_host->TaskSignal.SemObjPtr != KAL_SemHandleNull.SemObjPtr) {
-        KAL_ERR  kal_err;
+    ts_cur_ms = DNScTask_TS_Get_ms();
+    len       = DNSc_CACHE_EXPORT_HDR_SIZE;
+    p_cache   = DNSc_CacheItemListHead;
+   *p_err     = DNSc_ERR_NONE;
+
+    while (p_cache != DEF_NULL) {
+        p_host  = p_cache->HostPtr;
+        p_cache = p_cache->NextPtr;
+                                                                /* See Note #2.                                         */
+        if ((p_host->State          != DNSc_STATE_RESOLVED) ||
+            (p_host->ReverseNamePtr != DEF_NULL)            ||
+            (p_host->AddrsCount     == 0u)) {
+            continue;
+        }
 
+        ttl_ms = DNScCache_HostTTL_Get(p_host, ts_cur_ms);
+        if (ttl_ms == 0u) {
+            continue;
+        }
 
-        KAL_SemDel(p_host->TaskSignal, &kal_err);
+        entry_len = DNSc_CACHE_EXPORT_ENTRY_HDR_SIZE + p_host->NameLen;
+        for (i = 0u; i < p_host->AddrsCount; i++) {
+            entry_len += sizeof(CPU_INT08U) + p_host->AddrsTblPtr[i].Len;
+        }
+
+        if (((len + entry_len) >  buf_len) ||                   /* See Note #3.                                         */
+             (entry_nbr        == DEF_INT_16U_MAX_VAL)) {
+           *p_err = DNSc_ERR_BUF_LEN;
+            break;
+        }
+
+        p_data  = p_buf + len;                                  /* ------------------ WR ENTRY HDR -------------------- */
+        data_16 = NET_UTIL_HOST_TO_NET_16(p_host->NameLen);
+        Mem_Copy(p_data, &data_16, sizeof(CPU_INT16U));
+        p_data += sizeof(CPU_INT16U);
+
+        Mem_Copy(p_data, p_host->NamePtr, p_host->NameLen);
+        p_data += p_host->NameLen;
+                                                                /* Round remaining TTL up to the next second.           */
+        data_32 = (ttl_ms + DEF_TIME_NBR_mS_PER_SEC - 1u) / DEF_TIME_NBR_mS_PER_SEC;
+        data_32 =  NET_UTIL_HOST_TO_NET_32(data_32);
+        Mem_Copy(p_data, &data_32, sizeof(CPU_INT32U));
+        p_data += sizeof(CPU_INT32U);
+
+       *p_data  = p_host->AddrsCount;
+        p_data++;
+
+        for (i = 0u; i < p_host->AddrsCount; i++) {             /* --------------------- WR ADDRS --------------------- */
+            p_addr  = &p_host->AddrsTblPtr[i];
+           *p_data  =  p_addr->Len;
+            p_data++;
+            if (p_addr->Len == NET_IPv4_ADDR_LEN) {             /* IPv4 addrs are kept in host order (see Note #1).     */
+                Mem_Copy(&data_32, p_addr->Addr, sizeof(CPU_INT32U));
+                data_32 = NET_UTIL_HOST_TO_NET_32(data_32);
+                Mem_Copy(p_data, &data_32, sizeof(CPU_INT32U));
+            } else {
+                Mem_Copy(p_data, p_addr->Addr, p_addr->Len);
+            }
+            p_data += p_addr->Len;
+        }
+
+        len += entry_len;
+        entry_nbr++;
     }
 
-    p_host->TaskSignal = KAL_SemHandleNull;
-#endif
+                                                                /* --------------------- WR HDR ----------------------- */
+    data_32 = NET_UTIL_HOST_TO_NET_32(DNSc_CACHE_EXPORT_MAGIC);
+    Mem_Copy(p_buf, &data_32, sizeof(CPU_INT32U));
+    p_buf[4] = DNSc_CACHE_EXPORT_VER;
+    p_buf[5] = 0u;
+    data_16  = NET_UTIL_HOST_TO_NET_16(entry_nbr);
+    Mem_Copy(&p_buf[6], &data_16, sizeof(CPU_INT16U));
 
+   *p_len_rtn = len;
 
-    DNScCache_HostAddrClr(p_host);
-    Mem_DynPoolBlkFree(&DNScCache_HostNamePool, p_host->NamePtr, &err);
-                                                                /* .CanonicalNamePtr & .ReverseNamePtr were allocated...*/
-                                                                /* ...if these features were configured  and if their...*/
-                                                                /* ...respective flags were set. If they were not set...*/
-                                                                /* ...the following call(s) return(s) an error, which...*/
-                                                                /* ...shall be ignored.                                 */
-    Mem_DynPoolBlkFree(&DNScCache_HostCanonNamePool, p_host->CanonicalNamePtr, &err);
-    Mem_DynPoolBlkFree(&DNScCache_HostRevNamePool,   p_host->ReverseNamePtr,   &err);
-    Mem_DynPoolBlkFree(&DNScCache_ReqCfgPool,        p_host->ReqCfgPtr,        &err);
-    Mem_DynPoolBlkFree(&DNScCache_HostObjPool,       p_host,                   &err);
+    DNScCache_LockRelease();
 
-    p_host->ReverseNamePtr = (CPU_CHAR *)DEF_NULL;
+exit:
+    return;
 }
 
 
 /*
 *********************************************************************************************************
-*                                      DNScCache_HostAddrInsert()
+*                                          DNScCache_Import()
 *
-* Description : Insert address object in the addresses list of the host object.
+* Description : Add to the cache the entries serialized by DNScCache_Export().
 *
-* Argument(s) : p_cfg       Pointer to DNSc's configuration.
-*
-*               p_host      Pointer to the host object.
-*
-*               p_addr      Pointer to the address object (must be acquired with cache module)
+* Argument(s) : p_buf       Pointer to the serialized entries.
 *
-*               is_reverse  Indicates if address has been previously resolved as a result of a reverse lookup.
+*               buf_len     Length of the serialized data.
 *
 *               p_err       Pointer to variable that will receive the return error code from this function :
 *
-*                               DNSc_ERR_NONE       Address successfully added.
-*                               DNSc_ERR_MEM_ALLOC  Unable to insert the IP address due to the memory configuration
-*                               DNSc_ERR_FAULT      Unknown error (should not occur)
+*                               DNSc_ERR_NONE           Entries successfully imported.
+*                               DNSc_ERR_INVALID_ARG    Invalid or truncated data.
+*                               DNSc_ERR_MEM_ALLOC      Cache full, only the first entries were imported.
 *
-*                               RETURNED BY DNScCache_AddrItemGet():
-*                                   See DNScCache_AddrItemGet() for additional return error codes.
+*                               RETURNED BY DNScCache_LockAcquire():
+*                                   See DNScCache_LockAcquire() for additional return error codes.
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScReq_RxRespAddAddr().
+* Caller(s)   : DNSc_CacheImport().
 *
-* Note(s)     : None.
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) See DNScCache_Export() Note #1 for the data format.
+*
+*               (2) The remaining TTL of each entry is re-based on the current timestamp. Entries whose name is
+*                   already in the cache or that have no address usable with the current configuration are
+*                   skipped.
+*
+*               (3) Imported entries only use free cache entries, entries already in the cache are never
+*                   evicted to make room for them.
+*
+*               (4) The data doesn't record the address families an entry was resolved for: the families of
+*                   its addresses are taken as resolved, a lookup for another family resolves it in the entry.
 *********************************************************************************************************
 */
 
-void  DNScCache_HostAddrInsert (const  DNSc_CFG       *p_cfg,
-                                       DNSc_HOST_OBJ  *p_host,
-                                       DNSc_ADDR_OBJ  *p_addr,
-                                       CPU_BOOLEAN     is_reverse,
-                                       DNSc_ERR       *p_err)
+void  DNScCache_Import (const  CPU_INT08U  *p_buf,
+                               CPU_SIZE_T   buf_len,
+                               DNSc_ERR    *p_err)
 {
-    DNSc_ADDR_ITEM  *p_item_cur;
+           DNSc_CACHE_ITEM  *p_cache;
+           DNSc_HOST_OBJ    *p_host;
+           DNSc_ADDR_OBJ     addr;
+    const  CPU_INT08U       *p_data;
+    const  CPU_INT08U       *p_name;
+    const  CPU_INT08U       *p_addrs;
+           CPU_SIZE_T        len_rem;
+           CPU_SIZE_T        addrs_len;
+           CPU_INT32U        data_32;
+           CPU_INT32U        ttl_s;
+           CPU_INT32U        name_hash;
+           CPU_INT16U        name_len;
+           CPU_INT16U        entry_nbr;
+           CPU_INT16U        ix;
+           CPU_INT08U        addr_nbr;
+           CPU_INT08U        addr_len;
+           CPU_INT08U        i;
+           CPU_BOOLEAN       found;
+           NET_TS_MS         ts_cur_ms;
+           DNSc_ERR          err;
+
+
+                                                                /* --------------------- RD HDR ----------------------- */
+    if (buf_len < DNSc_CACHE_EXPORT_HDR_SIZE) {
+       *p_err = DNSc_ERR_INVALID_ARG;
+        goto exit;
+    }
 
+    Mem_Copy(&data_32, p_buf, sizeof(CPU_INT32U));
+    data_32 = NET_UTIL_NET_TO_HOST_32(data_32);
+    if ((data_32  != DNSc_CACHE_EXPORT_MAGIC) ||
+        (p_buf[4] != DNSc_CACHE_EXPORT_VER)) {
+       *p_err = DNSc_ERR_INVALID_ARG;
+        goto exit;
+    }
 
-    switch (p_addr->Len) {
-        case NET_IPv4_ADDR_SIZE:
-             if (p_host->AddrsIPv4Count >= p_cfg->AddrIPv4MaxPerHost) {
-                *p_err = DNSc_ERR_MEM_ALLOC;
-                 return;
-             }
-             break;
+    Mem_Copy(&entry_nbr, &p_buf[6], sizeof(CPU_INT16U));
+    entry_nbr = NET_UTIL_NET_TO_HOST_16(entry_nbr);
 
+    p_data  = p_buf   + DNSc_CACHE_EXPORT_HDR_SIZE;
+    len_rem = buf_len - DNSc_CACHE_EXPORT_HDR_SIZE;
 
-        case NET_IPv6_ADDR_SIZE:
-             if (p_host->AddrsIPv6Count >= p_cfg->AddrIPv6MaxPerHost) {
-                *p_err = DNSc_ERR_MEM_ALLOC;
-                 return;
-             }
-             break;
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
 
+    ts_cur_ms = DNScTask_TS_Get_ms();
 
-        default:
-            *p_err = DNSc_ERR_FAULT;
-             return;
-    }
-                                                                /* If reverse DNS lookup, the addr item was already ... */
-    if (!is_reverse) {                                          /* ... acquired by DNScCache_Resolve().                 */
-        p_item_cur = DNScCache_AddrItemGet(p_err);
-        if (*p_err != DNSc_ERR_NONE) {
-             return;
+    for (ix = 0u; ix < entry_nbr; ix++) {
+                                                                /* -------------------- RD ENTRY ---------------------- */
+        if (len_rem < DNSc_CACHE_EXPORT_ENTRY_HDR_SIZE) {
+           *p_err = DNSc_ERR_INVALID_ARG;
+            goto exit_release;
         }
-        p_item_cur->AddrPtr = p_addr;
 
-        if (p_host->AddrsFirstPtr == DEF_NULL) {
-            p_host->AddrsFirstPtr             = p_item_cur;
-            p_host->AddrsEndPtr               = p_item_cur;
+        Mem_Copy(&name_len, p_data, sizeof(CPU_INT16U));
+        name_len = NET_UTIL_NET_TO_HOST_16(name_len);
+        if (len_rem < (DNSc_CACHE_EXPORT_ENTRY_HDR_SIZE + name_len)) {
+           *p_err = DNSc_ERR_INVALID_ARG;
+            goto exit_release;
+        }
+        p_name   = p_data + sizeof(CPU_INT16U);
+        p_data   = p_name + name_len;
+        len_rem -= DNSc_CACHE_EXPORT_ENTRY_HDR_SIZE + name_len;
+
+        Mem_Copy(&ttl_s, p_data, sizeof(CPU_INT32U));
+        ttl_s     = NET_UTIL_NET_TO_HOST_32(ttl_s);
+        addr_nbr  = p_data[sizeof(CPU_INT32U)];
+        p_addrs   = p_data + sizeof(CPU_INT32U) + sizeof(CPU_INT08U);
+
+        addrs_len = 0u;                                         /* Validate the addrs before using them.                */
+        for (i = 0u; i < addr_nbr; i++) {
+            if (len_rem < (addrs_len + sizeof(CPU_INT08U))) {
+               *p_err = DNSc_ERR_INVALID_ARG;
+                goto exit_release;
+            }
+            addrs_len += sizeof(CPU_INT08U) + p_addrs[addrs_len];
+            if (len_rem < addrs_len) {
+               *p_err = DNSc_ERR_INVALID_ARG;
+                goto exit_release;
+            }
+        }
+        p_data   = p_addrs + addrs_len;
+        len_rem -= addrs_len;
+
+                                                                /* See Note #2.                                         */
+        if ((ttl_s    == 0u) ||
+            (name_len == 0u) ||
+            (name_len >= DNScCache_NameLenMax)) {
+            continue;
+        }
 
-        } else {
-            p_host->AddrsEndPtr->NextPtr = p_item_cur;
-            p_host->AddrsEndPtr          = p_item_cur;
+        name_hash = DNScCache_NameHash((const CPU_CHAR *)p_name, name_len, &name_len);
+        found     = DEF_NO;
+        p_cache   = DNSc_CacheItemListHead;
+        while ((p_cache != DEF_NULL) &&
+               (found   == DEF_NO)) {
+            found   = DNScCache_HostNameCmp(p_cache->HostPtr, (const CPU_CHAR *)p_name, name_hash, name_len);
+            p_cache = p_cache->NextPtr;
+        }
+        if (found == DEF_YES) {
+            continue;
         }
-    }
 
-    switch (p_addr->Len) {
-        case NET_IPv4_ADDR_SIZE:
-             p_host->AddrsIPv4Count++;
-             break;
+                                                                /* -------------------- ADD HOST ---------------------- */
+        p_host = DNScCache_HostBlkGet(&err);                    /* See Note #3.                                         */
+        if (err != DNSc_ERR_NONE) {
+           *p_err = DNSc_ERR_MEM_ALLOC;
+            goto exit_release;
+        }
 
+        p_host->NameLenMax     = DNScCache_NameLenMax;
+        Mem_Clr(p_host->NamePtr, p_host->NameLenMax);
+        Mem_Copy(p_host->NamePtr, p_name, name_len);
+        p_host->NameLen        = name_len;
+        p_host->NameHash       = name_hash;
+        p_host->AddrsCount     = 0u;
+        p_host->AddrsIPv4Count = 0u;
+        p_host->AddrsIPv6Count = 0u;
+        p_host->QueryID        = DNSc_QUERY_ID_NONE;
+        p_host->ReqCtr         = 0u;
+        p_host->IF_Nbr         = NET_IF_NBR_WILDCARD;
+        p_host->SockID         = NET_SOCK_ID_NONE;
+        p_host->ServerStatsIx  = DNSc_STATS_SERVER_IX_NONE;
+#ifdef DNSc_SIGNAL_TASK_MODULE_EN
+        p_host->TaskSignal     = KAL_SemHandleNull;
+#endif
 
-        case NET_IPv6_ADDR_SIZE:
-             p_host->AddrsIPv6Count++;
-             break;
+        for (i = 0u; i < addr_nbr; i++) {
+            addr_len = *p_addrs;
+            p_addrs++;
+            if (addr_len == NET_IPv4_ADDR_LEN) {
+                Mem_Copy(&data_32, p_addrs, sizeof(CPU_INT32U));
+                data_32 = NET_UTIL_NET_TO_HOST_32(data_32);
+                Mem_Copy(addr.Addr, &data_32, sizeof(CPU_INT32U));
+            } else if ((addr_len == NET_IPv6_ADDR_LEN) &&
+                       (addr_len <= sizeof(addr.Addr))) {
+                Mem_Copy(addr.Addr, p_addrs, addr_len);
+            } else {
+                p_addrs += addr_len;
+                continue;
+            }
+            p_addrs          += addr_len;
+            addr.Len          = addr_len;
+            addr.RevPreferred = DEF_NO;
+                                                                /* Addrs over the per host max are dropped.             */
+            DNScCache_HostAddrInsert(DNScCache_CfgPtr, p_host, &addr, &err);
+        }
 
-        default:
-            *p_err = DNSc_ERR_FAULT;
-             return;
-    }
+        if (p_host->AddrsCount == 0u) {
+            DNScCache_HostBlkFree(p_host);
+            continue;
+        }
 
-    p_host->AddrsCount++;
+        p_host->TTL_s        = DEF_MIN(ttl_s, DNSc_CACHE_TTL_MAX_S);
+        p_host->TS_ms        = ts_cur_ms;                       /* See Note #2.                                         */
+        p_host->State        = DNSc_STATE_RESOLVED;
+        p_host->PartialAvail = DEF_NO;
+        p_host->FamReq       = DNSc_FAMILY_NONE;
+        p_host->FamDone      = DNSc_FAMILY_NONE;                /* See Note #4.                                         */
+        if (p_host->AddrsIPv4Count > 0u) {
+            DEF_BIT_SET(p_host->FamDone, DNSc_FAMILY_IPv4);
+        }
+        if (p_host->AddrsIPv6Count > 0u) {
+            DEF_BIT_SET(p_host->FamDone, DNSc_FAMILY_IPv6);
+        }
+
+        DNScCache_HostLink(p_host, &err);
+        if (err != DNSc_ERR_NONE) {
+            DNScCache_HostAddrClr(p_host);
+            DNScCache_HostBlkFree(p_host);
+           *p_err = err;
+            goto exit_release;
+        }
+    }
 
    *p_err = DNSc_ERR_NONE;
 
-    return;
+exit_release:
+    DNScCache_LockRelease();
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DNScCache_Srch()
+*
+* Description : Search host in cache and return IP addresses, if found.
+*
+* Argument(s) : p_host_name         Pointer to a string that contains the host name.
+*
+*               p_host_obj          Pointer to a pointer to the host entry in the cache (if found).
+*
+*               p_addrs             Pointer to addresses array.
+*
+*               addr_nbr_max        Number of address the address array can contain.
+*
+*               p_addr_nbr_rtn      Pointer to a variable that will receive number of addresses copied.
+*
+*               flags           DNS client flag:
+*
+*                                   DNSc_FLAG_NONE              By default all IP address can be returned.
+*                                   DNSc_FLAG_IPv4_ONLY         Return only IPv4 address(es).
+*                                   DNSc_FLAG_IPv6_ONLY         Return only IPv6 address(es).
+*                                   DNSc_FLAG_PARTIAL           Return the IPv4 address(es) of a pending host (see Note #3).
+*                                   DNSc_FLAG_NO_STATS          Do not count the lookup in the cache stats (see Note #5).
+*
+*               p_err               Pointer to variable that will receive the return error code from this function :
+*
+*                                       DNSc_ERR_NONE                   Host found.
+*                                       DNSc_ERR_CACHE_HOST_PENDING     Host resolution is pending.
+*                                       DNSc_ERR_CACHE_HOST_NOT_FOUND   Host not found in the cache.
+*                                       DNSc_ERR_CACHE_HOST_NO_FAMILY   Host lacks a requested addr family.
+*
+*                                       RETURNED BY DNScCache_LockAcquire():
+*                                           See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : Resolution status:
+*                       DNSc_STATUS_PENDING         Host resolution is pending, call again to see the status. (Processed by DNSc's task)
+*                       DNSc_STATUS_RESOLVED        Host is resolved.
+*                       DNSc_STATUS_FAILED          Host resolution has failed.
+*
+* Caller(s)   : DNSc_GetHost().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) 'p_host_obj' is dereferenced & assigned a value of DEF_NULL if cache entry is NOT found.
+*
+*               (2) A resolved entry whose TTL has expired is removed from the cache & reported as NOT found.
+*
+*               (3) With DNSc_FLAG_PARTIAL, an entry whose IPv4 addresses are resolved while its IPv6 query is
+*                   in progress is reported as resolved, w/ its IPv4 addresses (see DNScCache_Resp() Note #4).
+*                   The front cache is not updated, so that a later lookup gets the addresses of both families.
+*
+*               (4) A resolved entry that lacks an address family requested by a forward lookup, its previous
+*                   requests having excluded it, is returned w/ DNSc_ERR_CACHE_HOST_NO_FAMILY, so that the
+*                   caller resolves only the missing family in the same entry (see DNScCache_HostObjGet()
+*                   Note #1). W/ DNSc_FLAG_FORCE_CACHE, the addresses the entry has are returned, but the front
+*                   cache is not updated.
+*
+*               (5) DNSc_GetHost() reads the answer of a resolution it just completed w/ DNSc_FLAG_NO_STATS, so
+*                   that only its first lookup of the host is counted as a hit or a miss.
+*********************************************************************************************************
+*/
+
+DNSc_STATUS  DNScCache_Srch (const  CPU_CHAR        *p_host_name,
+                                    DNSc_HOST_OBJ  **p_host_obj,
+                                    DNSc_ADDR_OBJ   *p_addrs,
+                                    CPU_INT08U       addr_nbr_max,
+                                    CPU_INT08U      *p_addr_nbr_rtn,
+                                    DNSc_FLAGS       flags,
+                                    DNSc_ERR        *p_err)
+{
+    CPU_INT08U       i          = 0u;
+    CPU_INT08U       addr_nbr;
+    CPU_INT08U       fam;
+    CPU_INT32U       ttl_ms;
+    DNSc_HOST_OBJ   *p_host     = DEF_NULL;
+    DNSc_ADDR_OBJ   *p_addr     = DEF_NULL;
+    DNSc_STATUS      status     = DNSc_STATUS_FAILED;
+    CPU_BOOLEAN      no_ipv4    = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv6_ONLY);
+    CPU_BOOLEAN      no_ipv6    = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv4_ONLY);
+    CPU_INT32U       stats_inc  = DEF_BIT_IS_CLR(flags, DNSc_FLAG_NO_STATS) ? 1u : 0u;
+
+
+   *p_addr_nbr_rtn = 0u;
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+    p_host = DNScCache_HostSrchByName(p_host_name, flags);
+    if (p_host != DEF_NULL) {
+        switch(p_host->State) {
+#ifdef  DNSc_TASK_MODULE_EN
+            case DNSc_STATE_IF_SEL:                             /* A req for host may have been started by another task.*/
+            case DNSc_STATE_INIT_REQ:
+#endif
+            case DNSc_STATE_TX_REQ_IPv4:
+            case DNSc_STATE_RX_RESP_IPv4:
+            case DNSc_STATE_TX_REQ_IPv6:
+            case DNSc_STATE_RX_RESP_IPv6:
+            case DNSc_STATE_TX_REQ_PTR_IPv4:
+            case DNSc_STATE_RX_RESP_PTR_IPv4:
+            case DNSc_STATE_TX_REQ_PTR_IPv6:
+            case DNSc_STATE_RX_RESP_PTR_IPv6:
+                 DNScCache_Stats.PendingHits += stats_inc;
+                 if ((p_host->PartialAvail == DEF_YES)          &&
+                     (DEF_BIT_IS_SET(flags, DNSc_FLAG_PARTIAL)) &&
+                     (DEF_BIT_IS_CLR(flags, DNSc_FLAG_IPv6_ONLY))) {
+                     status = DNSc_STATUS_RESOLVED;             /* See Note #3.                                         */
+                     goto exit_copy;
+                 }
+                 status = DNSc_STATUS_PENDING;
+                *p_err  = DNSc_ERR_CACHE_HOST_PENDING;
+                 goto exit_release;
+
+            case DNSc_STATE_RESOLVED:
+                 ttl_ms = DNScCache_HostTTL_Get(p_host, DNScTask_TS_Get_ms());
+                 if (ttl_ms == 0u) {                            /* See Note #2.                                         */
+                     DNScCache_Stats.Expirations++;
+                     DNScCache_HostRemoveHandler(p_host);
+                     p_host = DEF_NULL;
+                     break;
+                 }
+                 if (DEF_BIT_IS_CLR(flags, DNSc_FLAG_REVERSE_LOOKUP)) {
+                     fam = DNScCache_FamGet(flags);
+                     if (DEF_BIT_IS_SET_ANY(fam, ~p_host->FamDone)) {
+                         if (DEF_BIT_IS_CLR(flags, DNSc_FLAG_FORCE_CACHE)) {
+                             DNScCache_Stats.Misses += stats_inc;
+                             status = DNSc_STATUS_FAILED;       /* See Note #4.                                         */
+                            *p_err  = DNSc_ERR_CACHE_HOST_NO_FAMILY;
+                             goto exit_release;
+                         }
+                         DNScCache_Stats.Hits += stats_inc;
+                         status = DNSc_STATUS_RESOLVED;
+                         goto exit_copy;
+                     }
+                 }
+                 DNScCache_Stats.Hits += stats_inc;
+                 status = DNSc_STATUS_RESOLVED;
+                 goto exit_found;
+
+            case DNSc_STATE_FAILED:
+            default:
+                 DNScCache_Stats.Misses += stats_inc;
+                *p_err = DNSc_ERR_NONE;
+                 goto exit_release;
+        }
+    }
+
+    DNScCache_Stats.Misses += stats_inc;
+   *p_err = DNSc_ERR_CACHE_HOST_NOT_FOUND;                      /* Not found.                                           */
+
+    goto exit_release;
+
+
+exit_found:
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+    if (DEF_BIT_IS_CLR(flags, DNSc_FLAG_REVERSE_LOOKUP)) {
+        DNScCache_FrontUpdate(p_host, flags);
+    }
+#endif
+
+exit_copy:
+                                                                /* All families requested: copy tbl in one block.       */
+    if ((no_ipv4 == DEF_NO) && (no_ipv6 == DEF_NO)) {
+        addr_nbr = DEF_MIN(p_host->AddrsCount, addr_nbr_max);
+        Mem_Copy(p_addrs, p_host->AddrsTblPtr, addr_nbr * sizeof(DNSc_ADDR_OBJ));
+       *p_addr_nbr_rtn = addr_nbr;
+       *p_err          = DNSc_ERR_NONE;
+        goto exit_release;
+    }
+
+    for (i = 0u; i < p_host->AddrsCount; i++) {                 /* Copy Addresses                                       */
+        p_addr = &p_host->AddrsTblPtr[i];
+        if (*p_addr_nbr_rtn < addr_nbr_max) {
+            CPU_BOOLEAN  add_addr = DEF_YES;
+
+
+            switch (p_addr->Len) {
+                case NET_IPv4_ADDR_SIZE:
+                     if (no_ipv4 == DEF_YES) {
+                         add_addr = DEF_NO;
+                     }
+                     break;
+
+                case NET_IPv6_ADDR_SIZE:
+                     if (no_ipv6 == DEF_YES) {
+                         add_addr = DEF_NO;
+                     }
+                     break;
+
+                default:
+                     add_addr = DEF_NO;
+                     break;
+            }
+
+            if (add_addr == DEF_YES) {
+                p_addrs[*p_addr_nbr_rtn] = *p_addr;
+               *p_addr_nbr_rtn += 1u;
+            }
+
+        } else {
+            goto exit_release;
+        }
+    }
+
+   (void)&p_addr_nbr_rtn;
+
+   *p_err = DNSc_ERR_NONE;
+
+exit_release:
+    DNScCache_LockRelease();
+
+exit:
+   *p_host_obj = p_host;
+    return (status);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_FrontSrch()
+*
+* Description : Search host in the front cache and return IP addresses, if found.
+*
+* Argument(s) : p_host_name         Pointer to a string that contains the host name.
+*
+*               p_addrs             Pointer to addresses array.
+*
+*               addr_nbr_max        Number of address the address array can contain.
+*
+*               p_addr_nbr_rtn      Pointer to a variable that will receive number of addresses copied.
+*
+*               flags               DNS client flag:
+*
+*                                       DNSc_FLAG_NONE              By default all IP address can be returned.
+*                                       DNSc_FLAG_IPv4_ONLY         Return only IPv4 address(es).
+*                                       DNSc_FLAG_IPv6_ONLY         Return only IPv6 address(es).
+*
+* Return(s)   : DEF_YES, if a valid entry was found & its addresses were copied.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNSc_GetHost().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The cache lock is NOT acquired (see 'FRONT CACHE ENTRY DATA TYPE' Note #2).
+*
+*               (2) The hash & length only select the candidate entries: the name is confirmed against the
+*                   name of the entry's host, so that a hash collision is never returned as a hit (see 'FRONT
+*                   CACHE ENTRY DATA TYPE' Note #1).
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  DNScCache_FrontSrch (const  CPU_CHAR       *p_host_name,
+                                         DNSc_ADDR_OBJ  *p_addrs,
+                                         CPU_INT08U      addr_nbr_max,
+                                         CPU_INT08U     *p_addr_nbr_rtn,
+                                         DNSc_FLAGS      flags)
+{
+    CPU_BOOLEAN        found = DEF_NO;
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+    DNSc_CACHE_FRONT  *p_front;
+    CPU_INT32U         name_hash;
+    CPU_INT16U         name_len;
+    NET_TS_MS          ts_cur_ms;
+    CPU_INT08U         addr_nbr;
+    CPU_INT08U         i;
+    CPU_SR_ALLOC();
+
+
+    name_hash = DNScCache_NameHash(p_host_name, DNScCache_NameLenMax, &name_len);
+    flags    &= DNSc_CACHE_FRONT_FLAGS;
+    ts_cur_ms = DNScTask_TS_Get_ms();
+
+    CPU_CRITICAL_ENTER();                                       /* See Note #1.                                         */
+    for (i = 0u; i < DNSc_CFG_CACHE_FRONT_NBR_ENTRIES; i++) {
+        p_front = &DNScCache_FrontTbl[i];                       /* See Note #2.                                         */
+        if ((p_front->AddrsCount >  0u)            &&
+            (p_front->NameHash   == name_hash)     &&
+            (p_front->NameLen    == name_len)      &&
+            (p_front->Flags      == flags)         &&
+            (p_front->Gen        == DNScCache_Gen) &&
+            ((ts_cur_ms - p_front->TS_ms) < p_front->Life_ms) &&
+            (DNScCache_NameCmp(p_front->NamePtr, p_host_name, name_len) == DEF_YES)) {
+            addr_nbr = DEF_MIN(p_front->AddrsCount, addr_nbr_max);
+            Mem_Copy(p_addrs, p_front->Addrs, addr_nbr * sizeof(DNSc_ADDR_OBJ));
+           *p_addr_nbr_rtn = addr_nbr;
+            found          = DEF_YES;
+            DNScCache_Stats.FrontHits++;
+            break;
+        }
+    }
+    CPU_CRITICAL_EXIT();
+#else
+   (void)&p_host_name;
+   (void)&p_addrs;
+   (void)&addr_nbr_max;
+   (void)&p_addr_nbr_rtn;
+   (void)&flags;
+#endif
+
+    return (found);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostObjGet()
+*
+* Description : Get a free host object.
+*
+* Argument(s) : p_host_name     Pointer to a string that contains the domain name.
+*
+*               flags           DNS client flag:
+*
+*                                   DNSc_FLAG_NONE              By default this function is blocking.
+*                                   DNSc_FLAG_NO_BLOCK          Don't block (only possible if DNSc's task is enabled).
+*                                   DNSc_FLAG_FORCE_CACHE       Take host from the cache, don't send new DNS request.
+*                                   DNSc_FLAG_FORCE_RENEW       Force DNS request, remove existing entry in the cache.
+*                                   DNSc_FLAG_CANON             Force this function to allocate a canonical name object.
+*                                   DNSc_FLAG_REVERSE_LOOKUP    Force this function to allocate a reverse name object.
+*
+*               p_cfg           Pointer to a request configuration. Should be set to overwrite default DNS configuration
+*                               (such as DNS server, request timeout, etc.). Must be set to DEF_NULL to use default
+*                               configuration.
+*
+*               p_reused        Pointer to variable that will receive whether the host object is an entry already
+*                               in the cache (see Note #1):
+*
+*                                   DEF_YES     Entry of the cache, already linked in the cache list.
+*                                   DEF_NO      New host object, to insert in the cache.
+*
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                                   DNSc_ERR_NONE                   Successfully acquired a host object.
+*                                   DNSc_ERR_MEM_ALLOC              Not able to allocate a host object.
+*                                   DNSc_ERR_CACHE_HOST_PENDING     Entry of the host already being resolved (see
+*                                                                   Note #2).
+*
+*                                   RETURNED BY DNScCache_LockAcquire():
+*                                       See DNScCache_LockAcquire() for additional return error codes.
+*
+*                                   RETURNED BY DNScCache_HostObjNameSet():
+*                                       See DNScCache_HostObjNameSet() for additional return error codes.
+*
+* Return(s)   : Pointer to the host object acquired.
+*
+* Caller(s)   : DNSc_GetHost().
+*
+* Note(s)     : (1) With DNSc_FLAG_RESET_REQ, the resolved entry of the host is resolved again in place. Its
+*                   addresses & the address families already resolved are kept, so that a forward lookup
+*                   queries only the families the entry lacks (see DNScCache_Srch() Note #4); the entry keeps
+*                   the remaining lifetime of its addresses, lowered by the new answers.
+*
+*               (2) The entry is only reset if it is resolved, under the cache lock. An entry that another
+*                   caller has reset in the meantime is returned as is, w/ DNSc_ERR_CACHE_HOST_PENDING: its
+*                   request, socket & semaphore belong to that caller.
+*********************************************************************************************************
+*/
+
+DNSc_HOST_OBJ  *DNScCache_HostObjGet (const  CPU_CHAR      *p_host_name,
+                                             DNSc_FLAGS     flags,
+                                             DNSc_REQ_CFG  *p_cfg,
+                                             CPU_BOOLEAN   *p_reused,
+                                             DNSc_ERR      *p_err)
+{
+#ifdef DNSc_SIGNAL_TASK_MODULE_EN
+    KAL_SEM_HANDLE   sem    = KAL_SemHandleNull;
+#endif
+    DNSc_HOST_OBJ   *p_host = DEF_NULL;
+    NET_TS_MS        ts_cur_ms;
+    CPU_INT32U       ttl_s;
+
+
+   *p_reused = DEF_NO;
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_RESET_REQ)) {
+        p_host = DNScCache_HostSrchByName(p_host_name, flags);
+        if (p_host != DEF_NULL) {
+            if (p_host->State != DNSc_STATE_RESOLVED) {         /* See Note #2.                                         */
+               *p_err = DNSc_ERR_CACHE_HOST_PENDING;
+                goto exit_release;
+            }
+           *p_reused = DEF_YES;
+            goto host_assign_req_params;
+        }
+    }
+
+    p_host = DNScCache_HostBlkGet(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+        p_host = DNScCache_ItemHostGet();
+    }
+
+    if (p_host == DEF_NULL) {
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit_release;
+    }
+                                                                /* ---------- ACQUIRE SIGNAL TASK SEMAPHORE ----------- */
+
+
+    if (p_host->NamePtr == DEF_NULL) {
+        p_host->NameLenMax = DNScCache_NameLenMax - 1;
+    }
+
+    p_host->NameLenMax = DNScCache_NameLenMax;
+    Mem_Clr(p_host->NamePtr, p_host->NameLenMax);
+
+    if (p_host->CanonicalNamePtr == DEF_NULL) {
+        if (DEF_BIT_IS_SET(flags, DNSc_FLAG_CANON) == DEF_YES) {
+            p_host->CanonicalNamePtr = (CPU_CHAR *)DNScCache_HostElemGet(p_host, DNSc_CACHE_ELEM_CANON_NAME, p_err);
+            if (*p_err != DNSc_ERR_NONE) {
+                goto exit_free_host_obj;
+            }
+            Mem_Clr(p_host->CanonicalNamePtr, p_host->NameLenMax);
+        }
+    }
+
+    p_host->AddrsCount     = 0u;
+    p_host->AddrsIPv4Count = 0u;
+    p_host->AddrsIPv6Count = 0u;
+    p_host->FamDone        = DNSc_FAMILY_NONE;
+    p_host->QueryID        = DNSc_QUERY_ID_NONE;
+    p_host->ReqCtr         = 0u;
+    p_host->State          = DNSc_STATE_INIT_REQ;
+
+    DNScCache_HostObjNameSet(p_host, p_host_name, p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit_release;
+    }
+
+host_assign_req_params:
+    DNScCache_Gen++;                                            /* Invalidate front cache.                              */
+#ifdef DNSc_SIGNAL_TASK_MODULE_EN
+    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_NO_BLOCK) == DEF_NO) {
+        KAL_ERR  kal_err;
+
+
+        if (p_host->TaskSignal.SemObjPtr == KAL_SemHandleNull.SemObjPtr) {
+            sem = KAL_SemCreate("DNSc Block Task Signal", DEF_NULL, &kal_err);
+            if (kal_err != KAL_ERR_NONE) {
+               *p_err = DNSc_ERR_MEM_ALLOC;
+                goto exit_free_host_obj;
+            }
+        }
+        p_host->TaskSignal = sem;
+    }
+#endif
+
+    if (p_host->ReverseNamePtr == DEF_NULL) {
+        if (DEF_BIT_IS_SET(flags, DNSc_FLAG_REVERSE_LOOKUP) == DEF_YES) {
+            p_host->ReverseNamePtr = (CPU_CHAR *)DNScCache_HostElemGet(p_host, DNSc_CACHE_ELEM_REV_NAME, p_err);
+            if (*p_err != DNSc_ERR_NONE) {
+                goto exit_free_host_obj;
+            }
+            Mem_Clr(p_host->ReverseNamePtr, p_host->NameLenMax);
+        }
+    }
+
+
+    if (p_host->ReqCfgPtr == DEF_NULL) {
+        p_host->ReqCfgPtr = (DNSc_REQ_CFG *)DNScCache_HostElemGet(p_host, DNSc_CACHE_ELEM_REQ_CFG, p_err);
+        if (*p_err != DNSc_ERR_NONE) {
+            goto exit_free_host_obj;
+        }
+    }
+
+    p_host->ReqCfgPtr->ReqFlags       = p_cfg->ReqFlags;
+    p_host->ReqCfgPtr->ReqRetry       = p_cfg->ReqRetry;
+    p_host->ReqCfgPtr->ReqPrio        = p_cfg->ReqPrio;
+    p_host->ReqCfgPtr->ReqTimeout_ms  = p_cfg->ReqTimeout_ms;
+    p_host->ReqCfgPtr->ReqDeadline_ms = p_cfg->ReqDeadline_ms;
+    p_host->ReqCfgPtr->ReqType        = p_cfg->ReqType;
+    p_host->ReqCfgPtr->ServerAddrPtr  = p_cfg->ServerAddrPtr;
+    p_host->ReqCfgPtr->ServerPort     = p_cfg->ServerPort;
+    p_host->ReqCfgPtr->TaskDly_ms     = p_cfg->TaskDly_ms;
+
+
+    ts_cur_ms = DNScTask_TS_Get_ms();
+    ttl_s     = DNSc_CACHE_TTL_MAX_S;                           /* Lowered by the answers.                              */
+
+    if (*p_reused == DEF_YES) {
+        if (DEF_BIT_IS_CLR(flags, DNSc_FLAG_REVERSE_LOOKUP)) {  /* See Note #1.                                         */
+            ttl_s = DNScCache_HostTTL_Get(p_host, ts_cur_ms) / DEF_TIME_NBR_mS_PER_SEC;
+        }
+        p_host->State = DNSc_STATE_INIT_REQ;
+    }
+
+    p_host->TS_ms    = 0u;
+    p_host->ReqTS_ms = ts_cur_ms;                               /* Start of the req's deadline.                         */
+    p_host->TTL_s    = ttl_s;
+    p_host->IF_Nbr   = NET_IF_NBR_WILDCARD;
+    p_host->SockID   = NET_SOCK_ID_NONE;
+
+    p_host->ServerStatsIx = DNSc_STATS_SERVER_IX_NONE;
+    p_host->PartialAvail  = DEF_NO;
+    p_host->FamReq        = DNScCache_FamGet(flags);
+
+    goto exit_release;
+
+
+exit_free_host_obj:
+    DNScCache_HostBlkFree(p_host);
+
+exit_release:
+    DNScCache_LockRelease();
+
+exit:
+    return (p_host);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostObjFree()
+*
+* Description : Free a host object.
+*
+* Argument(s) : p_host  Pointer to the host object to free.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostRelease(),
+*               DNSc_GetHost().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  DNScCache_HostObjFree (DNSc_HOST_OBJ  *p_host)
+{
+#ifdef DNSc_SIGNAL_TASK_MODULE_EN
+    if (p_host->TaskSignal.SemObjPtr != KAL_SemHandleNull.SemObjPtr) {
+        KAL_ERR  kal_err;
+
+
+        KAL_SemDel(p_host->TaskSignal, &kal_err);
+    }
+
+    p_host->TaskSignal = KAL_SemHandleNull;
+#endif
+
+
+    DNScCache_QueryIxRemove(p_host);
+    DNScCache_HostAddrClr(p_host);
+    DNScCache_HostBlkFree(p_host);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostAddrInsert()
+*
+* Description : Insert address in the addresses table of the host object.
+*
+* Argument(s) : p_cfg       Pointer to DNSc's configuration.
+*
+*               p_host      Pointer to the host object.
+*
+*               p_addr      Pointer to the address object to copy in the host's table.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE       Address successfully added.
+*                               DNSc_ERR_MEM_ALLOC  Unable to insert the IP address due to the memory configuration
+*                               DNSc_ERR_FAULT      Unknown error (should not occur)
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_Import(),
+*               DNScCache_Resolve(),
+*               DNScReq_RxRespAddAddr().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  DNScCache_HostAddrInsert (const  DNSc_CFG       *p_cfg,
+                                       DNSc_HOST_OBJ  *p_host,
+                                const  DNSc_ADDR_OBJ  *p_addr,
+                                       DNSc_ERR       *p_err)
+{
+    switch (p_addr->Len) {
+        case NET_IPv4_ADDR_SIZE:
+             if (p_host->AddrsIPv4Count >= p_cfg->AddrIPv4MaxPerHost) {
+                *p_err = DNSc_ERR_MEM_ALLOC;
+                 return;
+             }
+             p_host->AddrsIPv4Count++;
+             break;
+
+
+        case NET_IPv6_ADDR_SIZE:
+             if (p_host->AddrsIPv6Count >= p_cfg->AddrIPv6MaxPerHost) {
+                *p_err = DNSc_ERR_MEM_ALLOC;
+                 return;
+             }
+             p_host->AddrsIPv6Count++;
+             break;
+
+
+        default:
+            *p_err = DNSc_ERR_FAULT;
+             return;
+    }
+
+    DNScCache_Gen++;                                            /* Invalidate front cache.                              */
+    p_host->AddrsTblPtr[p_host->AddrsCount] = *p_addr;
+    DNScCache_AddrIxAdd(p_host, p_host->AddrsCount);
+    p_host->AddrsCount++;
+
+   *p_err = DNSc_ERR_NONE;
+
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_AddrObjSet()
+*
+* Description : Set address object from IP string.
+*
+* Argument(s) : p_addr      Pointer to the address object.
+*
+*               p_str_addr  Pointer to the string that contains the IP address.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE           Address successfully set.
+*                               DNSc_ERR_ADDR_INVALID   Invalid IP address.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScReq_ServerInit(),
+*               DNSc_CfgServerByStr().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+void  DNScCache_AddrObjSet (DNSc_ADDR_OBJ  *p_addr,
+                            CPU_CHAR       *p_str_addr,
+                            DNSc_ERR       *p_err)
+{
+    NET_IP_ADDR_FAMILY  ip_addr_family;
+    NET_ERR             net_err;
+
+
+    ip_addr_family = NetASCII_Str_to_IP(         p_str_addr,
+                                        (void *)&p_addr->Addr,
+                                                 sizeof(p_addr->Addr),
+                                                &net_err);
+    if (net_err != NET_ASCII_ERR_NONE) {
+        *p_err = DNSc_ERR_ADDR_INVALID;
+         goto exit;
+    }
+
+    switch (ip_addr_family) {
+        case NET_IP_ADDR_FAMILY_IPv4:
+             p_addr->Len = NET_IPv4_ADDR_SIZE;
+             break;
+
+        case NET_IP_ADDR_FAMILY_IPv6:
+             p_addr->Len = NET_IPv6_ADDR_SIZE;
+             break;
+
+        default:
+            *p_err = DNSc_ERR_ADDR_INVALID;
+             goto exit;
+    }
+
+   *p_err = DNSc_ERR_NONE;
+
+    exit:
+        return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_ResolveHost()
+*
+* Description : Launch resolution of an host.
+*
+* Argument(s) : p_cfg   Pointer to DNSc's configuration.
+*
+*               p_host  Pointer to the host object.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           RETURNED BY DNScCache_LockAcquire():
+*                               See DNScCache_LockAcquire() for additional return error codes.
+*
+*                           RETURNED BY DNScCache_Resolve():
+*                               See DNScCache_Resolve() for additional return error codes.
+*
+* Return(s)   : Resolution status:
+*                       DNSc_STATUS_PENDING         Host resolution is pending, call again to see the status. (Processed by DNSc's task)
+*                       DNSc_STATUS_RESOLVED        Host is resolved.
+*                       DNSc_STATUS_FAILED          Host resolution has failed.
+*
+* Caller(s)   : DNScTask().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+DNSc_STATUS  DNScCache_ResolveHost (const  DNSc_CFG       *p_cfg,
+                                           DNSc_HOST_OBJ  *p_host,
+                                           DNSc_ERR       *p_err)
+{
+    DNSc_STATUS  status;
+
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+
+    status = DNScCache_Resolve(p_cfg, p_host, p_err);
+
+    DNScCache_LockRelease();
+
+
+exit:
+    return (status);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_ResolveAll()
+*
+* Description : Launch resolution on all entries that are pending in the cache & belong to a worker task.
+*
+* Argument(s) : p_cfg       Pointer to DNSc's configuration.
+*
+*               worker_ix   Index of the calling worker (see 'dns-c_task.c  DNScTask_Init()  Note #1').
+*
+*               p_dly_ms    Pointer to variable that will receive the time until the earliest event of the
+*                           worker's pending entries, in milliseconds (see Note #3).
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE   Resolution has been launched on all entries.
+*
+*                           RETURNED BY DNScCache_LockAcquire():
+*                               See DNScCache_LockAcquire() for additional return error codes.
+*
+* Return(s)   : Number of entries that are completed.
+*
+* Caller(s)   : DNScTask().
+*
+* Note(s)     : (1) Only the pending lists are walked (see DNScCache_PendLink()), so that a pass costs the number
+*                   of requests in progress, not the size of the cache. An entry leaves its list once it is
+*                   completed, & is counted once.
+*
+*               (2) Entries of the other workers are skipped: each pending entry is advanced by one worker only.
+*
+*               (3) The earliest event is the earliest of the retransmission deadlines of the entries waiting for
+*                   a response, or 0 if an entry can be advanced right away. It is DEF_INT_32U_MAX_VAL if the
+*                   worker has no pending entry.
+*
+*               (4) The lists are walked by priority, high first, each in submission order. An entry is not
+*                   started while DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX entries are in flight, nor a low-priority entry
+*                   while DNSc_CFG_REQ_PRIO_LOW_NBR_MAX low-priority entries are (see DNScCache_PendHold()). It
+*                   stays in its list until an entry completes, or until its deadline passes. If an entry waits
+*                   & another completes, the next pass is run right away, so that the freed slot is taken by the
+*                   first waiting entry in service order.
+*
+*               (5) The blocking caller of a request w/ DNSc_FLAG_PARTIAL is released as soon as the IPv4
+*                   addresses are available (see DNScCache_Resp() Note #4); the entry stays in its list until
+*                   its IPv6 query completes.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+CPU_INT16U  DNScCache_ResolveAll (const  DNSc_CFG    *p_cfg,
+                                         CPU_INT08U   worker_ix,
+                                         NET_TS_MS   *p_dly_ms,
+                                         DNSc_ERR    *p_err)
+{
+    DNSc_CACHE_PEND_LIST  *p_list;
+    DNSc_HOST_OBJ         *p_host;
+    DNSc_HOST_OBJ         *p_host_next;
+    DNSc_STATUS            status;
+    NET_TS_MS              dly_ms;
+    CPU_INT08U             prio_ix;
+    CPU_BOOLEAN            held         = DEF_NO;
+    CPU_INT16U             resolved_ctr = 0u;
+
+
+   *p_dly_ms = DEF_INT_32U_MAX_VAL;
+
+    DNScCache_LockAcquire(p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+
+                                                                /* See Note #4.                                         */
+    for (prio_ix = 0u; prio_ix < DNSc_REQ_PRIO_NBR; prio_ix++) {
+        p_list = &DNScCache_PendListTbl[DNScCache_PendPrioOrderTbl[prio_ix]];
+        p_host =  p_list->HeadPtr;                              /* See Note #1.                                         */
+
+        while (p_host != DEF_NULL) {
+            p_host_next = p_host->PendNextPtr;
+
+            if ((p_host->State == DNSc_STATE_RESOLVED) ||       /* Completed outside of the task.                       */
+                (p_host->State == DNSc_STATE_FAILED)) {
+                DNScCache_PendUnlink(p_host);
+
+            } else if (DNScTask_WorkerIxGet(p_host) != worker_ix) {
+                ;                                               /* See Note #2.                                         */
+
+            } else if (DNScCache_PendHold(p_host, &dly_ms) == DEF_YES) {
+                held = DEF_YES;
+                if (dly_ms < *p_dly_ms) {                       /* See Note #4.                                         */
+                   *p_dly_ms = dly_ms;
+                }
+
+            } else {
+                status = DNScCache_Resolve(p_cfg, p_host, p_err);
+                switch (status) {
+                    case DNSc_STATUS_NONE:
+                    case DNSc_STATUS_PENDING:
+                         if ((p_host->PendInFlight == DEF_NO) &&
+                             (p_host->State        != DNSc_STATE_INIT_REQ)) {
+                              p_host->PendInFlight  = DEF_YES;
+                              p_list->InFlightNbr++;
+                         }
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+                                                                /* See Note #5.                                         */
+                         if ((p_host->PartialAvail == DEF_YES) &&
+                             (DEF_BIT_IS_SET(p_host->ReqCfgPtr->ReqFlags, DNSc_FLAG_PARTIAL))) {
+                              DNScCache_HostSignal(p_host);
+                         }
+#endif
+                                                                /* See Note #3.                                         */
+                         dly_ms = DNScCache_HostDlyGet(p_cfg, p_host);
+                         if (dly_ms < *p_dly_ms) {
+                            *p_dly_ms = dly_ms;
+                         }
+                         break;
+
+                    case DNSc_STATUS_RESOLVED:
+                    case DNSc_STATUS_FAILED:
+                    default:
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+                        DNScCache_HostSignal(p_host);
+#endif
+                        DNScCache_PendUnlink(p_host);
+                        resolved_ctr++;
+                        break;
+                }
+            }
+
+            p_host = p_host_next;
+        }
+    }
+
+    if ((held         == DEF_YES) &&                            /* See Note #4.                                         */
+        (resolved_ctr >  0u)) {
+       *p_dly_ms = 0u;
+    }
+
+
+   *p_err = DNSc_ERR_NONE;
+
+    DNScCache_LockRelease();
+
+
+exit:
+    return (resolved_ctr);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_LockAcquire()
+*
+* Description : Acquire lock on the cache list.
+*
+* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE           Lock successfully acquired.
+*                           DNSc_ERR_CACHE_LOCK     Unable to acquire the lock.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_Clr(),
+*               DNScCache_EntryGet(),
+*               DNScCache_Export(),
+*               DNScCache_HostInsert(),
+*               DNScCache_HostPendInsert(),
+*               DNScCache_HostObjGet(),
+*               DNScCache_HostRemove(),
+*               DNScCache_HostSrchRemove(),
+*               DNScCache_Import(),
+*               DNScCache_ResolveAll(),
+*               DNScCache_ResolveHost(),
+*               DNScCache_ResolverStatsGet(),
+*               DNScCache_ResolverStatsReset(),
+*               DNScCache_Srch(),
+*               DNScCache_StatsGet(),
+*               DNScCache_StatsReset().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_LockAcquire (DNSc_ERR  *p_err)
+{
+    KAL_ERR  err;
+
+
+    KAL_LockAcquire(DNScCache_LockHandle, KAL_OPT_PEND_NONE, 0, &err);
+    if (err != KAL_ERR_NONE) {
+        *p_err = DNSc_ERR_CACHE_LOCK;
+         goto exit;
+    }
+
+
+   *p_err = DNSc_ERR_NONE;
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_LockRelease()
+*
+* Description : Release cache list lock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_Clr(),
+*               DNScCache_EntryGet(),
+*               DNScCache_Export(),
+*               DNScCache_HostInsert(),
+*               DNScCache_HostPendInsert(),
+*               DNScCache_HostObjGet(),
+*               DNScCache_HostRemove(),
+*               DNScCache_HostSrchRemove(),
+*               DNScCache_Import(),
+*               DNScCache_ResolveAll(),
+*               DNScCache_ResolveHost(),
+*               DNScCache_ResolverStatsGet(),
+*               DNScCache_ResolverStatsReset(),
+*               DNScCache_Srch(),
+*               DNScCache_StatsGet(),
+*               DNScCache_StatsReset().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_LockRelease (void)
+{
+    KAL_ERR  err;
+
+
+    KAL_LockRelease(DNScCache_LockHandle, &err);
+}
+
+
+/*
+*********************************************************************************************************
+*                                     DNScCache_HostRemoveHandler()
+*
+* Description : Remove host from the cache.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostRemove(),
+*               DNScCache_HostSrchRemove().
+*
+* Note(s)     : None.
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_HostRemoveHandler (DNSc_HOST_OBJ  *p_host)
+{
+    DNSc_CACHE_ITEM  *p_cache = DNSc_CacheItemListHead;
+
+
+    while (p_cache != DEF_NULL) {
+        if (p_cache->HostPtr == p_host) {
+            DNScCache_ItemRelease(p_cache);
+            goto exit;
+        }
+        p_cache = p_cache->NextPtr;
+    }
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_PendLink()
+*
+* Description : Link a host at the tail of the pending list of its request's priority.
+*
+* Argument(s) : p_host  Pointer to host object.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostPendInsert().
+*
+* Note(s)     : (1) The pending lists hold the hosts submitted to the task & not yet completed, so that the task
+*                   never walks the resolved entries of the cache (see DNScCache_ResolveAll() Note #1). They are
+*                   doubly linked through the host objects, so that a host is unlinked w/o a search when it
+*                   completes or leaves the cache.
+*
+*               (2) The host stays in the list it was linked in until it is unlinked, even if its request is
+*                   configured again in the meantime.
+*
+*               (3) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+static  void  DNScCache_PendLink (DNSc_HOST_OBJ  *p_host)
+{
+    DNSc_CACHE_PEND_LIST  *p_list;
+    DNSc_REQ_PRIO          prio = DNSc_REQ_PRIO_NORMAL;
+
+
+    if (p_host->PendLinked == DEF_YES) {                        /* Req already in progress.                             */
+        return;
+    }
+
+    if (p_host->ReqCfgPtr != DEF_NULL) {
+        prio = p_host->ReqCfgPtr->ReqPrio;
+    }
+    p_list = &DNScCache_PendListTbl[prio];
+
+    p_host->PendPrevPtr  = p_list->TailPtr;
+    p_host->PendNextPtr  = DEF_NULL;
+    if (p_list->TailPtr != DEF_NULL) {
+        p_list->TailPtr->PendNextPtr = p_host;
+    } else {
+        p_list->HeadPtr              = p_host;
+    }
+    p_list->TailPtr      = p_host;
+    p_host->PendPrio     = prio;                                /* See Note #2.                                         */
+    p_host->PendInFlight = DEF_NO;
+    p_host->PendLinked   = DEF_YES;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_PendUnlink()
+*
+* Description : Unlink a host from its pending list, if it is linked.
+*
+* Argument(s) : p_host  Pointer to host object.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostCancel(),
+*               DNScCache_HostRelease(),
+*               DNScCache_ItemHostGet(),
+*               DNScCache_ResolveAll().
+*
+* Note(s)     : (1) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+static  void  DNScCache_PendUnlink (DNSc_HOST_OBJ  *p_host)
+{
+    DNSc_CACHE_PEND_LIST  *p_list;
+
+
+    if (p_host->PendLinked != DEF_YES) {
+        return;
+    }
+
+    p_list = &DNScCache_PendListTbl[p_host->PendPrio];
+
+    if (p_host->PendPrevPtr != DEF_NULL) {
+        p_host->PendPrevPtr->PendNextPtr = p_host->PendNextPtr;
+    } else {
+        p_list->HeadPtr                  = p_host->PendNextPtr;
+    }
+    if (p_host->PendNextPtr != DEF_NULL) {
+        p_host->PendNextPtr->PendPrevPtr = p_host->PendPrevPtr;
+    } else {
+        p_list->TailPtr                  = p_host->PendPrevPtr;
+    }
+
+    if (p_host->PendInFlight == DEF_YES) {
+        p_list->InFlightNbr--;
+    }
+
+    p_host->PendPrevPtr  = DEF_NULL;
+    p_host->PendNextPtr  = DEF_NULL;
+    p_host->PendInFlight = DEF_NO;
+    p_host->PendLinked   = DEF_NO;
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_PendHold()
+*
+* Description : Check whether a pending host must wait before its request is started.
+*
+* Argument(s) : p_host      Pointer to host object, linked in a pending list.
+*
+*               p_dly_ms    Pointer to variable that will receive the time until the host's deadline, in
+*                           milliseconds, or DEF_INT_32U_MAX_VAL if it has none. Only set if the host waits.
+*
+* Return(s)   : DEF_YES, if the host must wait for a request in flight to complete,
+*               DEF_NO,  if it can be advanced.
+*
+* Caller(s)   : DNScCache_ResolveAll().
+*
+* Note(s)     : (1) See DNScCache_ResolveAll() Note #4. A waiting host whose deadline has passed is advanced, so
+*                   that DNScCache_Resolve() fails it.
+*
+*               (2) A host waits before DNScCache_Resolve() opens its socket, so that a waiting host holds no
+*                   network resource.
+*
+*               (3) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+static  CPU_BOOLEAN  DNScCache_PendHold (const  DNSc_HOST_OBJ  *p_host,
+                                                NET_TS_MS      *p_dly_ms)
+{
+#if ((DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX > 0u) || \
+     (DNSc_CFG_REQ_PRIO_LOW_NBR_MAX  > 0u))
+    CPU_BOOLEAN  hold = DEF_NO;
+    NET_TS_MS    dly_ms;
+#if (DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX > 0u)
+    CPU_INT32U   in_flight_nbr;
+    CPU_INT08U   ix;
+#endif
+
+
+    if (p_host->PendInFlight == DEF_YES) {
+        return (DEF_NO);
+    }
+
+#if (DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX > 0u)
+    in_flight_nbr = 0u;
+    for (ix = 0u; ix < DNSc_REQ_PRIO_NBR; ix++) {
+        in_flight_nbr += DNScCache_PendListTbl[ix].InFlightNbr;
+    }
+    if (in_flight_nbr >= DNSc_CFG_REQ_IN_FLIGHT_NBR_MAX) {
+        hold = DEF_YES;
+    }
+#endif
+#if (DNSc_CFG_REQ_PRIO_LOW_NBR_MAX > 0u)
+    if ((p_host->PendPrio == DNSc_REQ_PRIO_LOW) &&
+        (DNScCache_PendListTbl[DNSc_REQ_PRIO_LOW].InFlightNbr >= DNSc_CFG_REQ_PRIO_LOW_NBR_MAX)) {
+        hold = DEF_YES;
+    }
+#endif
+
+    if (hold == DEF_NO) {
+        return (DEF_NO);
+    }
+
+    if (DNScCache_HostDeadlineGet(p_host, &dly_ms) == DEF_NO) {
+       *p_dly_ms = DEF_INT_32U_MAX_VAL;
+        return (DEF_YES);
+    }
+
+    if (dly_ms == 0u) {                                         /* See Note #1.                                         */
+        return (DEF_NO);
+    }
+
+   *p_dly_ms = dly_ms;
+
+    return (DEF_YES);
+#else
+   (void)p_host;
+   (void)p_dly_ms;
+
+    return (DEF_NO);
+#endif
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_HostLink()
+*
+* Description : Link a host object at the head of the cache list.
+*
+* Argument(s) : p_host  Pointer to host object.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE   Host successfully linked.
+*
+*                           RETURNED BY DNScCache_ItemGet():
+*                               See DNScCache_ItemGet() for additional return error codes.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostInsert(),
+*               DNScCache_Import().
+*
+* Note(s)     : (1) Cache lock must be acquired by the caller.
+*
+*               (2) A host already linked in the cache list is not linked again. With the slab layout, the
+*                   host's item tells whether it is linked; otherwise, the cache list is searched for it.
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_HostLink (DNSc_HOST_OBJ  *p_host,
+                                  DNSc_ERR       *p_err)
+{
+    DNSc_CACHE_ITEM  *p_cache;
+
+
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_DISABLED)
+    p_cache = DNSc_CacheItemListHead;                           /* See Note #2.                                         */
+    while (p_cache != DEF_NULL) {
+        if (p_cache->HostPtr == p_host) {
+           *p_err = DNSc_ERR_NONE;
+            goto exit;
+        }
+        p_cache = p_cache->NextPtr;
+    }
+#endif
+
+    p_cache = DNScCache_ItemGet(p_host, p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    if (p_cache->HostPtr == p_host) {                           /* Slot item already linked in the cache list.          */
+       *p_err = DNSc_ERR_NONE;
+        goto exit;
+    }
+#endif
+
+    p_cache->HostPtr = p_host;
+
+    if (DNSc_CacheItemListHead == DEF_NULL) {
+        p_cache->NextPtr        = DEF_NULL;
+        DNSc_CacheItemListHead  = p_cache;
+    } else {
+        p_cache->NextPtr        = DNSc_CacheItemListHead;
+        DNSc_CacheItemListHead  = p_cache;
+    }
+
+    DNScCache_Stats.EntriesCur++;
+    if (DNScCache_Stats.EntriesCur > DNScCache_Stats.EntriesPeak) {
+        DNScCache_Stats.EntriesPeak = DNScCache_Stats.EntriesCur;
+    }
+
+   *p_err = DNSc_ERR_NONE;
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostTTL_Get()
+*
+* Description : Get the remaining lifetime of a resolved host.
+*
+* Argument(s) : p_host      Pointer to the host object.
+*
+*               ts_cur_ms   Current timestamp, in milliseconds.
+*
+* Return(s)   : Remaining lifetime, in milliseconds, 0 if the host's TTL has expired.
+*
+* Caller(s)   : DNScCache_Export(),
+*               DNScCache_FrontUpdate(),
+*               DNScCache_Srch().
+*
+* Note(s)     : (1) Must only be called for a host in the DNSc_STATE_RESOLVED state (see DNScCache_Resp()
+*                   Note #1). .TTL_s is bounded to DNSc_CACHE_TTL_MAX_S so the conversion can't overflow.
+*********************************************************************************************************
+*/
+
+static  CPU_INT32U  DNScCache_HostTTL_Get (DNSc_HOST_OBJ  *p_host,
+                                           NET_TS_MS       ts_cur_ms)
+{
+    CPU_INT32U  ttl_ms;
+    NET_TS_MS   ts_delta_ms;
+
+
+    ttl_ms      = p_host->TTL_s * DEF_TIME_NBR_mS_PER_SEC;
+    ts_delta_ms = ts_cur_ms - p_host->TS_ms;
+    if (ts_delta_ms >= ttl_ms) {
+        return (0u);
+    }
+
+    return (ttl_ms - ts_delta_ms);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScCache_FamGet()
+*
+* Description : Get the address families a forward lookup requests.
+*
+* Argument(s) : flags       DNS client flag:
+*
+*                               DNSc_FLAG_NONE              Request all families.
+*                               DNSc_FLAG_IPv4_ONLY         Request only IPv4 address(es).
+*                               DNSc_FLAG_IPv6_ONLY         Request only IPv6 address(es).
+*
+* Return(s)   : Families requested (DNSc_FAMILY_xxx).
+*
+* Caller(s)   : DNScCache_HostObjGet(),
+*               DNScCache_Srch().
+*
+* Note(s)     : (1) The families are limited to the IP modules enabled. A lookup for a family whose module is
+*                   disabled requests the other one, as it did when both queries were always sent.
+*********************************************************************************************************
+*/
+
+static  CPU_INT08U  DNScCache_FamGet (DNSc_FLAGS  flags)
+{
+    CPU_INT08U  fam_all = DNSc_FAMILY_NONE;
+    CPU_INT08U  fam;
+
+
+#ifdef  NET_IPv4_MODULE_EN
+    DEF_BIT_SET(fam_all, DNSc_FAMILY_IPv4);
+#endif
+#ifdef  NET_IPv6_MODULE_EN
+    DEF_BIT_SET(fam_all, DNSc_FAMILY_IPv6);
+#endif
+
+    fam = fam_all;
+    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv4_ONLY)) {
+        fam &= DNSc_FAMILY_IPv4;
+    } else if (DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv6_ONLY)) {
+        fam &= DNSc_FAMILY_IPv6;
+    }
+
+    if (fam == DNSc_FAMILY_NONE) {                              /* See Note #1.                                         */
+        fam = fam_all;
+    }
+
+    return (fam);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostObjNameSet()
+*
+* Description : Set the name in host object.
+*
+* Argument(s) : p_host          Pointer to the host object to set.
+*
+*               p_host_name     Pointer to a string that contains the domain name.
+
+*               p_err           Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE   Host name successfully set.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostObjGet().
+*               DNScCache_Resolve().
+*
+* Note(s)     : (1) The name's length & case-folded hash are computed once here, so that searches can reject
+*                   a host without comparing the names (see DNScCache_HostNameCmp()).
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_HostObjNameSet (       DNSc_HOST_OBJ  *p_host,
+                                        const  CPU_CHAR       *p_host_name,
+                                               DNSc_ERR       *p_err)
+{
+     DNScCache_Gen++;                                           /* Invalidate front cache.                              */
+     Str_Copy_N(p_host->NamePtr, p_host_name, p_host->NameLenMax);
+                                                                /* See Note #1.                                         */
+     p_host->NameHash = DNScCache_NameHash(p_host->NamePtr, p_host->NameLenMax, &p_host->NameLen);
+    *p_err = DNSc_ERR_NONE;
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostSrchByName()
+*
+* Description : Search for an host in the cache from a host name string.
+*
+* Argument(s) : p_host_name     Pointer to a string that contains the domain name.
+*
+*               flags           Flags that determine DNS options. Used to determine reverse lookup.
+*
+* Return(s)   : Pointer to the host object, if found.
+*
+*               DEF_NULL, Otherwise.
+*
+* Caller(s)   : DNScCache_HostObjGet(),
+*               DNScCache_HostSrchRemove(),
+*               DNScCache_Srch().
+*
+* Note(s)     : (1) Reverse lookups are served by the address index (see DNScCache_HostSrchByAddr()).
+*
+*               (2) The searched name is hashed once & compared to the hash stored in every host.
+*********************************************************************************************************
+*/
+
+static  DNSc_HOST_OBJ  *DNScCache_HostSrchByName (const  CPU_CHAR    *p_host_name,
+                                                         DNSc_FLAGS   flags)
+{
+    DNSc_HOST_OBJ    *p_host  = DEF_NULL;
+    DNSc_CACHE_ITEM  *p_cache = DNSc_CacheItemListHead;
+    CPU_BOOLEAN       match;
+    CPU_INT32U        name_hash;
+    CPU_INT16U        name_len;
+
+
+    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_REVERSE_LOOKUP)) {      /* See Note #1.                                         */
+        p_host = DNScCache_HostSrchByAddr(p_host_name, flags);
+        goto exit;
+    }
+
+    if (p_cache == DEF_NULL) {
+        goto exit;
+    }
+                                                                /* See Note #2.                                         */
+    name_hash = DNScCache_NameHash(p_host_name, DNScCache_NameLenMax, &name_len);
+
+    while (p_cache != DEF_NULL) {
+        p_host = p_cache->HostPtr;
+        match  = DNScCache_HostNameCmp(p_host, p_host_name, name_hash, name_len);
+        if (match == DEF_YES) {
+            goto exit;
+        }
+
+        p_cache = p_cache->NextPtr;
+    }
+
+    p_host = DEF_NULL;
+
+exit:
+    return (p_host);
+}
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostSrchByAddr()
+*
+* Description : Search for an host in the cache from the string representation of one of its addresses.
+*
+* Argument(s) : p_host_name     Pointer to a string that contains the IP address.
+*
+*               flags           Flags that determine DNS options :
+*
+*                                   DNSc_FLAG_UPDATE_PREF   Flag the matching address as the preferred reverse
+*                                                           lookup address of the host.
+*
+* Return(s)   : Pointer to the host object, if found.
+*
+*               DEF_NULL, Otherwise.
+*
+* Caller(s)   : DNScCache_HostSrchByName().
+*
+* Note(s)     : (1) The host structure's .NamePtr field in a reverse DNS request may have either a
+*                   domain name or a dotted string representation of the IP address. This is because
+*                   the host may have been resolved by a previous forward DNS request. In both cases the
+*                   address being reverse resolved is stored in the host's addresses table (see
+*                   DNScCache_Resolve()) & is thus found by the address index. Please note that this
+*                   does not apply to the converse. That is, if the host was previously resolved by a
+*                   reverse DNS lookup and if a forward lookup is issued for the same host, the reverse
+*                   name will not be matched to the domain name being searched.
+*
+*               (2) The string is parsed once per search. A string that is not an IP address cannot match
+*                   any host.
+*********************************************************************************************************
+*/
+
+static  DNSc_HOST_OBJ  *DNScCache_HostSrchByAddr (const  CPU_CHAR    *p_host_name,
+                                                         DNSc_FLAGS   flags)
+{
+    DNSc_HOST_OBJ       *p_host = DEF_NULL;
+    DNSc_ADDR_OBJ        addr;
+    NET_IP_ADDR_FAMILY   family;
+    CPU_INT08U           addr_ix;
+    CPU_INT08U           i;
+    NET_ERR              net_err;
+
+                                                                /* See Note #2.                                         */
+    family = NetASCII_Str_to_IP((CPU_CHAR *)p_host_name,
+                                            addr.Addr,
+                                            sizeof(addr.Addr),
+                                           &net_err);
+    if (net_err != NET_ASCII_ERR_NONE) {
+        goto exit;
+    }
+
+    switch (family) {
+        case NET_IP_ADDR_FAMILY_IPv4:
+             addr.Len = NET_IPv4_ADDR_LEN;
+             break;
+
+        case NET_IP_ADDR_FAMILY_IPv6:
+             addr.Len = NET_IPv6_ADDR_LEN;
+             break;
+
+        default:
+             goto exit;
+    }
+
+    p_host = DNScCache_AddrIxSrch(&addr, &addr_ix);
+    if (p_host == DEF_NULL) {
+        goto exit;
+    }
+
+    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_UPDATE_PREF)) {         /* Update preferred address if required.                */
+        for (i = 0u; i < p_host->AddrsCount; i++) {
+            p_host->AddrsTblPtr[i].RevPreferred = (i == addr_ix) ? DEF_YES : DEF_NO;
+        }
+    }
+
+exit:
+    return (p_host);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostNameCmp()
+*
+* Description : Compare host object name field to a host name string.
+*
+* Argument(s) : p_host       Pointer to the host object.
+*
+*               p_host_name  Pointer to a string that contains the host name.
+*
+*               name_hash    Hash of the host name, as returned by DNScCache_NameHash().
+*
+*               name_len     Length of the host name, as returned by DNScCache_NameHash().
+*
+* Return(s)   : DEF_OK, if names match
+*
+*               DEF_FAIL, otherwise
+*
+* Caller(s)   : DNScCache_HostSrchByName(),
+*               DNScCache_Import().
+*
+* Note(s)     : (1) Domain names are case-insensitive (see RFC #1035, section 2.3.3). Hosts whose name length
+*                   or hash differ are rejected without comparing the names.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DNScCache_HostNameCmp (       DNSc_HOST_OBJ  *p_host,
+                                            const  CPU_CHAR       *p_host_name,
+                                                   CPU_INT32U      name_hash,
+                                                   CPU_INT16U      name_len)
+{
+    CPU_BOOLEAN  match;
+    CPU_BOOLEAN  result = DEF_FAIL;
+
+                                                                /* See Note #1.                                         */
+    if ((p_host->NameHash != name_hash) ||
+        (p_host->NameLen  != name_len)) {
+        goto exit;
+    }
+
+    match = DNScCache_NameCmp(p_host_name, p_host->NamePtr, name_len);
+    if (match == DEF_YES) {
+        result = DEF_OK;
+    }
+
+exit:
+    return (result);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_NameHash()
+*
+* Description : Compute the length & the case-folded hash of a host name.
+*
+* Argument(s) : p_name      Pointer to a string that contains the host name.
+*
+*               len_max     Maximum length of the host name.
+*
+*               p_len       Pointer to variable that will receive the length of the host name.
+*
+* Return(s)   : Hash value (FNV-1a) of the host name, converted to lower case.
+*
+* Caller(s)   : DNScCache_FrontSrch(),
+*               DNScCache_HostObjNameSet(),
+*               DNScCache_HostSrchByName(),
+*               DNScHosts_Init(),
+*               DNScHosts_Srch().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Hashing stops at the first NULL character or after 'len_max' characters, so that names
+*                   that are not NULL terminated can be hashed.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  DNScCache_NameHash (const  CPU_CHAR    *p_name,
+                                       CPU_INT16U   len_max,
+                                       CPU_INT16U  *p_len)
+{
+    CPU_INT32U  hash = DNSc_CACHE_HASH_FNV_OFFSET;
+    CPU_INT16U  len  = 0u;
+
+
+    while ((len < len_max) && (p_name[len] != ASCII_CHAR_NULL)) {
+        hash ^= (CPU_INT08U)ASCII_ToLower(p_name[len]);
+        hash *= DNSc_CACHE_HASH_FNV_PRIME;
+        len++;
+    }
+
+   *p_len = len;
+
+    return (hash);
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScCache_NameCmp()
+*
+* Description : Compare two host names, ignoring case.
+*
+* Argument(s) : p_name_1    Pointer to a string that contains the first host name.
+*
+*               p_name_2    Pointer to a string that contains the second host name.
+*
+*               len         Number of characters to compare, as returned by DNScCache_NameHash().
+*
+* Return(s)   : DEF_YES, if the first 'len' characters of both names match ignoring case,
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNScCache_FrontSrch(),
+*               DNScCache_HostNameCmp(),
+*               DNScHosts_Srch().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Both names are expected to be 'len' characters long; the NULL character is not checked.
+*
+*               (2) Once the first name is aligned, the names are compared one word at a time, within 'len' (see
+*                   'dns-c_cache.h  NAME WORD DEFINES'), then one octet at a time for the last characters.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  DNScCache_NameCmp (const  CPU_CHAR    *p_name_1,
+                                const  CPU_CHAR    *p_name_2,
+                                       CPU_INT16U   len)
+{
+           CPU_SIZE_T    ix     = 0u;
+    const  CPU_CHAR     *p_word_1;
+    const  CPU_CHAR     *p_word_2;
+           CPU_INT64U    word_1;
+           CPU_INT64U    word_2;
+           CPU_BOOLEAN   result = DEF_NO;
+
+
+    while ((ix < len) && (DNSc_NAME_WORD_IS_ALIGNED(&p_name_1[ix]) == DEF_NO)) {
+        if (ASCII_ToLower(p_name_1[ix]) != ASCII_ToLower(p_name_2[ix])) {
+            goto exit;
+        }
+        ix++;
+    }
+                                                                /* See Note #2.                                         */
+    while ((len - ix) >= DNSc_NAME_WORD_SIZE) {
+        p_word_1 = &p_name_1[ix];
+        p_word_2 = &p_name_2[ix];
+        word_1   =  DNSc_NAME_WORD_GET(p_word_1);
+        word_2   =  DNSc_NAME_WORD_GET(p_word_2);
+        if ((word_1 != word_2) &&
+            (DNSc_NAME_WORD_TO_LOWER(word_1) != DNSc_NAME_WORD_TO_LOWER(word_2))) {
+            goto exit;
+        }
+        ix += DNSc_NAME_WORD_SIZE;
+    }
+
+    while (ix < len) {
+        if (ASCII_ToLower(p_name_1[ix]) != ASCII_ToLower(p_name_2[ix])) {
+            goto exit;
+        }
+        ix++;
+    }
+
+    result = DEF_YES;
+
+exit:
+    return (result);
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_AddrObjGet()
-*
-* Description : Acquire an address object that can be inserted in host list afterward.
+*                                         DNScCache_AddrHash()
 *
-* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
-*
-*                           DNSc_ERR_NONE   Successfully acquired an address object.
-*                           DNSc_ERR_MEM_ALLOC  Unable to acquire an address object.
+* Description : Compute the hash of an address, used as key of the address index.
 *
-* Return(s)   : Pointer to the address object acquired, if no error.
+* Argument(s) : p_addr  Pointer to the address object.
 *
-*               DEF_NULL, otherwise
+* Return(s)   : Hash value (FNV-1a) of the address length & octets.
 *
-* Caller(s)   : DNScReq_RxRespAddAddr().
+* Caller(s)   : DNScCache_AddrIxAdd(),
+*               DNScCache_AddrIxRemove(),
+*               DNScCache_AddrIxSrch().
 *
 * Note(s)     : None.
 *********************************************************************************************************
 */
 
-DNSc_ADDR_OBJ  *DNScCache_AddrObjGet (DNSc_ERR  *p_err)
+static  CPU_INT32U  DNScCache_AddrHash (const  DNSc_ADDR_OBJ  *p_addr)
 {
-    DNSc_ADDR_OBJ  *p_addr = DEF_NULL;
-    LIB_ERR         err;
-
+    CPU_INT32U  hash = DNSc_CACHE_HASH_FNV_OFFSET;
+    CPU_INT08U  i;
 
-    p_addr = (DNSc_ADDR_OBJ *)Mem_DynPoolBlkGet(&DNScCache_AddrObjPool, &err);
-    if (err != LIB_MEM_ERR_NONE) {
-       *p_err = DNSc_ERR_MEM_ALLOC;
-        goto exit;
-    }
 
-    Mem_Clr(p_addr, sizeof(DNSc_ADDR_OBJ));
+    hash ^= p_addr->Len;
+    hash *= DNSc_CACHE_HASH_FNV_PRIME;
 
-   *p_err = DNSc_ERR_NONE;
+    for (i = 0u; i < p_addr->Len; i++) {
+        hash ^= p_addr->Addr[i];
+        hash *= DNSc_CACHE_HASH_FNV_PRIME;
+    }
 
-exit:
-    return (p_addr);
+    return (hash);
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_AddrObjFree()
+*                                         DNScCache_AddrIxAdd()
+*
+* Description : Add an address of a host object to the address index.
 *
-* Description : Free an address object
+* Argument(s) : p_host      Pointer to the host object.
 *
-* Argument(s) : p_addr  Pointer to address object to free.
+*               addr_ix     Index of the address in the host's addresses table.
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScCache_AddrItemFree(),
-*               DNScReq_RxRespAddAddr().
+* Caller(s)   : DNScCache_HostAddrInsert().
 *
-* Note(s)     : None.
+* Note(s)     : (1) The index always has free entries (see 'CACHE ADDRESS INDEX DATA TYPE' Note #2).
 *********************************************************************************************************
 */
 
-void  DNScCache_AddrObjFree (DNSc_ADDR_OBJ  *p_addr)
+static  void  DNScCache_AddrIxAdd (DNSc_HOST_OBJ  *p_host,
+                                   CPU_INT08U      addr_ix)
 {
-    LIB_ERR  err;
+    CPU_INT32U  ix;
 
 
-    Mem_DynPoolBlkFree(&DNScCache_AddrObjPool, p_addr, &err);
-   (void)&err;
+    ix = DNScCache_AddrHash(&p_host->AddrsTblPtr[addr_ix]) & DNScCache_AddrIxMask;
+    while (DNScCache_AddrIxTbl[ix].HostPtr != DEF_NULL) {       /* See Note #1.                                         */
+        ix = (ix + 1u) & DNScCache_AddrIxMask;
+    }
+
+    DNScCache_AddrIxTbl[ix].HostPtr = p_host;
+    DNScCache_AddrIxTbl[ix].AddrIx  = addr_ix;
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_AddrObjSet()
-*
-* Description : Set address object from IP string.
-*
-* Argument(s) : p_addr      Pointer to the address object.
+*                                       DNScCache_AddrIxRemove()
 *
-*               p_str_addr  Pointer to the string that contains the IP address.
+* Description : Remove an address of a host object from the address index.
 *
-*               p_err       Pointer to variable that will receive the return error code from this function :
+* Argument(s) : p_host      Pointer to the host object.
 *
-*                               DNSc_ERR_NONE           Address successfully set.
-*                               DNSc_ERR_ADDR_INVALID   Invalid IP address.
+*               addr_ix     Index of the address in the host's addresses table.
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScReq_ServerInit(),
-*               DNSc_CfgServerByStr().
+* Caller(s)   : DNScCache_HostAddrClr().
 *
-* Note(s)     : None.
+* Note(s)     : (1) Entries that follow the removed one in the probe sequence are shifted back so that no
+*                   tombstone is required & every remaining entry stays reachable from its home slot.
 *********************************************************************************************************
 */
 
-void  DNScCache_AddrObjSet (DNSc_ADDR_OBJ  *p_addr,
-                            CPU_CHAR       *p_str_addr,
-                            DNSc_ERR       *p_err)
+static  void  DNScCache_AddrIxRemove (DNSc_HOST_OBJ  *p_host,
+                                      CPU_INT08U      addr_ix)
 {
-    NET_IP_ADDR_FAMILY  ip_addr_family;
-    NET_ERR             net_err;
+    DNSc_CACHE_ADDR_IX  *p_entry;
+    CPU_INT32U           ix;
+    CPU_INT32U           ix_next;
+    CPU_INT32U           ix_home;
 
 
-    ip_addr_family = NetASCII_Str_to_IP(         p_str_addr,
-                                        (void *)&p_addr->Addr,
-                                                 sizeof(p_addr->Addr),
-                                                &net_err);
-    if (net_err != NET_ASCII_ERR_NONE) {
-        *p_err = DNSc_ERR_ADDR_INVALID;
-         goto exit;
+    ix = DNScCache_AddrHash(&p_host->AddrsTblPtr[addr_ix]) & DNScCache_AddrIxMask;
+    while (DEF_YES) {
+        p_entry = &DNScCache_AddrIxTbl[ix];
+        if (p_entry->HostPtr == DEF_NULL) {                     /* Addr not in index.                                   */
+            goto exit;
+        }
+        if ((p_entry->HostPtr == p_host) &&
+            (p_entry->AddrIx  == addr_ix)) {
+            break;
+        }
+        ix = (ix + 1u) & DNScCache_AddrIxMask;
     }
 
-    switch (ip_addr_family) {
-        case NET_IP_ADDR_FAMILY_IPv4:
-             p_addr->Len = NET_IPv4_ADDR_SIZE;
-             break;
-
-        case NET_IP_ADDR_FAMILY_IPv6:
-             p_addr->Len = NET_IPv6_ADDR_SIZE;
-             break;
-
-        default:
-            *p_err = DNSc_ERR_ADDR_INVALID;
-             goto exit;
+    ix_next = (ix + 1u) & DNScCache_AddrIxMask;                 /* See Note #1.                                         */
+    while (DNScCache_AddrIxTbl[ix_next].HostPtr != DEF_NULL) {
+        p_entry = &DNScCache_AddrIxTbl[ix_next];
+        ix_home =  DNScCache_AddrHash(&p_entry->HostPtr->AddrsTblPtr[p_entry->AddrIx]) & DNScCache_AddrIxMask;
+                                                                /* Shift entry if its home slot isn't in ]ix, ix_next]. */
+        if (((ix_next - ix_home) & DNScCache_AddrIxMask) >= ((ix_next - ix) & DNScCache_AddrIxMask)) {
+            DNScCache_AddrIxTbl[ix] = *p_entry;
+            ix                      =  ix_next;
+        }
+        ix_next = (ix_next + 1u) & DNScCache_AddrIxMask;
     }
 
-   *p_err = DNSc_ERR_NONE;
+    DNScCache_AddrIxTbl[ix].HostPtr = DEF_NULL;
 
-    exit:
-        return;
+exit:
+    return;
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_ResolveHost()
-*
-* Description : Launch resolution of an host.
-*
-* Argument(s) : p_cfg   Pointer to DNSc's configuration.
+*                                        DNScCache_AddrIxSrch()
 *
-*               p_host  Pointer to the host object.
+* Description : Search the address index for a host that holds an address.
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+* Argument(s) : p_addr      Pointer to the address to search.
 *
-*                           RETURNED BY DNScCache_LockAcquire():
-*                               See DNScCache_LockAcquire() for additional return error codes.
+*               p_addr_ix   Pointer to variable that will receive the index of the address in the host's
+*                           addresses table.
 *
-*                           RETURNED BY DNScCache_Resolve():
-*                               See DNScCache_Resolve() for additional return error codes.
+* Return(s)   : Pointer to the host object, if found.
 *
-* Return(s)   : Resolution status:
-*                       DNSc_STATUS_PENDING         Host resolution is pending, call again to see the status. (Processed by DNSc's task)
-*                       DNSc_STATUS_RESOLVED        Host is resolved.
-*                       DNSc_STATUS_FAILED          Host resolution has failed.
+*               DEF_NULL, Otherwise.
 *
-* Caller(s)   : DNScTask().
+* Caller(s)   : DNScCache_HostSrchByAddr().
 *
 * Note(s)     : None.
 *********************************************************************************************************
 */
 
-DNSc_STATUS  DNScCache_ResolveHost (const  DNSc_CFG       *p_cfg,
-                                           DNSc_HOST_OBJ  *p_host,
-                                           DNSc_ERR       *p_err)
+static  DNSc_HOST_OBJ  *DNScCache_AddrIxSrch (const  DNSc_ADDR_OBJ  *p_addr,
+                                                     CPU_INT08U     *p_addr_ix)
 {
-    DNSc_STATUS  status;
-
-
-    DNScCache_LockAcquire(p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-         goto exit;
+    DNSc_CACHE_ADDR_IX  *p_entry;
+    DNSc_ADDR_OBJ       *p_addr_cur;
+    DNSc_HOST_OBJ       *p_host = DEF_NULL;
+    CPU_INT32U           ix;
+    CPU_BOOLEAN          match;
+
+
+    ix = DNScCache_AddrHash(p_addr) & DNScCache_AddrIxMask;
+    while (DNScCache_AddrIxTbl[ix].HostPtr != DEF_NULL) {
+        p_entry    = &DNScCache_AddrIxTbl[ix];
+        p_addr_cur = &p_entry->HostPtr->AddrsTblPtr[p_entry->AddrIx];
+        if (p_addr_cur->Len == p_addr->Len) {
+            match = Mem_Cmp(p_addr_cur->Addr, p_addr->Addr, p_addr->Len);
+            if (match == DEF_YES) {
+                p_host     = p_entry->HostPtr;
+               *p_addr_ix  = p_entry->AddrIx;
+                goto exit;
+            }
+        }
+        ix = (ix + 1u) & DNScCache_AddrIxMask;
     }
 
-
-    status = DNScCache_Resolve(p_cfg, p_host, p_err);
-
-    DNScCache_LockRelease();
-
-
 exit:
-    return (status);
+    return (p_host);
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_ResolveAll()
-*
-* Description : Launch resolution on all entries that are pending in the cache.
-*
-* Argument(s) : p_cfg   Pointer to DNSc's configuration.
+*                                        DNScCache_QueryIxAdd()
 *
-*               p_err   Pointer to variable that will receive the return error code from this function :
+* Description : Allocate a query ID to a host & add it to the query ID index.
 *
-*                           DNSc_ERR_NONE   Resolution has been launched on all entries.
+* Argument(s) : p_host      Pointer to the host object, w/o query in flight.
 *
-*                           RETURNED BY DNScCache_LockAcquire():
-*                               See DNScCache_LockAcquire() for additional return error codes.
+* Return(s)   : None.
 *
-* Return(s)   : Number of entries that are completed.
+* Caller(s)   : DNScCache_Req().
 *
-* Caller(s)   : DNScTask().
+* Note(s)     : (1) The ID is drawn at random & moved to the next ID until one is neither DNSc_QUERY_ID_NONE nor
+*                   in flight. The index holds at most one ID per host, so a free ID is always found, after a
+*                   single draw most of the time.
 *
-* Note(s)     : None.
+*               (2) Cache lock must be acquired by the caller.
 *********************************************************************************************************
 */
 
-CPU_INT16U  DNScCache_ResolveAll (const  DNSc_CFG  *p_cfg,
-                                         DNSc_ERR  *p_err)
+static  void  DNScCache_QueryIxAdd (DNSc_HOST_OBJ  *p_host)
 {
-    DNSc_CACHE_ITEM  *p_item;
-    DNSc_HOST_OBJ    *p_host;
-    DNSc_STATUS       status;
-    CPU_INT16U        resolved_ctr = 0u;
+    CPU_INT16U  query_id;
+    CPU_INT32U  ix;
 
 
-    DNScCache_LockAcquire(p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-         goto exit;
+    query_id = (CPU_INT16U)(DNScReq_RandGet() >> 16u);          /* See Note #1.                                         */
+    while ((query_id == DNSc_QUERY_ID_NONE) ||
+           (DNScCache_QueryIxSrch(query_id) != DEF_NULL)) {
+        query_id++;
     }
 
+    ix = query_id & DNScCache_QueryIxMask;
+    while (DNScCache_QueryIxTbl[ix].HostPtr != DEF_NULL) {
+        ix = (ix + 1u) & DNScCache_QueryIxMask;
+    }
 
-    p_item = DNSc_CacheItemListHead;
-
-    while (p_item != DEF_NULL) {
-        p_host = p_item->HostPtr;
+    DNScCache_QueryIxTbl[ix].HostPtr = p_host;
+    DNScCache_QueryIxTbl[ix].QueryID = query_id;
+    p_host->QueryID                  = query_id;
+}
 
-        if (p_host->State != DNSc_STATE_RESOLVED) {
-            status = DNScCache_Resolve(p_cfg, p_host, p_err);
-            switch (status) {
-                case DNSc_STATUS_NONE:
-                case DNSc_STATUS_PENDING:
-                     break;
 
-                case DNSc_STATUS_RESOLVED:
-                case DNSc_STATUS_FAILED:
-                default:
-#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
-                    if (KAL_SEM_HANDLE_IS_NULL(p_host->TaskSignal) != DEF_YES) {
-                        KAL_ERR  kal_err;
+/*
+*********************************************************************************************************
+*                                       DNScCache_QueryIxRemove()
+*
+* Description : Remove the query ID of a host from the query ID index, if it has one.
+*
+* Argument(s) : p_host      Pointer to the host object.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostAbort(),
+*               DNScCache_HostObjFree(),
+*               DNScCache_Req(),
+*               DNScCache_Resolve().
+*
+* Note(s)     : (1) See DNScCache_AddrIxRemove() Note #1.
+*
+*               (2) Cache lock must be acquired by the caller, unless the host has no query ID.
+*********************************************************************************************************
+*/
 
+static  void  DNScCache_QueryIxRemove (DNSc_HOST_OBJ  *p_host)
+{
+    DNSc_CACHE_QUERY_IX  *p_entry;
+    CPU_INT32U            ix;
+    CPU_INT32U            ix_next;
+    CPU_INT32U            ix_home;
 
-                        KAL_SemPost(p_host->TaskSignal, KAL_OPT_NONE, &kal_err);
-                    }
-#endif
-                    resolved_ctr++;
-                    break;
-            }
-        }
 
-        p_item = p_item->NextPtr;
+    if (p_host->QueryID == DNSc_QUERY_ID_NONE) {
+        return;
     }
 
+    ix = p_host->QueryID & DNScCache_QueryIxMask;
+    while (DEF_YES) {
+        p_entry = &DNScCache_QueryIxTbl[ix];
+        if (p_entry->HostPtr == DEF_NULL) {                     /* ID not in index.                                     */
+            goto exit;
+        }
+        if (p_entry->QueryID == p_host->QueryID) {
+            break;
+        }
+        ix = (ix + 1u) & DNScCache_QueryIxMask;
+    }
 
-   *p_err = DNSc_ERR_NONE;
-
-    DNScCache_LockRelease();
+    ix_next = (ix + 1u) & DNScCache_QueryIxMask;                /* See Note #1.                                         */
+    while (DNScCache_QueryIxTbl[ix_next].HostPtr != DEF_NULL) {
+        p_entry = &DNScCache_QueryIxTbl[ix_next];
+        ix_home =  p_entry->QueryID & DNScCache_QueryIxMask;
+                                                                /* Shift entry if its home slot isn't in ]ix, ix_next]. */
+        if (((ix_next - ix_home) & DNScCache_QueryIxMask) >= ((ix_next - ix) & DNScCache_QueryIxMask)) {
+            DNScCache_QueryIxTbl[ix] = *p_entry;
+            ix                       =  ix_next;
+        }
+        ix_next = (ix_next + 1u) & DNScCache_QueryIxMask;
+    }
 
+    DNScCache_QueryIxTbl[ix].HostPtr = DEF_NULL;
 
 exit:
-    return (resolved_ctr);
+    p_host->QueryID = DNSc_QUERY_ID_NONE;
 }
 
 
 /*
 *********************************************************************************************************
-*********************************************************************************************************
-*                                      LOCAL FUNCTION PROTOTYPES
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                        DNScCache_LockAcquire()
+*                                        DNScCache_QueryIxSrch()
 *
-* Description : Acquire lock on the cache list.
+* Description : Search the query ID index for the host of a query in flight.
 *
-* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
+* Argument(s) : query_id    Query ID.
 *
-*                           DNSc_ERR_NONE           Lock successfully acquired.
-*                           DNSc_ERR_CACHE_LOCK     Unable to acquire the lock.
+* Return(s)   : Pointer to the host object, if the query is in flight.
 *
-* Return(s)   : None.
+*               DEF_NULL, Otherwise.
 *
-* Caller(s)   : DNScCache_Clr(),
-*               DNScCache_HostInsert(),
-*               DNScCache_HostObjGet(),
-*               DNScCache_HostRemove(),
-*               DNScCache_HostSrchRemove(),
-*               DNScCache_ResolveAll(),
-*               DNScCache_ResolveHost(),
-*               DNScCache_Srch().
+* Caller(s)   : DNScCache_QueryIxAdd(),
+*               DNScReq_RxResp().
 *
-* Note(s)     : None.
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Cache lock must be acquired by the caller.
 *********************************************************************************************************
 */
 
-static  void  DNScCache_LockAcquire (DNSc_ERR  *p_err)
+DNSc_HOST_OBJ  *DNScCache_QueryIxSrch (CPU_INT16U  query_id)
 {
-    KAL_ERR  err;
+    DNSc_CACHE_QUERY_IX  *p_entry;
+    DNSc_HOST_OBJ        *p_host = DEF_NULL;
+    CPU_INT32U            ix;
 
 
-    KAL_LockAcquire(DNScCache_LockHandle, KAL_OPT_PEND_NONE, 0, &err);
-    if (err != KAL_ERR_NONE) {
-        *p_err = DNSc_ERR_CACHE_LOCK;
-         goto exit;
+    ix = query_id & DNScCache_QueryIxMask;
+    while (DNScCache_QueryIxTbl[ix].HostPtr != DEF_NULL) {
+        p_entry = &DNScCache_QueryIxTbl[ix];
+        if (p_entry->QueryID == query_id) {
+            p_host = p_entry->HostPtr;
+            goto exit;
+        }
+        ix = (ix + 1u) & DNScCache_QueryIxMask;
     }
 
-
-   *p_err = DNSc_ERR_NONE;
-
 exit:
-    return;
+    return (p_host);
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_LockRelease()
+*                                        DNScCache_FrontUpdate()
 *
-* Description : Release cache list lock.
+* Description : Copy the answer of a resolved host in the front cache.
 *
-* Argument(s) : None.
+* Argument(s) : p_host          Pointer to the resolved host object.
+*
+*               flags           DNS client flag, only the address family flags are kept.
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNScCache_Clr(),
-*               DNScCache_HostInsert(),
-*               DNScCache_HostObjGet(),
-*               DNScCache_HostRemove(),
-*               DNScCache_HostSrchRemove(),
-*               DNScCache_ResolveAll(),
-*               DNScCache_ResolveHost(),
-*               DNScCache_Srch().
+* Caller(s)   : DNScCache_Srch().
 *
-* Note(s)     : None.
+* Note(s)     : (1) Must be called with the cache lock acquired, so that the current generation matches the
+*                   host's addresses.
+*
+*               (2) Hosts that have more matching addresses than an entry can hold are not copied, so that
+*                   a front cache hit always returns the same addresses as the cache would.
+*
+*               (3) An existing entry for the same host is replaced. Otherwise entries are replaced in
+*                   round-robin order.
 *********************************************************************************************************
 */
 
-static  void  DNScCache_LockRelease (void)
+#if (DNSc_CFG_CACHE_FRONT_NBR_ENTRIES > 0u)
+static  void  DNScCache_FrontUpdate (DNSc_HOST_OBJ  *p_host,
+                                     DNSc_FLAGS      flags)
 {
-    KAL_ERR  err;
+    DNSc_CACHE_FRONT   front;
+    DNSc_CACHE_FRONT  *p_front;
+    DNSc_ADDR_OBJ     *p_addr;
+    CPU_BOOLEAN        no_ipv4;
+    CPU_BOOLEAN        no_ipv6;
+    CPU_INT08U         ix;
+    CPU_INT08U         i;
+    CPU_SR_ALLOC();
+
+
+    flags   &= DNSc_CACHE_FRONT_FLAGS;
+    no_ipv4  = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv6_ONLY);
+    no_ipv6  = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv4_ONLY);
+
+    front.NamePtr    = p_host->NamePtr;
+    front.NameHash   = p_host->NameHash;                        /* Same as query's, names match ignoring case.          */
+    front.NameLen    = p_host->NameLen;
+    front.Flags      = flags;
+    front.Gen        = DNScCache_Gen;                           /* See Note #1.                                         */
+    front.TS_ms      = DNScTask_TS_Get_ms();
+    front.Life_ms    = DNScCache_HostTTL_Get(p_host, front.TS_ms);
+    front.AddrsCount = 0u;
+
+    for (i = 0u; i < p_host->AddrsCount; i++) {
+        p_addr = &p_host->AddrsTblPtr[i];
+        if (((p_addr->Len == NET_IPv4_ADDR_SIZE) && (no_ipv4 == DEF_YES)) ||
+            ((p_addr->Len == NET_IPv6_ADDR_SIZE) && (no_ipv6 == DEF_YES))) {
+            continue;
+        }
+        if (front.AddrsCount >= DNSc_CACHE_FRONT_ADDR_NBR_MAX) {/* See Note #2.                                         */
+            goto exit;
+        }
+        front.Addrs[front.AddrsCount] = *p_addr;
+        front.AddrsCount++;
+    }
+
+    if (front.AddrsCount == 0u) {
+        goto exit;
+    }
 
+    CPU_CRITICAL_ENTER();
+    ix = DNScCache_FrontIxNext;                                 /* See Note #3.                                         */
+    for (i = 0u; i < DNSc_CFG_CACHE_FRONT_NBR_ENTRIES; i++) {
+        p_front = &DNScCache_FrontTbl[i];
+        if ((p_front->NamePtr == p_host->NamePtr) &&
+            (p_front->Flags   == flags)) {
+            ix = i;
+            break;
+        }
+    }
+    if (ix == DNScCache_FrontIxNext) {
+        DNScCache_FrontIxNext = (DNScCache_FrontIxNext + 1u) % DNSc_CFG_CACHE_FRONT_NBR_ENTRIES;
+    }
+    DNScCache_FrontTbl[ix] = front;
+    CPU_CRITICAL_EXIT();
 
-    KAL_LockRelease(DNScCache_LockHandle, &err);
+exit:
+    return;
 }
+#endif
 
 
 /*
 *********************************************************************************************************
-*                                     DNScCache_HostRemoveHandler()
+*                                     DNScCache_StatsServerIxGet()
 *
-* Description : Remove host from the cache.
+* Description : Get the index of a server in the resolver statistics, taking a free slot for a new server.
 *
-* Argument(s) : p_host  Pointer to the host object.
+* Argument(s) : p_server_addr   Pointer to the server address of the request, DEF_NULL for the default server.
 *
-* Return(s)   : None.
+* Return(s)   : Index of the server's slot, if found or taken.
 *
-* Caller(s)   : DNScCache_HostRemove(),
-*               DNScCache_HostSrchRemove().
+*               DNSc_STATS_SERVER_IX_NONE, otherwise.
 *
-* Note(s)     : None.
+* Caller(s)   : DNScCache_Resolve().
+*
+* Note(s)     : (1) Must be called with the cache lock held.
 *********************************************************************************************************
 */
 
-static  void  DNScCache_HostRemoveHandler (DNSc_HOST_OBJ  *p_host)
+static  CPU_INT08U  DNScCache_StatsServerIxGet (const  DNSc_ADDR_OBJ  *p_server_addr)
 {
-    DNSc_CACHE_ITEM  *p_cache = DNSc_CacheItemListHead;
+    DNSc_SERVER_STATS  *p_server;
+    DNSc_ADDR_OBJ       addr;
+    CPU_INT08U          ix;
+    DNSc_ERR            err;
 
 
-    while (p_cache != DEF_NULL) {
-        if (p_cache->HostPtr == p_host) {
-            DNScCache_ItemRelease(p_cache);
+    if (p_server_addr == DEF_NULL) {
+        DNScReq_ServerGet(&addr, &err);
+        if (err != DNSc_ERR_NONE) {
+            ix = DNSc_STATS_SERVER_IX_NONE;
             goto exit;
         }
-        p_cache = p_cache->NextPtr;
+        p_server_addr = &addr;
     }
 
+    for (ix = 0u; ix < DNSc_CFG_STATS_SERVER_NBR_MAX; ix++) {
+        p_server = &DNScCache_ResolverStats.Servers[ix];
+        if (p_server->Addr.Len == 0u) {                         /* Free slot: servers are never removed, so the ...     */
+            p_server->Addr = *p_server_addr;                    /* ... server is not in the tbl.                        */
+            goto exit;
+        }
+
+        if ((p_server->Addr.Len == p_server_addr->Len) &&
+            (Mem_Cmp(p_server->Addr.Addr, p_server_addr->Addr, p_server_addr->Len) == DEF_YES)) {
+            goto exit;
+        }
+    }
+
+    ix = DNSc_STATS_SERVER_IX_NONE;
+
 exit:
-    return;
+    return (ix);
 }
 
 
 /*
 *********************************************************************************************************
-*                                      DNScCache_HostObjNameSet()
-*
-* Description : Set the name in host object.
+*                                        DNScCache_HostBlkGet()
 *
-* Argument(s) : p_host          Pointer to the host object to set.
+* Description : Acquire the memory of a new host object, including its addresses table & its host name.
 *
-*               p_host_name     Pointer to a string that contains the domain name.
-
-*               p_err           Pointer to variable that will receive the return error code from this function :
+* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
 *
-*                               DNSc_ERR_NONE   Host name successfully set.
+*                           DNSc_ERR_NONE       Host object successfully acquired.
+*                           DNSc_ERR_MEM_ALLOC  No free host object.
 *
-* Return(s)   : None.
+* Return(s)   : Pointer to the host object, if no error.
 *
-* Caller(s)   : DNScCache_HostObjGet().
-*               DNScCache_Resolve().
+*               DEF_NULL, otherwise.
 *
-* Note(s)     : None.
+* Caller(s)   : DNScCache_HostObjGet(),
+*               DNScCache_Import().
+*
+* Note(s)     : (1) Optional elements are acquired later by DNScCache_HostElemGet(), only when required by the
+*                   request.
 *********************************************************************************************************
 */
 
-static  void  DNScCache_HostObjNameSet (       DNSc_HOST_OBJ  *p_host,
-                                        const  CPU_CHAR       *p_host_name,
-                                               DNSc_ERR       *p_err)
+static  DNSc_HOST_OBJ  *DNScCache_HostBlkGet (DNSc_ERR  *p_err)
 {
-     Str_Copy_N(p_host->NamePtr, p_host_name, p_host->NameLenMax);
-    *p_err = DNSc_ERR_NONE;
+    DNSc_HOST_OBJ  *p_host = DEF_NULL;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    CPU_INT08U     *p_slot;
+    CPU_INT16U      slot_ix;
+#else
+    CPU_CHAR       *p_name;
+    LIB_ERR         err;
+#endif
+
+
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    if (DNScCache_Slab.FreeNbr == 0u) {
+        DNScCache_Stats.AllocFailHost++;
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+
+    DNScCache_Slab.FreeNbr--;
+    slot_ix = DNScCache_Slab.FreeTblPtr[DNScCache_Slab.FreeNbr];
+    p_slot  = DNScCache_Slab.BasePtr + (slot_ix * DNScCache_Slab.SlotSize);
+
+    p_host          = (DNSc_HOST_OBJ *) p_slot;
+    p_host->NamePtr = (CPU_CHAR      *)(p_slot + DNScCache_Slab.NameOffset);
+                                                                /* Slot item is not linked in the cache list.           */
+  ((DNSc_CACHE_ITEM *)(p_slot + DNScCache_Slab.ItemOffset))->HostPtr = DEF_NULL;
+#else
+    p_host = (DNSc_HOST_OBJ *)Mem_DynPoolBlkGet(&DNScCache_HostObjPool, &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        DNScCache_Stats.AllocFailHost++;
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+
+    p_name = (CPU_CHAR *)Mem_DynPoolBlkGet(&DNScCache_HostNamePool, &err);
+    if (err != LIB_MEM_ERR_NONE) {
+        DNScCache_Stats.AllocFailName++;
+        Mem_DynPoolBlkFree(&DNScCache_HostObjPool, p_host, &err);
+        p_host = DEF_NULL;
+       *p_err  = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+
+    p_host->NamePtr = p_name;
+#endif
+
+    p_host->AddrsTblPtr      = (DNSc_ADDR_OBJ *)(p_host + 1u);  /* Addr tbl follows host obj (see DNScCache_Init()).    */
+                                                                /* Query msg buf follows addr tbl.                      */
+    p_host->QueryMsgPtr      = (CPU_INT08U    *)(p_host->AddrsTblPtr + DNScCache_AddrPerHostMax);
+    p_host->QueryMsgLen      =  0u;
+    p_host->CanonicalNamePtr =  DEF_NULL;                       /* See Note #1.                                         */
+    p_host->ReverseNamePtr   =  DEF_NULL;
+    p_host->ReqCfgPtr        =  DEF_NULL;
+#ifdef  DNSc_TASK_MODULE_EN
+    p_host->PendPrevPtr      =  DEF_NULL;                       /* Not in a pending list (see DNScCache_PendLink()).    */
+    p_host->PendNextPtr      =  DEF_NULL;
+    p_host->PendLinked       =  DEF_NO;
+    p_host->PendInFlight     =  DEF_NO;
+#endif
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+    p_host->TaskSignal       =  KAL_SemHandleNull;              /* No sem until DNScCache_HostObjGet() creates one.     */
+#endif
+
+   *p_err = DNSc_ERR_NONE;
+
+exit:
+    return (p_host);
 }
 
 
 /*
 *********************************************************************************************************
-*                                      DNScCache_HostSrchByName()
-*
-* Description : Search for an host in the cache from a host name string.
+*                                        DNScCache_HostBlkFree()
 *
-* Argument(s) : p_host_name     Pointer to a string that contains the domain name.
-*
-*               flags           Flags that determine DNS options. Used to determine reverse lookup.
+* Description : Release the memory of a host object & of every element acquired for it.
 *
-* Return(s)   : Pointer to the host object, if found.
+* Argument(s) : p_host  Pointer to the host object.
 *
-*               DEF_NULL, Otherwise.
+* Return(s)   : None.
 *
-* Caller(s)   : DNScCache_HostSrchRemove(),
-*               DNScCache_Srch().
+* Caller(s)   : DNScCache_HostObjFree(),
+*               DNScCache_HostObjGet(),
+*               DNScCache_Import().
 *
 * Note(s)     : None.
 *********************************************************************************************************
 */
 
-static  DNSc_HOST_OBJ  *DNScCache_HostSrchByName (const  CPU_CHAR    *p_host_name,
-                                                         DNSc_FLAGS   flags)
+static  void  DNScCache_HostBlkFree (DNSc_HOST_OBJ  *p_host)
 {
-    DNSc_HOST_OBJ    *p_host  = DEF_NULL;
-    DNSc_CACHE_ITEM  *p_cache = DNSc_CacheItemListHead;
-    CPU_BOOLEAN       match;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    CPU_INT16U  slot_ix;
 
 
-    if (p_cache == DEF_NULL) {
-        goto exit;
-    }
+    DNScCache_Gen++;                                            /* Invalidate front cache.                              */
 
-    while (p_cache != DEF_NULL) {
-        p_host = p_cache->HostPtr;
-        match  = DNScCache_HostNameCmp(p_host, p_host_name, flags);
-        if (match == DEF_YES) {
-            goto exit;
-        }
+    slot_ix = (CPU_INT16U)(((CPU_INT08U *)p_host - DNScCache_Slab.BasePtr) / DNScCache_Slab.SlotSize);
 
-        p_cache = p_cache->NextPtr;
-    }
+    DNScCache_Slab.FreeTblPtr[DNScCache_Slab.FreeNbr] = slot_ix;
+    DNScCache_Slab.FreeNbr++;
+#else
+    LIB_ERR  err;
 
-    p_host = DEF_NULL;
 
-exit:
-    return (p_host);
+    DNScCache_Gen++;                                            /* Invalidate front cache.                              */
+                                                                /* .CanonicalNamePtr & .ReverseNamePtr were allocated...*/
+                                                                /* ...if these features were configured  and if their...*/
+                                                                /* ...respective flags were set.                        */
+    if (p_host->CanonicalNamePtr != DEF_NULL) {
+        Mem_DynPoolBlkFree(&DNScCache_HostCanonNamePool, p_host->CanonicalNamePtr, &err);
+    }
+    if (p_host->ReverseNamePtr != DEF_NULL) {
+        Mem_DynPoolBlkFree(&DNScCache_HostRevNamePool, p_host->ReverseNamePtr, &err);
+    }
+    if (p_host->ReqCfgPtr != DEF_NULL) {
+        Mem_DynPoolBlkFree(&DNScCache_ReqCfgPool, p_host->ReqCfgPtr, &err);
+    }
+    Mem_DynPoolBlkFree(&DNScCache_HostNamePool, p_host->NamePtr, &err);
+    Mem_DynPoolBlkFree(&DNScCache_HostObjPool,  p_host,          &err);
+#endif
 }
 
 
 /*
 *********************************************************************************************************
-*                                        DNScCache_HostNameCmp()
+*                                        DNScCache_HostElemGet()
 *
-* Description : Compare host object name field to a host name string.
+* Description : Acquire an optional element of a host object.
 *
-* Argument(s) : p_host       Pointer to the host object.
+* Argument(s) : p_host  Pointer to the host object.
 *
-*               p_host_name  Pointer to a string that contains the host name.
+*               elem    Element to acquire :
 *
-*               flags        Flags that determine DNS options. Used to determine reverse lookup.
+*                           DNSc_CACHE_ELEM_CANON_NAME  Canonical name.
+*                           DNSc_CACHE_ELEM_REV_NAME    Reverse name.
+*                           DNSc_CACHE_ELEM_REQ_CFG     Request configuration.
 *
-* Return(s)   : DEF_OK, if names match
+*               p_err   Pointer to variable that will receive the return error code from this function :
 *
-*               DEF_FAIL, otherwise
+*                           DNSc_ERR_NONE       Element successfully acquired.
+*                           DNSc_ERR_MEM_ALLOC  Unable to acquire the element.
+*                           DNSc_ERR_FAULT      Unknown element.
 *
-* Caller(s)   : DNScCache_HostSrchByName().
+* Return(s)   : Pointer to the element, if no error.
+*
+*               DEF_NULL, otherwise.
+*
+* Caller(s)   : DNScCache_HostObjGet().
 *
-* Note(s)     : (1). The host structure's .NamePtr field in a reverse DNS request may have either a
-*                    domain name or a dotted string representation of the IP address. This is because
-*                    the host may have been resolved by a previous forward DNS request. For this reason
-*                    we compare 'p_host' with .NamePtr if the latter's NetASCII conversion succeeds, and
-*                    to the resolved IP address if the conversion fails. Please note that this algorithm
-*                    does not apply to the converse. That is, if the host was previously resolved by a
-*                    reverse DNS lookup and if a forward lookup is issued for the same host, this function
-*                    will not match the reverse name to the domain name being searched in p_host_name.
+* Note(s)     : (1) When the slab layout is used, the element always exists in the host's slot & cannot fail.
 *********************************************************************************************************
 */
 
-static  CPU_BOOLEAN  DNScCache_HostNameCmp (       DNSc_HOST_OBJ  *p_host,
-                                            const  CPU_CHAR       *p_host_name,
-                                                   DNSc_FLAGS      flags)
+static  void  *DNScCache_HostElemGet (DNSc_HOST_OBJ    *p_host,
+                                      DNSc_CACHE_ELEM   elem,
+                                      DNSc_ERR         *p_err)
 {
-    CPU_INT16S       cmp;
-    CPU_BOOLEAN      result           = DEF_FAIL;
-    CPU_BOOLEAN      addr_found       = DEF_NO;
-#ifdef  NET_IPv4_MODULE_EN
-    CPU_CHAR        *p_host_name_srch = "";
-    CPU_CHAR         host_name_from_addr[DNSc_ADDR_SIZE];
-    NET_IPv4_ADDR    addr;
-#endif
-#ifdef  NET_IPv6_MODULE_EN
-    NET_IPv6_ADDR    addr_ipv6;
+    void          *p_elem = DEF_NULL;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    CPU_SIZE_T     offset;
+#else
+    MEM_DYN_POOL  *p_pool;
+    CPU_INT32U    *p_fail_ctr;
+    LIB_ERR        err;
 #endif
-    CPU_INT08U       addr_len;
-    DNSc_ADDR_ITEM  *p_resolved_addr;
-    CPU_BOOLEAN      is_reverse       = DEF_BIT_IS_SET(flags, DNSc_FLAG_REVERSE_LOOKUP);
-    NET_ERR          net_err          = NET_ASCII_ERR_INVALID_CHAR_VAL;
 
 
-    if (!is_reverse) {
-                                                                /* Compare host name with .NamePtr for forward requests.*/
-        cmp = Str_Cmp_N(p_host_name, p_host->NamePtr, p_host->NameLenMax);
-        if (cmp == 0) {
-            result = DEF_OK;
-        }
-    } else {
-        p_resolved_addr = p_host->AddrsFirstPtr;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)                     /* See Note #1.                                         */
+    switch (elem) {
+        case DNSc_CACHE_ELEM_CANON_NAME:
+             offset = DNScCache_Slab.CanonNameOffset;
+             break;
 
-        while (p_resolved_addr != DEF_NULL) {                   /* Loop through resolved addrs & select preferred addr. */
-            addr_len = p_resolved_addr->AddrPtr->Len;
-            if (DEF_BIT_IS_SET(flags, DNSc_FLAG_UPDATE_PREF)) { /* Update preferred address if required.                */
-                p_resolved_addr->AddrPtr->RevPreferred = DEF_NO;
-            }
+        case DNSc_CACHE_ELEM_REV_NAME:
+             offset = DNScCache_Slab.RevNameOffset;
+             break;
 
-#ifdef  NET_IPv4_MODULE_EN
-            if ((addr_found == DEF_NO) && (addr_len == NET_IPv4_ADDR_LEN)) {
-                Mem_Copy(&addr, (p_resolved_addr->AddrPtr->Addr), addr_len);
+        case DNSc_CACHE_ELEM_REQ_CFG:
+             offset = DNScCache_Slab.ReqCfgOffset;
+             break;
 
-                NetASCII_IPv4_to_Str( addr,
-                                      host_name_from_addr,
-                                      DEF_NO,
-                                     &net_err);
+        default:
+            *p_err = DNSc_ERR_FAULT;
+             goto exit;
+    }
 
-               (void)NetASCII_Str_to_IP( p_host->NamePtr,       /* Check if NamePtr is string representation of IP addr.*/
-                                        &addr,
-                                         DNSc_ADDR_SIZE,
-                                        &net_err);
-                                                                /* If it is, use it for comparison.                     */
-                                                                /* Otherwise use previously resolved IP. (See Note #1). */
-                p_host_name_srch = (net_err == NET_ASCII_ERR_NONE) ?
-                                    p_host->NamePtr                :
-                                    host_name_from_addr;
-                                                                /* Compare host names for reverse IPv4 requests.        */
-
-                cmp = Str_Cmp_N(p_host_name, p_host_name_srch, p_host->NameLenMax);
-                result      = (cmp == 0u);
-                addr_found |= result;
-
-                if (DEF_BIT_IS_SET(flags, DNSc_FLAG_UPDATE_PREF)) { /* Update preferred address if required.            */
-                    p_resolved_addr->AddrPtr->RevPreferred = addr_found;
-                }
-            }
-#endif
-#ifdef  NET_IPv6_MODULE_EN
-            if ((addr_found == DEF_NO)             &&
-                (addr_len   == NET_IPv6_ADDR_LEN)) {            /* Check if NamePtr is string representation of IP addr.*/
-                addr_ipv6 = NetASCII_Str_to_IPv6((CPU_CHAR *)p_host_name,
-                                                            &net_err);
-
-                if (net_err == NET_ASCII_ERR_NONE) {
-                    addr_found = Mem_Cmp(addr_ipv6.Addr, p_resolved_addr->AddrPtr->Addr, NET_IPv6_ADDR_LEN);
-                    result    |= addr_found;
-
-                    if (DEF_BIT_IS_SET(flags, DNSc_FLAG_UPDATE_PREF)) { /* Update preferred address if required.        */
-                        p_resolved_addr->AddrPtr->RevPreferred = addr_found;
-                    }
-                }
-            }
-#endif
-            p_resolved_addr = p_resolved_addr->NextPtr;
-        }
+    p_elem = (void *)((CPU_INT08U *)p_host + offset);
+#else
+   (void)&p_host;
+
+    switch (elem) {
+        case DNSc_CACHE_ELEM_CANON_NAME:
+             p_pool     = &DNScCache_HostCanonNamePool;
+             p_fail_ctr = &DNScCache_Stats.AllocFailCanonName;
+             break;
+
+        case DNSc_CACHE_ELEM_REV_NAME:
+             p_pool     = &DNScCache_HostRevNamePool;
+             p_fail_ctr = &DNScCache_Stats.AllocFailRevName;
+             break;
+
+        case DNSc_CACHE_ELEM_REQ_CFG:
+             p_pool     = &DNScCache_ReqCfgPool;
+             p_fail_ctr = &DNScCache_Stats.AllocFailReqCfg;
+             break;
+
+        default:
+            *p_err = DNSc_ERR_FAULT;
+             goto exit;
     }
 
-    return (result);
+    p_elem = Mem_DynPoolBlkGet(p_pool, &err);
+    if (err != LIB_MEM_ERR_NONE) {
+      (*p_fail_ctr)++;
+        p_elem = DEF_NULL;
+       *p_err  = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+#endif
+
+   *p_err = DNSc_ERR_NONE;
+
+exit:
+    return (p_elem);
 }
 
 
@@ -1635,31 +4209,48 @@ static  CPU_BOOLEAN  DNScCache_HostNameCmp (       DNSc_HOST_OBJ  *p_host,
 *
 * Description : Get an Cache item element (list element)
 *
-* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
+* Argument(s) : p_host  Pointer to the host object that will be referenced by the item.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE       Item successfully acquired.
+*                           DNSc_ERR_MEM_ALLOC  No free item.
 *
 * Return(s)   : Pointer to the item element.
 *
 * Caller(s)   : DNScCache_HostInsert().
 *
-* Note(s)     : None.
+* Note(s)     : (1) When the slab layout is used, the item is located in the slot of the host object.
 *********************************************************************************************************
 */
 
-static  DNSc_CACHE_ITEM  *DNScCache_ItemGet (DNSc_ERR  *p_err)
+static  DNSc_CACHE_ITEM  *DNScCache_ItemGet (DNSc_HOST_OBJ  *p_host,
+                                             DNSc_ERR       *p_err)
 {
     DNSc_CACHE_ITEM  *p_cache;
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_DISABLED)
     LIB_ERR           err;
+#endif
+
 
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)                     /* See Note #1.                                         */
+    p_cache = (DNSc_CACHE_ITEM *)((CPU_INT08U *)p_host + DNScCache_Slab.ItemOffset);
+#else
+   (void)&p_host;
 
     p_cache = (DNSc_CACHE_ITEM *)Mem_DynPoolBlkGet(&DNScCache_ItemPool, &err);
     if (err != LIB_MEM_ERR_NONE) {
+        DNScCache_Stats.AllocFailItem++;
        *p_err = DNSc_ERR_MEM_ALLOC;
         goto exit;
     }
+#endif
 
    *p_err = DNSc_ERR_NONE;
 
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_DISABLED)
 exit:
+#endif
     return (p_cache);
 }
 
@@ -1677,16 +4268,21 @@ exit:
 * Caller(s)   : DNScCache_ItemHostGet(),
 *               DNScCache_ItemRelease().
 *
-* Note(s)     : None.
+* Note(s)     : (1) When the slab layout is used, the item is released with the slot of its host object. It is
+*                   only marked as unlinked from the cache list.
 *********************************************************************************************************
 */
 
 static  void  DNScCache_ItemFree (DNSc_CACHE_ITEM  *p_cache)
 {
+#if (DNSc_CFG_CACHE_SLAB_EN == DEF_ENABLED)
+    p_cache->HostPtr = DEF_NULL;                                /* See Note #1.                                         */
+#else
     LIB_ERR  err;
 
 
     Mem_DynPoolBlkFree(&DNScCache_ItemPool, p_cache, &err);
+#endif
 }
 
 
@@ -1703,24 +4299,26 @@ static  void  DNScCache_ItemFree (DNSc_CACHE_ITEM  *p_cache)
 *
 * Caller(s)   : DNScCache_HostObjGet().
 *
-* Note(s)     : None.
+* Note(s)     : (1) The oldest entry that is not being resolved is reused. Entries whose request is in
+*                   progress, including one another task has just started, are never reused.
+*
+*               (2) An entry whose blocking caller has not been signaled yet is never reused: that caller still
+*                   waits on the entry's semaphore (see DNScCache_HostSignal()).
 *********************************************************************************************************
 */
 
 static  DNSc_HOST_OBJ  *DNScCache_ItemHostGet (void)
 {
-    DNSc_CACHE_ITEM  *p_item_cur = DNSc_CacheItemListHead;
-    DNSc_HOST_OBJ    *p_host     = DEF_NULL;
-
-
-    if (p_item_cur == DEF_NULL) {
-        goto exit;
-    }
+    DNSc_CACHE_ITEM  *p_item_cur   = DNSc_CacheItemListHead;
+    DNSc_CACHE_ITEM  *p_item_found = DEF_NULL;
+    DNSc_HOST_OBJ    *p_host       = DEF_NULL;
 
 
-    while (p_item_cur != DEF_NULL) {
+    while (p_item_cur != DEF_NULL) {                            /* Items are added at the head: keep the last found.    */
         p_host = p_item_cur->HostPtr;
         switch (p_host->State) {
+            case DNSc_STATE_INIT_REQ:                           /* See Note #1.                                         */
+            case DNSc_STATE_IF_SEL:
             case DNSc_STATE_TX_REQ_IPv4:
             case DNSc_STATE_RX_RESP_IPv4:
             case DNSc_STATE_TX_REQ_IPv6:
@@ -1734,22 +4332,31 @@ static  DNSc_HOST_OBJ  *DNScCache_ItemHostGet (void)
             case DNSc_STATE_FREE:
             case DNSc_STATE_FAILED:
             case DNSc_STATE_RESOLVED:
-                 goto exit_found;
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+                 if (KAL_SEM_HANDLE_IS_NULL(p_host->TaskSignal) != DEF_YES) {
+                     break;                                     /* See Note #2.                                         */
+                 }
+#endif
+                 p_item_found = p_item_cur;
+                 break;
 
             default:
-                 p_host = DEF_NULL;
-                 goto exit;
+                 break;
         }
         p_item_cur = p_item_cur->NextPtr;
     }
 
+    if (p_item_found == DEF_NULL) {
+        p_host = DEF_NULL;
+        goto exit;
+    }
 
-    p_host = DEF_NULL;
-    goto exit;
-
-
-exit_found:
-    DNScCache_ItemRemove(p_item_cur);
+    p_host = p_item_found->HostPtr;
+    DNScCache_Stats.Evictions++;
+    DNScCache_ItemRemove(p_item_found);
+#ifdef  DNSc_TASK_MODULE_EN
+    DNScCache_PendUnlink(p_host);
+#endif
     DNScCache_HostAddrClr(p_host);
 
 exit:
@@ -1825,6 +4432,7 @@ static  void  DNScCache_ItemRemove (DNSc_CACHE_ITEM  *p_cache)
 
 
 exit_found:
+    DNScCache_Stats.EntriesCur--;
     DNScCache_ItemFree(p_cache);
 
 exit:
@@ -1832,79 +4440,6 @@ exit:
 }
 
 
-/*
-*********************************************************************************************************
-*                                        DNScCache_AddrItemGet()
-*
-* Description : get an address item element (list)
-*
-* Argument(s) : p_err   Pointer to variable that will receive the return error code from this function :
-*
-*                           DNSc_ERR_NONE       Successfully acquired an address element.
-*                           DNSc_ERR_MEM_ALLOC  Unable to acquire an address element.
-*
-* Return(s)   : Pointer to address element, if no error.
-*
-*               DEF_NULL, otherwise.
-*
-* Caller(s)   : DNScCache_HostAddrInsert().
-*
-* Note(s)     : None.
-*********************************************************************************************************
-*/
-
-static  DNSc_ADDR_ITEM  *DNScCache_AddrItemGet (DNSc_ERR  *p_err)
-{
-    DNSc_ADDR_ITEM  *p_item = DEF_NULL;
-    LIB_ERR          err;
-
-
-    p_item = (DNSc_ADDR_ITEM *)Mem_DynPoolBlkGet(&DNScCache_AddrItemPool, &err);
-    if (err != LIB_MEM_ERR_NONE) {
-       *p_err = DNSc_ERR_MEM_ALLOC;
-        goto exit;
-    }
-
-    p_item->AddrPtr = DEF_NULL;
-    p_item->NextPtr = DEF_NULL;
-
-   *p_err = DNSc_ERR_NONE;
-
-exit:
-    return (p_item);
-}
-
-
-
-/*
-*********************************************************************************************************
-*                                       DNScCache_AddrItemFree()
-*
-* Description : Free an address item element.
-*
-* Argument(s) : p_item  Pointer to the address item element.
-*
-* Return(s)   : None.
-*
-* Caller(s)   : DNScCache_HostRelease().
-*
-* Note(s)     : None.
-*********************************************************************************************************
-*/
-
-static  void  DNScCache_AddrItemFree (DNSc_ADDR_ITEM  *p_item)
-{
-    LIB_ERR  err;
-
-
-    DNScCache_AddrObjFree(p_item->AddrPtr);
-    if (p_item->AddrPtr != DEF_NULL) {
-        Mem_DynPoolBlkFree(&DNScCache_AddrItemPool, p_item, &err);
-    }
-
-   (void)&err;
-}
-
 /*
 *********************************************************************************************************
 *                                        DNScCache_HostRelease()
@@ -1923,7 +4458,9 @@ static  void  DNScCache_AddrItemFree (DNSc_ADDR_ITEM  *p_item)
 
 static  void  DNScCache_HostRelease (DNSc_HOST_OBJ  *p_host)
 {
-
+#ifdef  DNSc_TASK_MODULE_EN
+    DNScCache_PendUnlink(p_host);
+#endif
 
     DNScCache_HostAddrClr(p_host);
     DNScCache_HostObjFree(p_host);
@@ -1936,7 +4473,7 @@ static  void  DNScCache_HostRelease (DNSc_HOST_OBJ  *p_host)
 *********************************************************************************************************
 *                                        DNScCache_HostAddrClr()
 *
-* Description : Remove and free all address elements contained in a host object.
+* Description : Remove all addresses contained in a host object & their entries in the address index.
 *
 * Argument(s) : p_host  Pointer to the host object.
 *
@@ -1944,7 +4481,8 @@ static  void  DNScCache_HostRelease (DNSc_HOST_OBJ  *p_host)
 *
 * Caller(s)   : DNScCache_HostObjFree(),
 *               DNScCache_HostRelease(),
-*               DNScCache_ItemHostGet().
+*               DNScCache_ItemHostGet(),
+*               DNScCache_Resp().
 *
 * Note(s)     : None.
 *********************************************************************************************************
@@ -1952,20 +4490,18 @@ static  void  DNScCache_HostRelease (DNSc_HOST_OBJ  *p_host)
 
 static  void  DNScCache_HostAddrClr (DNSc_HOST_OBJ  *p_host)
 {
-    DNSc_ADDR_ITEM  *p_addr_coll_cur  = p_host->AddrsFirstPtr;
-    DNSc_ADDR_ITEM  *p_addr_coll_next = DEF_NULL;
-
+    CPU_INT08U  i;
 
-    while (p_addr_coll_cur != DEF_NULL) {
-        p_addr_coll_next = p_addr_coll_cur->NextPtr;
 
-        DNScCache_AddrItemFree(p_addr_coll_cur);
-
-        p_addr_coll_cur = p_addr_coll_next;
+    DNScCache_Gen++;                                            /* Invalidate front cache.                              */
+    for (i = 0u; i < p_host->AddrsCount; i++) {
+        DNScCache_AddrIxRemove(p_host, i);
     }
 
-    p_host->AddrsFirstPtr = DEF_NULL;
-    p_host->AddrsEndPtr   = DEF_NULL;
+    p_host->AddrsCount     = 0u;
+    p_host->AddrsIPv4Count = 0u;
+    p_host->AddrsIPv6Count = 0u;
+    p_host->FamDone        = DNSc_FAMILY_NONE;
 }
 
 
@@ -1985,6 +4521,7 @@ static  void  DNScCache_HostAddrClr (DNSc_HOST_OBJ  *p_host)
 *                           DNSc_ERR_MEM_ALLOC          Not enough resources in addr obj pool to complete reverse lookup.
 *                           DNSc_ERR_FAULT              Unknown error (should not occur).
 *                           DNSc_ERR_INVALID_HOST_NAME  Host name could not be set in host structure.
+*                           DNSc_ERR_DEADLINE           Request's deadline has passed (see Note #2).
 *
 *                           RETURNED BY DNScReq_Init():
 *                               See DNScReq_Init() for additional return error codes.
@@ -2003,7 +4540,21 @@ static  void  DNScCache_HostAddrClr (DNSc_HOST_OBJ  *p_host)
 * Caller(s)   : DNScCache_ResolveAll(),
 *               DNScCache_ResolveHost().
 *
-* Note(s)     : none.
+* Note(s)     : (1) Errors are counted in the resolver statistics, except DNSc_ERR_RX which only means that no
+*                   response was received yet (see DNScCache_Resp()).
+*
+*               (2) A request whose deadline has passed fails before its next step, whatever its retries left.
+*
+*               (3) A request is not sent while its server's rate is exceeded (see DNScCache_ServerRateGet()):
+*                   the host stays in its transmit state, & the request is sent on a later call.
+*
+*               (4) A new request starts on the last interface its server answered through, if its link is
+*                   still up; the interfaces are walked otherwise (see 'SERVER INTERFACE DATA TYPE').
+*
+*               (5) A forward lookup queries only the address families requested & not resolved yet in the
+*                   entry (see DNScCache_HostObjGet() Note #1): the A query first, then the AAAA query (see
+*                   DNScCache_Resp() Note #5). The IPv4 addresses of an entry whose IPv6 addresses are being
+*                   added are available as those of a pending IPv6 query (see DNScCache_Srch() Note #3).
 *********************************************************************************************************
 */
 
@@ -2017,8 +4568,9 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
     CPU_BOOLEAN      resolved_addr_found = DEF_NO;
     DNSc_ADDR_OBJ   *p_resolved_addr     = DEF_NULL;
     DNSc_ADDR_OBJ   *p_preferred_addr    = DEF_NULL;
-    DNSc_ADDR_ITEM  *p_item;
-    DNSc_ADDR_OBJ   *p_addr_obj;
+    DNSc_ADDR_OBJ   *p_item;
+    DNSc_ADDR_OBJ    addr_obj;
+    CPU_INT08U       ix;
     CPU_CHAR        *p_reverse_name;
     CPU_INT16U       len;
 #ifdef  NET_IPv4_MODULE_EN
@@ -2027,10 +4579,40 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
 #ifdef  NET_IPv6_MODULE_EN
     NET_IPv6_ADDR    addr_ipv6;
 #endif
+    NET_TS_MS        deadline_ms;
+    DNSc_CACHE_SERVER_IF  *p_server_if;
+    NET_IF_NBR       if_nbr_pref;
     DNSc_ERR         dnsc_err;
     NET_ERR          net_err;
 
 
+    if ((p_host->State != DNSc_STATE_RESOLVED) &&               /* See Note #2.                                         */
+        (p_host->State != DNSc_STATE_FAILED)   &&
+        (DNScCache_HostDeadlineGet(p_host, &deadline_ms) == DEF_YES) &&
+        (deadline_ms   == 0u)) {
+        DNScCache_HostAbort(p_host);
+        status = DNSc_STATUS_FAILED;
+       *p_err  = DNSc_ERR_DEADLINE;
+        goto exit;
+    }
+
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)
+    switch (p_host->State) {                                    /* See Note #3.                                         */
+        case DNSc_STATE_TX_REQ_IPv4:
+        case DNSc_STATE_TX_REQ_IPv6:
+        case DNSc_STATE_TX_REQ_PTR_IPv4:
+        case DNSc_STATE_TX_REQ_PTR_IPv6:
+             if (DNScCache_ServerRateGet(p_host, DEF_YES) > 0u) {
+                *p_err = DNSc_ERR_NONE;
+                 goto exit;
+             }
+             break;
+
+        default:
+             break;
+    }
+#endif
+
     switch (p_host->State) {
         case DNSc_STATE_INIT_REQ:
              if (p_host->ReqCfgPtr != DEF_NULL) {
@@ -2044,14 +4626,28 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                  goto exit;
              }
 
-             p_host->ReqCtr = 0u;
+             p_host->ServerStatsIx = DNScCache_StatsServerIxGet(p_server_addr);
+             p_host->ReqCtr        = 0u;
+             p_host->PartialAvail  = DEF_NO;
+             p_host->QueryMsgLen   = 0u;                        /* Query msg encoded by first req (see DNScCache_Req()).*/
              p_host->State  = DNSc_STATE_IF_SEL;
              status         = DNSc_STATUS_PENDING;
              break;
 
 
         case DNSc_STATE_IF_SEL:
-             p_host->IF_Nbr = DNSc_ReqIF_Sel(p_host->IF_Nbr, p_host->SockID, p_err);
+             p_server_if = DNScCache_ServerIF_Get(p_host);      /* See Note #4.                                         */
+             if_nbr_pref = NET_IF_NBR_NONE;
+             if ((p_host->IF_Nbr      == NET_IF_NBR_WILDCARD) &&
+                 (p_server_if->LinkGen == DNScCache_LinkGen)) {
+                 if_nbr_pref = p_server_if->IF_Nbr;
+             }
+
+             p_host->IF_Nbr = DNSc_ReqIF_Sel(p_host->IF_Nbr, if_nbr_pref, p_host->SockID, p_err);
+             if ((*p_err == DNSc_ERR_IF_LINK_DOWN) ||           /* A link went down since the IF was recorded.          */
+                ((if_nbr_pref != NET_IF_NBR_NONE) && (p_host->IF_Nbr != if_nbr_pref))) {
+                 DNScCache_LinkGen++;
+             }
              if (*p_err != DNSc_ERR_NONE) {
                  status = DNSc_STATUS_FAILED;
                  break;
@@ -2060,7 +4656,10 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
 #ifdef  NET_IP_MODULE_EN
     #ifdef  NET_IPv4_MODULE_EN
              if (DEF_BIT_IS_CLR(p_host->ReqCfgPtr->ReqFlags, DNSc_FLAG_REVERSE_LOOKUP)) {
-                 p_host->State = DNSc_STATE_TX_REQ_IPv4;
+                 if ((DEF_BIT_IS_SET(p_host->FamReq,  DNSc_FAMILY_IPv4)) &&
+                     (DEF_BIT_IS_CLR(p_host->FamDone, DNSc_FAMILY_IPv4))) {
+                     p_host->State = DNSc_STATE_TX_REQ_IPv4;    /* See Note #5.                                         */
+                 }
              } else {
                  if (p_host->ReqCfgPtr->ReqType == DNSc_REQ_TYPE_PTR_IPv4) {
                      p_host->State = DNSc_STATE_TX_REQ_PTR_IPv4;
@@ -2071,6 +4670,7 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
              if (DEF_BIT_IS_CLR(p_host->ReqCfgPtr->ReqFlags, DNSc_FLAG_REVERSE_LOOKUP)) {
                  if (p_host->State == DNSc_STATE_IF_SEL) {      /* If prev ReqType was not DNSc_STATE_TX_REQ_IPv4 NOR...*/
                      p_host->State = DNSc_STATE_TX_REQ_IPv6;    /* ...DNSc_STATE_TX_REQ_PTR_IPv4, check if it's IPv6.   */
+                     p_host->PartialAvail = (p_host->AddrsIPv4Count > 0u) ? DEF_YES : DEF_NO;
                  }
              } else {
                  if (p_host->ReqCfgPtr->ReqType == DNSc_REQ_TYPE_PTR_IPv6) {
@@ -2102,19 +4702,19 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                                      &net_err);
 
              if (net_err != NET_ASCII_ERR_NONE) {               /* If not, find host's first avail IPv4 addr as there...*/
-                 p_item = p_host->AddrsFirstPtr;                /* ...might have been one already resolved by a prev ...*/
+                                                                /* ...might have been one already resolved by a prev ...*/
                                                                 /* ...fwd req. Prioritize any preferred IP addr we find.*/
-                 while (p_item != DEF_NULL) {
-                     if (p_item->AddrPtr->Len == NET_IPv4_ADDR_LEN) {
+                 for (ix = 0u; ix < p_host->AddrsCount; ix++) {
+                     p_item = &p_host->AddrsTblPtr[ix];
+                     if (p_item->Len == NET_IPv4_ADDR_LEN) {
                          resolved_addr_found = DEF_YES;
-                         p_resolved_addr     = p_item->AddrPtr;
+                         p_resolved_addr     = p_item;
 
-                         if (p_item->AddrPtr->RevPreferred) {
+                         if (p_item->RevPreferred) {
                              p_preferred_addr = p_resolved_addr;
                              break;
                          }
                      }
-                     p_item = p_item->NextPtr;
                  }
 
                  if (p_preferred_addr != DEF_NULL) {
@@ -2131,58 +4731,43 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                  }
              }
 
-             p_addr_obj = DNScCache_AddrObjGet(&dnsc_err);      /* Alloc temp cache addr obj & populate it w/ IPv4 addr.*/
-             if (dnsc_err == DNSc_ERR_NONE) {
-                 p_addr_obj->Addr[0u] = ((addr & 0x000000FFu) >> (0u * DEF_INT_08_NBR_BITS));
-                 p_addr_obj->Addr[1u] = ((addr & 0x0000FF00u) >> (1u * DEF_INT_08_NBR_BITS));
-                 p_addr_obj->Addr[2u] = ((addr & 0x00FF0000u) >> (2u * DEF_INT_08_NBR_BITS));
-                 p_addr_obj->Addr[3u] = ((addr & 0xFF000000u) >> (3u * DEF_INT_08_NBR_BITS));
-
-                                                                /* Allocate addr item & assign it the temp addr obj  ...*/
-                 if (resolved_addr_found == DEF_NO) {           /* ...once we've determined that PTR req is valid,   ...*/
-                     p_item = DNScCache_AddrItemGet(&dnsc_err); /* ...that the addr was not found and that a new req ...*/
-                     if (dnsc_err == DNSc_ERR_NONE) {           /* ...is needed.                                        */
-                         p_addr_obj->Len               = NET_IPv4_ADDR_LEN;
-                         p_item->AddrPtr               = p_addr_obj;
-                         p_item->AddrPtr->RevPreferred = DEF_YES;
-                         p_item->NextPtr               = DEF_NULL;
-                         p_host->AddrsFirstPtr         = p_item;/* Point host's first addr to allocated cache addr item.*/
-                     } else {
-                         status = DNSc_STATUS_FAILED;
-                        *p_err  = DNSc_ERR_MEM_ALLOC;
-                         DNScCache_AddrObjFree(p_addr_obj);
-                         goto exit;
-                     }
-                 } else {
-                     DNScCache_AddrObjFree(p_addr_obj);         /* Discard 'p_addr_obj' as it is no longer needed.      */
+                                                                /* Populate temp addr obj w/ IPv4 addr, stored as ...   */
+                                                                /* ...resolved addrs are (see DNScCache_AddrIxSrch()).  */
+             Mem_Copy(addr_obj.Addr, &addr, NET_IPv4_ADDR_LEN);
+
+                                                                /* Insert temp addr obj in host's addr tbl once we've...*/
+             if (resolved_addr_found == DEF_NO) {               /* ...determined that PTR req is valid, that the addr...*/
+                 addr_obj.Len          = NET_IPv4_ADDR_LEN;     /* ...was not found and that a new req is needed.       */
+                 addr_obj.RevPreferred = DEF_YES;
+                 DNScCache_HostAddrInsert(p_cfg, p_host, &addr_obj, &dnsc_err);
+                 if (dnsc_err != DNSc_ERR_NONE) {
+                     status = DNSc_STATUS_FAILED;
+                    *p_err  = DNSc_ERR_MEM_ALLOC;
+                     goto exit;
                  }
+             }
                                                                 /* Convert IPv4 addr to its dotted str representation...*/
                                                                 /* ...& set it in host struct's .ReverseNamePtr field.  */
-                 addr = NET_UTIL_VAL_SWAP_ORDER_32(addr);
-                 NetASCII_IPv4_to_Str( addr,
-                                       p_host->ReverseNamePtr,
-                                       DEF_NO,
-                                      &net_err);
+             addr = NET_UTIL_VAL_SWAP_ORDER_32(addr);
+             NetASCII_IPv4_to_Str( addr,
+                                   p_host->ReverseNamePtr,
+                                   DEF_NO,
+                                  &net_err);
                                                                 /* To convert request to reverse lookup (PTR) type,...  */
                                                                 /* ...append mapping domain to .ReverseNamePtr field.   */
-                 len = Str_Len_N(p_host->ReverseNamePtr, p_host->NameLenMax);
-
-                 if ((p_host->NameLenMax - len) <= DNSc_REVERSE_MAPPING_DOMAIN_IPv4_STR_LEN) {
-                     status = DNSc_STATUS_FAILED;
-                    *p_err  = DNSc_ERR_INVALID_HOST_NAME;
-                     goto exit;
-                 }
-                 p_host->State  = DNSc_STATE_TX_REQ_PTR_IPv4;
-                 p_reverse_name = Str_Cat_N(p_host->ReverseNamePtr,
-                                            DNSc_REVERSE_MAPPING_DOMAIN_IPv4_STR,
-                                            DNSc_REVERSE_MAPPING_DOMAIN_IPv4_STR_LEN);
+             len = Str_Len_N(p_host->ReverseNamePtr, p_host->NameLenMax);
 
-                 Str_Copy_N(p_host->ReverseNamePtr, p_reverse_name, p_host->NameLenMax);
-             } else {
+             if ((p_host->NameLenMax - len) <= DNSc_REVERSE_MAPPING_DOMAIN_IPv4_STR_LEN) {
                  status = DNSc_STATUS_FAILED;
-                *p_err  = DNSc_ERR_MEM_ALLOC;
+                *p_err  = DNSc_ERR_INVALID_HOST_NAME;
                  goto exit;
              }
+             p_host->State  = DNSc_STATE_TX_REQ_PTR_IPv4;
+             p_reverse_name = Str_Cat_N(p_host->ReverseNamePtr,
+                                        DNSc_REVERSE_MAPPING_DOMAIN_IPv4_STR,
+                                        DNSc_REVERSE_MAPPING_DOMAIN_IPv4_STR_LEN);
+
+             Str_Copy_N(p_host->ReverseNamePtr, p_reverse_name, p_host->NameLenMax);
 
              DNScCache_Req(p_host, p_err);
              status = DNSc_STATUS_PENDING;
@@ -2197,19 +4782,18 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                                      &addr_ipv6,
                                       NET_IPv6_ADDR_LEN,
                                      &net_err);
-             if (net_err != NET_ASCII_ERR_NONE) {
-                 p_item = p_host->AddrsFirstPtr;                /* If not, find host's first avail IPv6 addr as there...*/
+             if (net_err != NET_ASCII_ERR_NONE) {               /* If not, find host's first avail IPv6 addr as there...*/
                                                                 /* ...might have been one already resolved by a prev ...*/
-                 while (p_item != DEF_NULL) {                   /* ...fwd req. Prioritize any preferred IP addr we find.*/
-                     if (p_item->AddrPtr->Len == NET_IPv6_ADDR_LEN) {
+                 for (ix = 0u; ix < p_host->AddrsCount; ix++) { /* ...fwd req. Prioritize any preferred IP addr we find.*/
+                     p_item = &p_host->AddrsTblPtr[ix];
+                     if (p_item->Len == NET_IPv6_ADDR_LEN) {
                          resolved_addr_found = DEF_YES;
-                         p_resolved_addr = p_item->AddrPtr;
-                         if (p_item->AddrPtr->RevPreferred) {
+                         p_resolved_addr = p_item;
+                         if (p_item->RevPreferred) {
                              p_preferred_addr = p_resolved_addr;
                              break;
                          }
                      }
-                     p_item = p_item->NextPtr;
                  }
 
                  if (p_preferred_addr != DEF_NULL) {
@@ -2226,82 +4810,67 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
                  }
              }
 
-             p_addr_obj = DNScCache_AddrObjGet(&dnsc_err);      /* Alloc temp cache addr obj & populate it w/ IPv6 addr.*/
-             if (dnsc_err == DNSc_ERR_NONE) {
-                 Mem_Clr(p_host->ReverseNamePtr, p_host->NameLenMax);
-
-                 for (CPU_INT16U i = NET_IPv6_ADDR_LEN; i > 0; i--) {  /* Swap addr bytes.                              */
-                      p_addr_obj->Addr[i - 1u] = addr_ipv6.Addr[NET_IPv6_ADDR_LEN - i];
-                 }
-                 CPU_INT16U i = 0;                              /* Construct reverse IPv6 host name for PTR request.    */
-                 for (CPU_INT16U j = 0u; i < NET_IPv6_ADDR_LEN; j += 4u) {
-                      CPU_CHAR prepend = ((p_addr_obj->Addr[i] == 0u) || ((p_addr_obj->Addr[i] > 0) && (p_addr_obj->Addr[i] < DEF_NBR_BASE_HEX))) ? '0' : DEF_NULL;
-                      Str_FmtNbr_Int32U( p_addr_obj->Addr[i],
-                                         2u,
-                                         DEF_NBR_BASE_HEX,
-                                         prepend,
-                                         DEF_YES,
-                                         DEF_NO,
-                                        (p_host->ReverseNamePtr + j));
-
-                     *(p_host->ReverseNamePtr + j + 2u) = *(p_host->ReverseNamePtr + j);
-                     *(p_host->ReverseNamePtr + j)      = *(p_host->ReverseNamePtr + j + 1u);
-                     *(p_host->ReverseNamePtr + j + 1u) = '.';
-
-                      if (j < (4 * NET_IPv6_ADDR_LEN) - 4u) {
-                        *(p_host->ReverseNamePtr + j + 3u) = '.';
-                      }
-                      i++;
-                 }
+             Mem_Clr(p_host->ReverseNamePtr, p_host->NameLenMax);
+                                                                /* Populate temp addr obj w/ swapped IPv6 addr bytes.   */
+             for (CPU_INT16U i = NET_IPv6_ADDR_LEN; i > 0; i--) {
+                  addr_obj.Addr[i - 1u] = addr_ipv6.Addr[NET_IPv6_ADDR_LEN - i];
+             }
+             CPU_INT16U i = 0;                                  /* Construct reverse IPv6 host name for PTR request.    */
+             for (CPU_INT16U j = 0u; i < NET_IPv6_ADDR_LEN; j += 4u) {
+                  CPU_CHAR prepend = ((addr_obj.Addr[i] == 0u) || ((addr_obj.Addr[i] > 0) && (addr_obj.Addr[i] < DEF_NBR_BASE_HEX))) ? '0' : DEF_NULL;
+                  Str_FmtNbr_Int32U( addr_obj.Addr[i],
+                                     2u,
+                                     DEF_NBR_BASE_HEX,
+                                     prepend,
+                                     DEF_YES,
+                                     DEF_NO,
+                                    (p_host->ReverseNamePtr + j));
+
+                 *(p_host->ReverseNamePtr + j + 2u) = *(p_host->ReverseNamePtr + j);
+                 *(p_host->ReverseNamePtr + j)      = *(p_host->ReverseNamePtr + j + 1u);
+                 *(p_host->ReverseNamePtr + j + 1u) = '.';
+
+                  if (j < (4 * NET_IPv6_ADDR_LEN) - 4u) {
+                    *(p_host->ReverseNamePtr + j + 3u) = '.';
+                  }
+                  i++;
+             }
 
-                 if (resolved_addr_found == DEF_NO) {
-                     p_item = DNScCache_AddrItemGet(&dnsc_err); /* Alloc new address item since we've determined that...*/
-                                                                /* ... hostname is valid but a new PTR req is required. */
-                     if (dnsc_err == DNSc_ERR_NONE) {
+             if (resolved_addr_found == DEF_NO) {               /* Insert temp addr obj in host's addr tbl since we've..*/
+                                                                /* ...determined that hostname is valid but a new PTR...*/
+                                                                /* ...req is required.                                  */
                                                                 /* If name was string representation, convert back to...*/
-                         if (net_err == NET_ASCII_ERR_NONE) {   /* ...host order for DNScCache_HostNameCmp() comparison.*/
-                             for (CPU_INT16U i = 0u; i < NET_IPv6_ADDR_LEN; i++) {
-                                  p_addr_obj->Addr[i] = addr_ipv6.Addr[i];
-                             }
-                         }
-                         p_addr_obj->Len               = NET_IPv6_ADDR_LEN;
-                         p_item->AddrPtr               = p_addr_obj; /* Keep temp addr obj & assign it to new addr item.*/
-
-                                                                     /* Flag addr as the preferred reverse resolution...*/
-                         p_item->AddrPtr->RevPreferred = DEF_YES;    /*...IPv6 addr since we couldn't find one resolved.*/
-                         p_item->NextPtr               = DEF_NULL;
-                         p_host->AddrsFirstPtr         = p_item;     /* Point host's first addr to new cache addr item. */
-
-                     } else {
-                         status = DNSc_STATUS_FAILED;
-                        *p_err  = DNSc_ERR_MEM_ALLOC;
-                         DNScCache_AddrObjFree(p_addr_obj);
-                         goto exit;
+                 if (net_err == NET_ASCII_ERR_NONE) {           /* ...host order for the addr index comparison.       */
+                     for (CPU_INT16U i = 0u; i < NET_IPv6_ADDR_LEN; i++) {
+                          addr_obj.Addr[i] = addr_ipv6.Addr[i];
                      }
-                 } else {
-                     DNScCache_AddrObjFree(p_addr_obj);         /* If addr was found in cache, discard temp addr obj.   */
                  }
-                                                                /* To convert request to reverse lookup (PTR) type,...  */
-                                                                /* ...append mapping domain to .ReverseNamePtr field.   */
-                 len = Str_Len_N(p_host->ReverseNamePtr, p_host->NameLenMax);
-
-                 if ((p_host->NameLenMax - len) <= DNSc_REVERSE_MAPPING_DOMAIN_IPv6_STR_LEN) {
+                 addr_obj.Len          = NET_IPv6_ADDR_LEN;
+                                                                /* Flag addr as the preferred reverse resolution IPv6...*/
+                 addr_obj.RevPreferred = DEF_YES;               /* ...addr since we couldn't find one resolved.         */
+                 DNScCache_HostAddrInsert(p_cfg, p_host, &addr_obj, &dnsc_err);
+                 if (dnsc_err != DNSc_ERR_NONE) {
                      status = DNSc_STATUS_FAILED;
-                    *p_err  = DNSc_ERR_INVALID_HOST_NAME;
+                    *p_err  = DNSc_ERR_MEM_ALLOC;
                      goto exit;
                  }
+             }
+                                                                /* To convert request to reverse lookup (PTR) type,...  */
+                                                                /* ...append mapping domain to .ReverseNamePtr field.   */
+             len = Str_Len_N(p_host->ReverseNamePtr, p_host->NameLenMax);
 
-                 p_host->State  = DNSc_STATE_TX_REQ_PTR_IPv6;
-                 p_reverse_name = Str_Cat_N(p_host->ReverseNamePtr,
-                                            DNSc_REVERSE_MAPPING_DOMAIN_IPv6_STR,
-                                            DNSc_REVERSE_MAPPING_DOMAIN_IPv6_STR_LEN);
-
-                 Str_Copy_N(p_host->ReverseNamePtr, p_reverse_name, p_host->NameLenMax);
-             } else {
+             if ((p_host->NameLenMax - len) <= DNSc_REVERSE_MAPPING_DOMAIN_IPv6_STR_LEN) {
                  status = DNSc_STATUS_FAILED;
-                *p_err  = DNSc_ERR_MEM_ALLOC;
+                *p_err  = DNSc_ERR_INVALID_HOST_NAME;
                  goto exit;
              }
+
+             p_host->State  = DNSc_STATE_TX_REQ_PTR_IPv6;
+             p_reverse_name = Str_Cat_N(p_host->ReverseNamePtr,
+                                        DNSc_REVERSE_MAPPING_DOMAIN_IPv6_STR,
+                                        DNSc_REVERSE_MAPPING_DOMAIN_IPv6_STR_LEN);
+
+             Str_Copy_N(p_host->ReverseNamePtr, p_reverse_name, p_host->NameLenMax);
              DNScCache_Req(p_host, p_err);
              status = DNSc_STATUS_PENDING;
 #endif
@@ -2338,11 +4907,18 @@ static  DNSc_STATUS  DNScCache_Resolve (const  DNSc_CFG       *p_cfg,
         case DNSc_STATUS_FAILED:
         default:
              DNSc_ReqClose(p_host->SockID);
+             p_host->SockID = NET_SOCK_ID_NONE;
+             DNScCache_QueryIxRemove(p_host);
              break;
     }
 
 
 exit:
+    if ((*p_err != DNSc_ERR_NONE) &&                            /* See Note #1.                                         */
+        (*p_err != DNSc_ERR_RX)) {
+        DNScCache_ResolverStats.Errs[DNSc_StatsErrIxGet(*p_err)]++;
+    }
+
     return (status);
 }
 
@@ -2366,14 +4942,25 @@ exit:
 *
 * Caller(s)   : DNScCache_Resolve().
 *
-* Note(s)     : None.
+* Note(s)     : (1) .ReqCtr is reset for each query type, so any request sent after the first one of a query type
+*                   is a retransmission.
+*
+*               (2) Each request, retransmissions included, is sent w/ a new random ID (see
+*                   DNScCache_QueryIxAdd()); a late response to a previous request is dropped.
+*
+*               (3) The query message is encoded by the first request of a resolution, in the host's buffer.
+*                   The following requests (the other address family & the retransmissions) send the same
+*                   message; only its ID & its type are set by DNScReq_TxReq().
 *********************************************************************************************************
 */
 
 static  void  DNScCache_Req (DNSc_HOST_OBJ  *p_host,
                              DNSc_ERR       *p_err)
 {
-    DNSc_REQ_TYPE  req_type;
+    DNSc_REQ_TYPE       req_type;
+    CPU_CHAR           *p_name;
+    CPU_INT16U          name_len;
+    DNSc_SERVER_STATS  *p_server = DEF_NULL;
 
 
     switch (p_host->State) {
@@ -2399,16 +4986,36 @@ static  void  DNScCache_Req (DNSc_HOST_OBJ  *p_host,
     }
 
 
-    if ((req_type == DNSc_REQ_TYPE_PTR_IPv4) || (req_type == DNSc_REQ_TYPE_PTR_IPv6)) {
-        p_host->QueryID = DNScReq_TxReq(p_host->ReverseNamePtr, p_host->SockID, DNSc_QUERY_ID_NONE, req_type, p_err);
-    } else {
-        p_host->QueryID = DNScReq_TxReq(p_host->NamePtr, p_host->SockID, DNSc_QUERY_ID_NONE, req_type, p_err);
+    if (p_host->QueryMsgLen == 0u) {                            /* See Note #3.                                         */
+        p_name = ((req_type == DNSc_REQ_TYPE_PTR_IPv4) || (req_type == DNSc_REQ_TYPE_PTR_IPv6)) ? p_host->ReverseNamePtr
+                                                                                                : p_host->NamePtr;
+        name_len = (p_name == p_host->NamePtr) ? p_host->NameLen
+                                               : (CPU_INT16U)Str_Len_N(p_name, p_host->NameLenMax);
+        p_host->QueryMsgLen = DNScReq_QueryEncode(p_host->QueryMsgPtr,
+                                                  DNScCache_QueryLenMax,
+                                                  p_name,
+                                                  name_len,
+                                                  p_err);
+        if (*p_err != DNSc_ERR_NONE) {
+            p_host->QueryMsgLen = 0u;
+            goto exit;
+        }
+    }
+
+    DNScCache_QueryIxRemove(p_host);                            /* See Note #2.                                         */
+    DNScCache_QueryIxAdd(p_host);
+
+    (void)DNScReq_TxReq(p_host->QueryMsgPtr, p_host->QueryMsgLen, p_host->SockID, p_host->QueryID, req_type, p_err);
+    if (*p_err != DNSc_ERR_NONE) {                              /* No query in flight.                                  */
+        DNScCache_QueryIxRemove(p_host);
     }
+
     switch (*p_err) {
         case DNSc_ERR_NONE:
              break;
 
         case DNSc_ERR_IF_LINK_DOWN:
+             DNScCache_LinkGen++;                               /* See 'SERVER INTERFACE DATA TYPE' Note #2.            */
              p_host->State = DNSc_STATE_IF_SEL;
              goto exit_no_err;
 
@@ -2439,9 +5046,21 @@ static  void  DNScCache_Req (DNSc_HOST_OBJ  *p_host,
     }
 
 
-    p_host->TS_ms = NetUtil_TS_Get_ms();
+    p_host->TS_ms = DNScTask_TS_Get_ms();
     p_host->ReqCtr++;
 
+    if (p_host->ServerStatsIx < DNSc_CFG_STATS_SERVER_NBR_MAX) {
+        p_server = &DNScCache_ResolverStats.Servers[p_host->ServerStatsIx];
+        p_server->Req++;
+    }
+    DNScCache_ResolverStats.Req++;
+    if (p_host->ReqCtr > 1u) {                                  /* See Note #1.                                         */
+        DNScCache_ResolverStats.ReTx++;
+        if (p_server != DEF_NULL) {
+            p_server->ReTx++;
+        }
+    }
+
 
 exit_no_err:
    *p_err = DNSc_ERR_NONE;
@@ -2476,7 +5095,22 @@ exit:
 *
 * Caller(s)   : DNScCache_Resolve().
 *
-* Note(s)     : None.
+* Note(s)     : (1) Once resolved, .TS_ms holds the time of the resolution & .TTL_s the lifetime of the entry,
+*                   bounded to [DNSc_CACHE_TTL_MIN_S, DNSc_CACHE_TTL_MAX_S]. The lower bound leaves time for
+*                   the application to retrieve the result of a non-blocking resolution.
+*
+*               (2) The latency of a response is measured from the transmission of the last request, i.e. from
+*                   the time set in .TS_ms by DNScCache_Req(), to its reception.
+*
+*               (3) The interface a response is received through is recorded as the server's known-good
+*                   interface; the record is cleared once the server stops answering (see 'SERVER INTERFACE
+*                   DATA TYPE').
+*
+*               (4) Once the IPv4 phase has resolved addresses, they are available while the IPv6 query is in
+*                   progress (see DNScCache_Srch() Note #3); the IPv6 addresses are added to the same entry.
+*
+*               (5) The AAAA query follows the A query only if the IPv6 family is requested & not resolved yet
+*                   in the entry (see DNScCache_Resolve() Note #5).
 *********************************************************************************************************
 */
 
@@ -2484,14 +5118,16 @@ static  DNSc_STATUS  DNScCache_Resp (const  DNSc_CFG       *p_cfg,
                                             DNSc_HOST_OBJ  *p_host,
                                             DNSc_ERR       *p_err)
 {
-    DNSc_STATUS      status;
-    NET_TS_MS        ts_cur_ms;
-    NET_TS_MS        ts_delta_ms;
-    NET_TS_MS        timeout_ms   = (NET_TS_MS)p_cfg->ReqRetryTimeout_ms;
-    CPU_INT08U       req_retry    =  p_cfg->ReqRetryNbrMax;
-    CPU_BOOLEAN      re_tx        =  DEF_NO;
-    CPU_BOOLEAN      change_state =  DEF_NO;
-    DNSc_ADDR_ITEM  *p_addr_item;
+    DNSc_STATUS          status;
+    NET_TS_MS            ts_cur_ms;
+    NET_TS_MS            ts_delta_ms;
+    NET_TS_MS            timeout_ms   = (NET_TS_MS)p_cfg->ReqRetryTimeout_ms;
+    CPU_INT08U           req_retry    =  p_cfg->ReqRetryNbrMax;
+    CPU_BOOLEAN          re_tx        =  DEF_NO;
+    CPU_BOOLEAN          change_state =  DEF_NO;
+    DNSc_STATS_QTYPE     qtype;
+    DNSc_SERVER_STATS   *p_server     =  DEF_NULL;
+    DNSc_CACHE_SERVER_IF  *p_server_if;
 
 
     if (p_host->ReqCfgPtr != DEF_NULL) {
@@ -2499,51 +5135,71 @@ static  DNSc_STATUS  DNScCache_Resp (const  DNSc_CFG       *p_cfg,
         req_retry  = p_host->ReqCfgPtr->ReqRetry;
     }
 
+    if (p_host->ServerStatsIx < DNSc_CFG_STATS_SERVER_NBR_MAX) {
+        p_server = &DNScCache_ResolverStats.Servers[p_host->ServerStatsIx];
+    }
+
     status = DNScReq_RxResp(p_cfg, p_host, p_host->SockID, p_host->QueryID, p_err);
     switch (*p_err) {
         case DNSc_ERR_NONE:
+             ts_delta_ms = DNScTask_TS_Get_ms() - p_host->TS_ms;
+                                                                /* See Note #2.                                         */
+             switch (p_host->State) {
+                 case DNSc_STATE_RX_RESP_IPv4:
+                      qtype = DNSc_STATS_QTYPE_A;
+                      break;
+
+                 case DNSc_STATE_RX_RESP_IPv6:
+                      qtype = DNSc_STATS_QTYPE_AAAA;
+                      break;
+
+                 default:
+                      qtype = DNSc_STATS_QTYPE_PTR;
+                      break;
+             }
+             DNSc_StatsLatAdd(&DNScCache_ResolverStats.QTypeLat[qtype], ts_delta_ms);
+             if (p_server != DEF_NULL) {
+                 DNSc_StatsLatAdd(&p_server->Lat, ts_delta_ms);
+             }
+                                                                /* See Note #3.                                         */
+             p_server_if          = DNScCache_ServerIF_Get(p_host);
+             p_server_if->IF_Nbr  = p_host->IF_Nbr;
+             p_server_if->LinkGen = DNScCache_LinkGen;
              change_state = DEF_YES;
              break;
 
         case DNSc_ERR_RX:
+             ts_cur_ms   = DNScTask_TS_Get_ms();
+             ts_delta_ms = ts_cur_ms - p_host->TS_ms;
+             if (ts_delta_ms < timeout_ms) {                    /* Even the last req gets the full timeout.             */
+                 break;
+             }
+
+             DNScCache_ResolverStats.Timeouts++;
+             if (p_server != DEF_NULL) {
+                 p_server->Timeouts++;
+             }
+
              if (p_host->ReqCtr >= req_retry) {
-                                                                /* If reverse lookup, free resources obtained by... */
+                                                                /* If reverse lookup, clr addrs set by ...          */
                                                                 /* ...DNScCache_Resolve() if server is unresponsive.*/
-                 p_addr_item = p_host->AddrsFirstPtr;
-
-                 if (p_host->State == DNSc_STATE_RX_RESP_PTR_IPv4) {
-                     while (p_addr_item != DEF_NULL) {
-                         if (p_addr_item->AddrPtr->Len == NET_IPv4_ADDR_LEN) {
-                             DNScCache_AddrItemFree(p_addr_item);
-                         }
-                         p_addr_item = p_addr_item->NextPtr;
-                     }
+                 if ((p_host->State == DNSc_STATE_RX_RESP_PTR_IPv4) ||
+                     (p_host->State == DNSc_STATE_RX_RESP_PTR_IPv6)) {
+                     DNScCache_HostAddrClr(p_host);
                  }
 
-                 if (p_host->State == DNSc_STATE_RX_RESP_PTR_IPv6) {
-                     while (p_addr_item != DEF_NULL) {
-                         if (p_addr_item->AddrPtr->Len == NET_IPv6_ADDR_LEN) {
-                             DNScCache_AddrItemFree(p_addr_item);
-                         }
-                         p_addr_item = p_addr_item->NextPtr;
-                     }
-                 }
+                 p_server_if           = DNScCache_ServerIF_Get(p_host);
+                 p_server_if->IF_Nbr   = NET_IF_NBR_NONE;       /* See Note #3.                                         */
 
-                 p_host->AddrsFirstPtr = (void *)0;
                  status                = DNSc_STATUS_FAILED;
                  p_host->State         = DNSc_STATE_FAILED;
                 *p_err                 = DNSc_ERR_NO_SERVER;
 
                  goto exit;
-
-             } else {
-                 ts_cur_ms   = NetUtil_TS_Get_ms();
-                 ts_delta_ms = ts_cur_ms - p_host->TS_ms;
-                 if (ts_delta_ms >= timeout_ms) {
-                     re_tx        = DEF_YES;
-                     change_state = DEF_YES;
-                 }
              }
+
+             re_tx        = DEF_YES;
+             change_state = DEF_YES;
              break;
 
         default:
@@ -2569,13 +5225,18 @@ static  DNSc_STATUS  DNScCache_Resp (const  DNSc_CFG       *p_cfg,
                  if (re_tx == DEF_YES) {
                      p_host->State = DNSc_STATE_TX_REQ_IPv4;
                  } else {
-#ifdef  NET_IPv6_MODULE_EN
-                     p_host->ReqCtr = 0;
-                     p_host->State  = DNSc_STATE_TX_REQ_IPv6;
-                     status         = DNSc_STATUS_PENDING;
-#else
+                     DEF_BIT_SET(p_host->FamDone, DNSc_FAMILY_IPv4);
                      p_host->State = DNSc_STATE_RESOLVED;
                      status        = DNSc_STATUS_RESOLVED;
+#ifdef  NET_IPv6_MODULE_EN
+                     if ((DEF_BIT_IS_SET(p_host->FamReq,  DNSc_FAMILY_IPv6)) &&
+                         (DEF_BIT_IS_CLR(p_host->FamDone, DNSc_FAMILY_IPv6))) {
+                         p_host->ReqCtr       = 0;              /* See Note #5.                                         */
+                         p_host->State        = DNSc_STATE_TX_REQ_IPv6;
+                                                                /* See Note #4.                                         */
+                         p_host->PartialAvail = (p_host->AddrsIPv4Count > 0u) ? DEF_YES : DEF_NO;
+                         status               = DNSc_STATUS_PENDING;
+                     }
 #endif
                  }
                  break;
@@ -2590,6 +5251,7 @@ static  DNSc_STATUS  DNScCache_Resp (const  DNSc_CFG       *p_cfg,
                      status        = DNSc_STATUS_PENDING;       /* server using another link.                           */
 
                  } else {
+                     DEF_BIT_SET(p_host->FamDone, DNSc_FAMILY_IPv6);
                      p_host->State = DNSc_STATE_RESOLVED;
                      status        = DNSc_STATUS_RESOLVED;
                  }
@@ -2600,6 +5262,13 @@ static  DNSc_STATUS  DNScCache_Resp (const  DNSc_CFG       *p_cfg,
                 *p_err  = DNSc_ERR_FAULT;
                  goto exit;
         }
+
+        if (p_host->State == DNSc_STATE_RESOLVED) {             /* Start the entry's lifetime (see Note #1).            */
+            if (p_host->TTL_s < DNSc_CACHE_TTL_MIN_S) {
+                p_host->TTL_s = DNSc_CACHE_TTL_MIN_S;
+            }
+            p_host->TS_ms = DNScTask_TS_Get_ms();
+        }
     }
 
 
@@ -2607,3 +5276,289 @@ exit:
     return (status);
 }
 
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostDlyGet()
+*
+* Description : Get the time until the next event of a pending host.
+*
+* Argument(s) : p_cfg   Pointer to DNSc's configuration.
+*
+*               p_host  Pointer to the host object.
+*
+* Return(s)   : Time until the retransmission deadline of the last request, in milliseconds, if the host waits
+*               for a response; time until its server's rate allows a request, if the host has one to send; 0
+*               otherwise, the next step of the resolution being taken on the next pass. The request's overall
+*               deadline is returned instead if it is earlier.
+*
+* Caller(s)   : DNScCache_ResolveAll().
+*
+* Note(s)     : (1) The deadline is the one DNScCache_Resp() checks: .TS_ms plus the request's retry timeout.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+static  NET_TS_MS  DNScCache_HostDlyGet (const  DNSc_CFG       *p_cfg,
+                                         const  DNSc_HOST_OBJ  *p_host)
+{
+    NET_TS_MS  timeout_ms = (NET_TS_MS)p_cfg->ReqRetryTimeout_ms;
+    NET_TS_MS  ts_delta_ms;
+    NET_TS_MS  dly_ms;
+    NET_TS_MS  deadline_ms;
+
+
+    switch (p_host->State) {
+        case DNSc_STATE_RX_RESP_IPv4:
+        case DNSc_STATE_RX_RESP_IPv6:
+        case DNSc_STATE_RX_RESP_PTR_IPv4:
+        case DNSc_STATE_RX_RESP_PTR_IPv6:
+             if (p_host->ReqCfgPtr != DEF_NULL) {
+                 timeout_ms = p_host->ReqCfgPtr->ReqTimeout_ms;
+             }
+
+                                                                /* See Note #1.                                         */
+             ts_delta_ms = DNScTask_TS_Get_ms() - p_host->TS_ms;
+             dly_ms      = 0u;
+             if (ts_delta_ms < timeout_ms) {
+                 dly_ms = timeout_ms - ts_delta_ms;
+             }
+             break;
+
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)
+        case DNSc_STATE_TX_REQ_IPv4:
+        case DNSc_STATE_TX_REQ_IPv6:
+        case DNSc_STATE_TX_REQ_PTR_IPv4:
+        case DNSc_STATE_TX_REQ_PTR_IPv6:
+             dly_ms = DNScCache_ServerRateGet(p_host, DEF_NO);
+             if (dly_ms == 0u) {
+                 return (0u);
+             }
+             break;
+#endif
+
+        default:
+             return (0u);
+    }
+
+    if ((DNScCache_HostDeadlineGet(p_host, &deadline_ms) == DEF_YES) &&
+        (deadline_ms < dly_ms)) {
+        dly_ms = deadline_ms;
+    }
+
+    return (dly_ms);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       DNScCache_ServerRateGet()
+*
+* Description : Check whether the server of a host can be sent a request, & optionally take its token.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+*               take    DEF_YES, to take a token from the server's bucket if one is available,
+*                       DEF_NO,  to only check.
+*
+* Return(s)   : 0, if a request can be sent now,
+*
+*               Time until the server's bucket holds a token, in milliseconds, otherwise.
+*
+* Caller(s)   : DNScCache_HostDlyGet(),
+*               DNScCache_Resolve().
+*
+* Note(s)     : (1) See 'SERVER RATE DATA TYPE' Note #1. The bucket is refilled from the time elapsed since its
+*                   last refill; a refill over one second or more fills it.
+*
+*               (2) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+#if (DNSc_CFG_REQ_SERVER_QPS_MAX > 0u)
+static  NET_TS_MS  DNScCache_ServerRateGet (const  DNSc_HOST_OBJ  *p_host,
+                                                   CPU_BOOLEAN     take)
+{
+    DNSc_CACHE_SERVER_RATE  *p_rate;
+    NET_TS_MS                ts_cur_ms;
+    NET_TS_MS                ts_delta_ms;
+    CPU_INT32U               tokens;
+
+
+    p_rate      = &DNScCache_ServerRateTbl[DEF_MIN(p_host->ServerStatsIx, DNSc_CFG_STATS_SERVER_NBR_MAX)];
+    ts_cur_ms   =  DNScTask_TS_Get_ms();
+    ts_delta_ms =  ts_cur_ms - p_rate->TS_ms;
+                                                                /* See Note #1.                                         */
+    if (ts_delta_ms >= DNSc_CACHE_SERVER_RATE_TOKEN) {
+        tokens = DNSc_CACHE_SERVER_RATE_TOKEN_MAX;
+    } else {
+        tokens = p_rate->Tokens + (ts_delta_ms * DNSc_CFG_REQ_SERVER_QPS_MAX);
+        tokens = DEF_MIN(tokens, DNSc_CACHE_SERVER_RATE_TOKEN_MAX);
+    }
+
+    if (tokens < DNSc_CACHE_SERVER_RATE_TOKEN) {                /* Round up, so that the bucket holds a token by then.  */
+        return ((DNSc_CACHE_SERVER_RATE_TOKEN - tokens + DNSc_CFG_REQ_SERVER_QPS_MAX - 1u) / DNSc_CFG_REQ_SERVER_QPS_MAX);
+    }
+
+    if (take == DEF_YES) {
+        p_rate->TS_ms  = ts_cur_ms;
+        p_rate->Tokens = tokens - DNSc_CACHE_SERVER_RATE_TOKEN;
+    }
+
+    return (0u);
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                       DNScCache_ServerIF_Get()
+*
+* Description : Get the interface record of a host's server.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : Pointer to the server's interface record.
+*
+* Caller(s)   : DNScCache_Resolve(),
+*               DNScCache_Resp().
+*
+* Note(s)     : (1) See 'SERVER INTERFACE DATA TYPE' Note #3.
+*
+*               (2) The cache lock MUST be held by the caller.
+*********************************************************************************************************
+*/
+
+static  DNSc_CACHE_SERVER_IF  *DNScCache_ServerIF_Get (const  DNSc_HOST_OBJ  *p_host)
+{
+    return (&DNScCache_ServerIF_Tbl[DEF_MIN(p_host->ServerStatsIx, DNSc_CFG_STATS_SERVER_NBR_MAX)]);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScCache_HostAbort()
+*
+* Description : Stop the resolution of a pending host & mark it failed.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostCancel(),
+*               DNScCache_Resolve().
+*
+* Note(s)     : (1) The request's socket is closed right away, & its query ID dropped, so that a late response
+*                   is never matched to the host.
+*
+*               (2) As in DNScCache_Resp(), the addr set by DNScCache_Resolve() for a reverse lookup is cleared.
+*
+*               (3) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+static  void  DNScCache_HostAbort (DNSc_HOST_OBJ  *p_host)
+{
+    switch (p_host->State) {
+        case DNSc_STATE_RX_RESP_PTR_IPv4:                       /* See Note #2.                                         */
+        case DNSc_STATE_RX_RESP_PTR_IPv6:
+             DNScCache_HostAddrClr(p_host);
+             break;
+
+        default:
+             break;
+    }
+
+    if (p_host->SockID != NET_SOCK_ID_NONE) {                   /* See Note #1.                                         */
+        DNSc_ReqClose(p_host->SockID);
+        p_host->SockID = NET_SOCK_ID_NONE;
+    }
+
+    DNScCache_QueryIxRemove(p_host);
+    p_host->State   = DNSc_STATE_FAILED;
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScCache_HostSignal()
+*
+* Description : Release the blocking caller of a host, if any.
+*
+* Argument(s) : p_host  Pointer to the host object.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScCache_HostCancel(),
+*               DNScCache_ResolveAll().
+*
+* Note(s)     : (1) The semaphore is handed over to the caller, which deletes it (see 'dns-c_task.c
+*                   DNScTask_HostResolve()'): the host no longer references it, so that it is posted once even
+*                   if the host is signaled again, e.g. once partially & once completed.
+*
+*               (2) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+static  void  DNScCache_HostSignal (DNSc_HOST_OBJ  *p_host)
+{
+    KAL_ERR  kal_err;
+
+
+    if (KAL_SEM_HANDLE_IS_NULL(p_host->TaskSignal) != DEF_YES) {
+        KAL_SemPost(p_host->TaskSignal, KAL_OPT_NONE, &kal_err);
+        p_host->TaskSignal = KAL_SemHandleNull;                 /* See Note #1.                                         */
+    }
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                      DNScCache_HostDeadlineGet()
+*
+* Description : Get the time left before the overall deadline of a host's request.
+*
+* Argument(s) : p_host      Pointer to the host object.
+*
+*               p_dly_ms    Pointer to variable that will receive the time left, in milliseconds; 0 if the deadline
+*                           has passed.
+*
+* Return(s)   : DEF_YES, if the request has a deadline,
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNScCache_HostDlyGet(),
+*               DNScCache_Resolve().
+*
+* Note(s)     : (1) The deadline runs from the time the request was issued by DNSc_GetHost() (see
+*                   DNScCache_HostObjGet()), over every retry & interface.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DNScCache_HostDeadlineGet (const  DNSc_HOST_OBJ  *p_host,
+                                                       NET_TS_MS      *p_dly_ms)
+{
+    NET_TS_MS  deadline_ms;
+    NET_TS_MS  ts_delta_ms;
+
+
+   *p_dly_ms = 0u;
+
+    if (p_host->ReqCfgPtr == DEF_NULL) {
+        return (DEF_NO);
+    }
+
+    deadline_ms = p_host->ReqCfgPtr->ReqDeadline_ms;
+    if (deadline_ms == 0u) {
+        return (DEF_NO);
+    }
+
+    ts_delta_ms = DNScTask_TS_Get_ms() - p_host->ReqTS_ms;      /* See Note #1.                                         */
+    if (ts_delta_ms < deadline_ms) {
+       *p_dly_ms = deadline_ms - ts_delta_ms;
+    }
+
+    return (DEF_YES);
+}
@@ -56,6 +56,53 @@
 #include  "dns-c.h"
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                          NAME WORD DEFINES
+*
+* Note(s) : (1) Host names are scanned one 64-bit word (8 characters) at a time, in aligned words & only
+*               within the known length of the name. Each macro sets bit 7 of the word's octets that match,
+*               & is 0 if no octet matches; only the lowest matching octet in memory order is exact, so a
+*               word that matches is scanned again per octet.
+*
+*           (2) DNSc_NAME_WORD_GET() reads a word octet by octet, the first octet of the name in the lowest
+*               octet of the word, so that the name is never accessed through a CPU_INT64U pointer. Compilers
+*               merge these reads in a single load.
+*
+*           (3) DNSc_NAME_WORD_HAS_LESS() is valid for a bound up to 0x80. DNSc_NAME_WORD_TO_LOWER() folds
+*               the octets 'A' to 'Z' only, & leaves the octets above 0x7F unchanged.
+*********************************************************************************************************
+*/
+
+#define  DNSc_NAME_WORD_SIZE                        sizeof(CPU_INT64U)
+#define  DNSc_NAME_WORD_ONES                        0x0101010101010101uLL
+#define  DNSc_NAME_WORD_HIGHS                       0x8080808080808080uLL
+
+#define  DNSc_NAME_WORD_IS_ALIGNED(p)             ((((CPU_ADDR)(p)) & (DNSc_NAME_WORD_SIZE - 1u)) == 0u)
+
+#define  DNSc_NAME_WORD_OCTET(p, n)               ((CPU_INT64U)((const CPU_INT08U *)(p))[n] << ((n) * DEF_OCTET_NBR_BITS))
+#define  DNSc_NAME_WORD_GET(p)                    (DNSc_NAME_WORD_OCTET((p), 0u) | DNSc_NAME_WORD_OCTET((p), 1u) | \
+                                                   DNSc_NAME_WORD_OCTET((p), 2u) | DNSc_NAME_WORD_OCTET((p), 3u) | \
+                                                   DNSc_NAME_WORD_OCTET((p), 4u) | DNSc_NAME_WORD_OCTET((p), 5u) | \
+                                                   DNSc_NAME_WORD_OCTET((p), 6u) | DNSc_NAME_WORD_OCTET((p), 7u))
+
+#define  DNSc_NAME_WORD_HAS_LESS(w, n)            ((((w) - (DNSc_NAME_WORD_ONES * (n))) & ~(w)) & DNSc_NAME_WORD_HIGHS)
+#define  DNSc_NAME_WORD_HAS_ZERO(w)                 DNSc_NAME_WORD_HAS_LESS((w), 1u)
+#define  DNSc_NAME_WORD_HAS_CHAR(w, c)              DNSc_NAME_WORD_HAS_ZERO((w) ^ (DNSc_NAME_WORD_ONES * (CPU_INT08U)(c)))
+
+#define  DNSc_NAME_WORD_TO_LOWER(w)               ((w) | ((((((w) & ~DNSc_NAME_WORD_HIGHS) + (DNSc_NAME_WORD_ONES * 0x3Fu))  & \
+                                                          ~(((w) & ~DNSc_NAME_WORD_HIGHS) + (DNSc_NAME_WORD_ONES * 0x25u))) & \
+                                                          ~(w) & DNSc_NAME_WORD_HIGHS) >> 2u))
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -93,6 +140,39 @@ void            DNScCache_HostRemove    (       DNSc_HOST_OBJ   *p_host);
 void            DNScCache_HostSrchRemove(const  CPU_CHAR        *p_host_name,
                                                 DNSc_ERR        *p_err);
 
+#ifdef  DNSc_TASK_MODULE_EN
+void            DNScCache_HostCancel    (const  CPU_CHAR        *p_host_name,
+                                                DNSc_ERR        *p_err);
+#endif
+
+void            DNScCache_StatsGet      (       DNSc_CACHE_STATS *p_stats,
+                                                DNSc_ERR        *p_err);
+
+void            DNScCache_StatsReset    (       DNSc_ERR        *p_err);
+
+void            DNScCache_ResolverStatsGet(     DNSc_RESOLVER_STATS *p_stats,
+                                                DNSc_ERR        *p_err);
+
+void            DNScCache_ResolverStatsReset(   DNSc_ERR        *p_err);
+
+void            DNScCache_EntryGet      (       CPU_INT16U       ix,
+                                                CPU_CHAR        *p_name,
+                                                CPU_INT16U       name_len_max,
+                                                DNSc_STATE      *p_state,
+                                                CPU_INT32U      *p_ttl_ms,
+                                                DNSc_ADDR_OBJ   *p_addrs,
+                                                CPU_INT08U      *p_addr_nbr,
+                                                DNSc_ERR        *p_err);
+
+void            DNScCache_Export        (       CPU_INT08U      *p_buf,
+                                                CPU_SIZE_T       buf_len,
+                                                CPU_SIZE_T      *p_len_rtn,
+                                                DNSc_ERR        *p_err);
+
+void            DNScCache_Import        (const  CPU_INT08U      *p_buf,
+                                                CPU_SIZE_T       buf_len,
+                                                DNSc_ERR        *p_err);
+
 DNSc_STATUS     DNScCache_Srch          (const  CPU_CHAR        *p_host_name,
                                                 DNSc_HOST_OBJ  **p_host_obj,
                                                 DNSc_ADDR_OBJ   *p_addrs,
@@ -101,22 +181,34 @@ DNSc_STATUS     DNScCache_Srch          (const  CPU_CHAR        *p_host_name,
                                                 DNSc_FLAGS       flags,
                                                 DNSc_ERR        *p_err);
 
+CPU_BOOLEAN     DNScCache_FrontSrch     (const  CPU_CHAR        *p_host_name,
+                                                DNSc_ADDR_OBJ   *p_addrs,
+                                                CPU_INT08U       addr_nbr_max,
+                                                CPU_INT08U      *p_addr_nbr_rtn,
+                                                DNSc_FLAGS       flags);
+
 DNSc_HOST_OBJ  *DNScCache_HostObjGet    (const  CPU_CHAR        *p_host_name,
                                                 DNSc_FLAGS       flags,
                                                 DNSc_REQ_CFG    *p_cfg,
+                                                CPU_BOOLEAN     *p_reused,
                                                 DNSc_ERR        *p_err);
 
 void            DNScCache_HostObjFree   (       DNSc_HOST_OBJ   *p_host);
 
 void            DNScCache_HostAddrInsert(const  DNSc_CFG        *p_cfg,
                                                 DNSc_HOST_OBJ   *p_host,
-                                                DNSc_ADDR_OBJ   *p_addr,
-                                                CPU_BOOLEAN      is_reverse,
+                                         const  DNSc_ADDR_OBJ   *p_addr,
                                                 DNSc_ERR        *p_err);
 
-DNSc_ADDR_OBJ  *DNScCache_AddrObjGet    (       DNSc_ERR        *p_err);
+CPU_INT32U      DNScCache_NameHash      (const  CPU_CHAR        *p_name,
+                                                CPU_INT16U       len_max,
+                                                CPU_INT16U      *p_len);
+
+CPU_BOOLEAN     DNScCache_NameCmp       (const  CPU_CHAR        *p_name_1,
+                                         const  CPU_CHAR        *p_name_2,
+                                                CPU_INT16U       len);
 
-void            DNScCache_AddrObjFree   (       DNSc_ADDR_OBJ   *p_addr);
+DNSc_HOST_OBJ  *DNScCache_QueryIxSrch   (       CPU_INT16U       query_id);
 
 void            DNScCache_AddrObjSet    (       DNSc_ADDR_OBJ   *p_addr,
                                                 CPU_CHAR        *p_str_addr,
@@ -126,7 +218,14 @@ DNSc_STATUS     DNScCache_ResolveHost   (const  DNSc_CFG        *p_cfg,
                                                 DNSc_HOST_OBJ   *p_host,
                                                 DNSc_ERR        *p_err);
 
+#ifdef  DNSc_TASK_MODULE_EN
+void            DNScCache_HostPendInsert(       DNSc_HOST_OBJ   *p_host,
+                                                DNSc_ERR        *p_err);
+
 CPU_INT16U      DNScCache_ResolveAll    (const  DNSc_CFG        *p_cfg,
+                                                CPU_INT08U       worker_ix,
+                                                NET_TS_MS       *p_dly_ms,
                                                 DNSc_ERR        *p_err);
+#endif
 
 #endif /* DNSc_CACHE_PRESENT */
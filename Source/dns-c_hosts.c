@@ -0,0 +1,543 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      DNS CLIENT STATIC HOSTS MODULE
+*
+* Filename : dns-c_hosts.c
+* Version  : V2.02.00
+*********************************************************************************************************
+* Note(s)  : (1) This file implements a static table of host names & addresses that is searched before
+*                the cache & the DNS server(s). The table is built once by DNSc_Init() from DNSc's
+*                configuration & is never modified afterwards, so it can be searched without any lock.
+*
+*            (2) Assumes the following versions (or more recent) of software modules are included
+*                in the project build :
+*
+*                (a) uC/LIB    V1.37
+*                (b) uC/TCPIP  V3.00.00
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "dns-c_hosts.h"
+#include  "dns-c_cache.h"
+#include  <Source/net_ascii.h>
+#include  <lib_mem.h>
+#include  <lib_str.h>
+#include  <lib_ascii.h>
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                              DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                     STATIC HOST ENTRY DATA TYPE
+*
+* Note(s) : (1) Every name/address pair is stored in its own entry. A name that has several addresses has
+*               one entry per address, all linked in the same bucket in configuration order.
+*
+*           (2) .NamePtr points directly to the name in DNSc's configuration & is NOT NULL terminated when
+*               the name comes from the hosts file, .NameLen MUST be used to delimit it.
+*********************************************************************************************************
+*/
+
+typedef  struct  dnsc_hosts_entry  DNSc_HOSTS_ENTRY;
+
+struct  dnsc_hosts_entry {
+    const  CPU_CHAR          *NamePtr;                          /* See Note #2.                                         */
+           CPU_INT16U         NameLen;
+           CPU_INT32U         NameHash;                         /* Case-folded hash of the name.                        */
+           DNSc_ADDR_OBJ      Addr;
+           DNSc_HOSTS_ENTRY  *NextPtr;                          /* Next entry in the same bucket.                       */
+};
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                       LOCAL GLOBAL VARIABLES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  DNSc_HOSTS_ENTRY   *DNScHosts_EntryTbl;
+static  CPU_INT16U          DNScHosts_EntryNbr;
+
+static  DNSc_HOSTS_ENTRY  **DNScHosts_BucketTbl;
+static  CPU_INT16U          DNScHosts_BucketMask;
+
+static  CPU_INT16U          DNScHosts_NameLenMax;
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U   DNScHosts_FileParse(const  CPU_CHAR       *p_file,
+                                                CPU_BOOLEAN     add);
+
+static  CPU_BOOLEAN  DNScHosts_AddrParse(const  CPU_CHAR       *p_str,
+                                                CPU_SIZE_T      len,
+                                                DNSc_ADDR_OBJ  *p_addr);
+
+static  void         DNScHosts_EntryAdd (const  CPU_CHAR       *p_name,
+                                                CPU_INT16U      name_len,
+                                                CPU_INT32U      name_hash,
+                                         const  DNSc_ADDR_OBJ  *p_addr);
+
+
+/*
+*********************************************************************************************************
+*                                           DNScHosts_Init()
+*
+* Description : Build the static hosts table from DNSc's configuration.
+*
+* Argument(s) : p_cfg   Pointer to DNSc's configuration.
+*
+*               p_err   Pointer to variable that will receive the return error code from this function :
+*
+*                           DNSc_ERR_NONE           Static hosts table successfully built.
+*                           DNSc_ERR_MEM_ALLOC      Memory allocation error.
+*                           DNSc_ERR_INVALID_CFG    Invalid entry in the configured hosts array.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNSc_Init().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Entries of the configured hosts array MUST all be valid. Lines of the hosts file that
+*                   can't be parsed are ignored, as a system resolver would do.
+*
+*               (2) The hosts file is parsed twice: once to count the entries to allocate, once to fill them.
+*
+*               (3) The bucket table is sized to the next power of 2 that is at least the number of entries.
+*********************************************************************************************************
+*/
+
+void  DNScHosts_Init (const  DNSc_CFG  *p_cfg,
+                             DNSc_ERR  *p_err)
+{
+    DNSc_CFG_HOST  *p_cfg_host;
+    DNSc_ADDR_OBJ   addr;
+    CPU_INT16U      entry_nbr;
+    CPU_INT16U      bucket_nbr;
+    CPU_INT16U      name_len;
+    CPU_INT32U      name_hash;
+    CPU_SIZE_T      len;
+    CPU_BOOLEAN     valid;
+    CPU_INT16U      i;
+    LIB_ERR         err;
+
+
+    DNScHosts_EntryTbl   = DEF_NULL;
+    DNScHosts_EntryNbr   = 0u;
+    DNScHosts_BucketTbl  = DEF_NULL;
+    DNScHosts_BucketMask = 0u;
+    DNScHosts_NameLenMax = p_cfg->HostNameLenMax;
+
+    entry_nbr = 0u;
+    if (p_cfg->HostsTblPtr != DEF_NULL) {
+        entry_nbr = p_cfg->HostsTblNbr;
+    }
+    if (p_cfg->HostsFilePtr != DEF_NULL) {                      /* See Note #2.                                         */
+        entry_nbr += DNScHosts_FileParse(p_cfg->HostsFilePtr, DEF_NO);
+    }
+
+    if (entry_nbr == 0u) {                                      /* No static host.                                      */
+       *p_err = DNSc_ERR_NONE;
+        goto exit;
+    }
+
+    bucket_nbr = 1u;                                            /* See Note #3.                                         */
+    while (bucket_nbr < entry_nbr) {
+        bucket_nbr <<= 1u;
+    }
+
+    DNScHosts_EntryTbl = (DNSc_HOSTS_ENTRY *)Mem_SegAlloc("DNSc Hosts Entries",
+                                                           p_cfg->MemSegPtr,
+                                                          (entry_nbr * sizeof(DNSc_HOSTS_ENTRY)),
+                                                          &err);
+    if (err != LIB_MEM_ERR_NONE) {
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+
+    DNScHosts_BucketTbl = (DNSc_HOSTS_ENTRY **)Mem_SegAlloc("DNSc Hosts Buckets",
+                                                             p_cfg->MemSegPtr,
+                                                            (bucket_nbr * sizeof(DNSc_HOSTS_ENTRY *)),
+                                                            &err);
+    if (err != LIB_MEM_ERR_NONE) {
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
+
+    for (i = 0u; i < bucket_nbr; i++) {
+        DNScHosts_BucketTbl[i] = DEF_NULL;
+    }
+    DNScHosts_BucketMask = bucket_nbr - 1u;
+
+                                                                /* ---------------- ADD CFG'D HOSTS ------------------- */
+    if (p_cfg->HostsTblPtr != DEF_NULL) {
+        for (i = 0u; i < p_cfg->HostsTblNbr; i++) {
+            p_cfg_host = &p_cfg->HostsTblPtr[i];
+            if ((p_cfg_host->NamePtr == DEF_NULL) ||            /* See Note #1.                                         */
+                (p_cfg_host->AddrPtr == DEF_NULL)) {
+               *p_err = DNSc_ERR_INVALID_CFG;
+                goto exit;
+            }
+
+            name_hash = DNScCache_NameHash(p_cfg_host->NamePtr, DNScHosts_NameLenMax, &name_len);
+            len       = Str_Len_N(p_cfg_host->AddrPtr, NET_ASCII_LEN_MAX_ADDR_IP + 1u);
+            valid     = DNScHosts_AddrParse(p_cfg_host->AddrPtr, len, &addr);
+            if ((name_len == 0u)     ||
+                (valid    == DEF_NO)) {
+               *p_err = DNSc_ERR_INVALID_CFG;
+                goto exit;
+            }
+
+            DNScHosts_EntryAdd(p_cfg_host->NamePtr, name_len, name_hash, &addr);
+        }
+    }
+
+                                                                /* ------------------ ADD FILE HOSTS ------------------ */
+    if (p_cfg->HostsFilePtr != DEF_NULL) {
+       (void)DNScHosts_FileParse(p_cfg->HostsFilePtr, DEF_YES);
+    }
+
+   *p_err = DNSc_ERR_NONE;
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DNScHosts_Srch()
+*
+* Description : Search host in the static hosts table and return its IP addresses, if found.
+*
+* Argument(s) : p_host_name         Pointer to a string that contains the host name.
+*
+*               p_addrs             Pointer to addresses array.
+*
+*               addr_nbr_max        Number of address the address array can contain.
+*
+*               p_addr_nbr_rtn      Pointer to a variable that will receive number of addresses copied; left
+*                                   unchanged if the host is not found.
+*
+*               flags               DNS client flag:
+*
+*                                       DNSc_FLAG_NONE              By default all IP address can be returned.
+*                                       DNSc_FLAG_IPv4_ONLY         Return only IPv4 address(es).
+*                                       DNSc_FLAG_IPv6_ONLY         Return only IPv6 address(es).
+*
+* Return(s)   : DEF_YES, if at least one address was copied.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNSc_GetHost().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The table is never modified after DNScHosts_Init(), no lock is required.
+*
+*               (2) A static host that has no address of the requested family is not found, so that the
+*                   request can be resolved by the cache or the DNS server.
+*********************************************************************************************************
+*/
+
+CPU_BOOLEAN  DNScHosts_Srch (const  CPU_CHAR       *p_host_name,
+                                    DNSc_ADDR_OBJ  *p_addrs,
+                                    CPU_INT08U      addr_nbr_max,
+                                    CPU_INT08U     *p_addr_nbr_rtn,
+                                    DNSc_FLAGS      flags)
+{
+    DNSc_HOSTS_ENTRY  *p_entry;
+    CPU_INT32U         name_hash;
+    CPU_INT16U         name_len;
+    CPU_INT08U         addr_nbr = 0u;
+    CPU_BOOLEAN        no_ipv4  = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv6_ONLY);
+    CPU_BOOLEAN        no_ipv6  = DEF_BIT_IS_SET(flags, DNSc_FLAG_IPv4_ONLY);
+    CPU_BOOLEAN        match;
+
+
+    if (DNScHosts_EntryNbr == 0u) {
+        goto exit;
+    }
+
+    name_hash = DNScCache_NameHash(p_host_name, DNScHosts_NameLenMax, &name_len);
+    p_entry   = DNScHosts_BucketTbl[name_hash & DNScHosts_BucketMask];
+
+    while ((p_entry  != DEF_NULL) &&
+           (addr_nbr <  addr_nbr_max)) {
+        if ((p_entry->NameHash == name_hash) &&
+            (p_entry->NameLen  == name_len)) {
+            match = DNScCache_NameCmp(p_entry->NamePtr, p_host_name, name_len);
+            if (match == DEF_YES) {
+                if (((p_entry->Addr.Len == NET_IPv4_ADDR_LEN) && (no_ipv4 == DEF_NO)) ||
+                    ((p_entry->Addr.Len == NET_IPv6_ADDR_LEN) && (no_ipv6 == DEF_NO))) {
+                    p_addrs[addr_nbr] = p_entry->Addr;          /* See Note #2.                                         */
+                    addr_nbr++;
+                }
+            }
+        }
+        p_entry = p_entry->NextPtr;
+    }
+
+    if (addr_nbr > 0u) {                                        /* Caller passes the addr tbl size on to the cache.     */
+       *p_addr_nbr_rtn = addr_nbr;
+    }
+
+exit:
+    return ((addr_nbr > 0u) ? DEF_YES : DEF_NO);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                           LOCAL FUNCTIONS
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*                                        DNScHosts_FileParse()
+*
+* Description : Parse a string in hosts file format and optionally add its entries to the table.
+*
+* Argument(s) : p_file  Pointer to a NULL terminated string that contains the hosts file.
+*
+*               add     DEF_YES, to add each parsed entry to the table.
+*                       DEF_NO,  to only count the entries.
+*
+* Return(s)   : Number of name/address pairs found.
+*
+* Caller(s)   : DNScHosts_Init().
+*
+* Note(s)     : (1) Each line contains an address followed by one or more names, separated by spaces or tabs.
+*                   Text following a '#' up to the end of the line is a comment.
+*
+*               (2) Lines whose address can't be parsed & names that are longer than the maximum host name
+*                   length are ignored.
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DNScHosts_FileParse (const  CPU_CHAR     *p_file,
+                                                CPU_BOOLEAN   add)
+{
+    const  CPU_CHAR       *p_char = p_file;
+    const  CPU_CHAR       *p_tok;
+           DNSc_ADDR_OBJ   addr;
+           CPU_SIZE_T      len;
+           CPU_INT16U      name_len;
+           CPU_INT32U      name_hash;
+           CPU_INT16U      entry_nbr = 0u;
+           CPU_BOOLEAN     valid;
+
+
+    while (*p_char != ASCII_CHAR_NULL) {
+                                                                /* ------------------- PARSE ADDR --------------------- */
+        while ((*p_char == ASCII_CHAR_SPACE) ||
+               (*p_char == ASCII_CHAR_CHARACTER_TABULATION)) {
+            p_char++;
+        }
+
+        p_tok = p_char;
+        while ((*p_char != ASCII_CHAR_NULL)                 &&
+               (*p_char != ASCII_CHAR_NUMBER_SIGN)          &&
+               (*p_char != ASCII_CHAR_LINE_FEED)            &&
+               (ASCII_IsSpace(*p_char) == DEF_NO)) {
+            p_char++;
+        }
+        len   = (CPU_SIZE_T)(p_char - p_tok);
+        valid = DEF_NO;
+        if (len > 0u) {
+            valid = DNScHosts_AddrParse(p_tok, len, &addr);
+        }
+
+                                                                /* ------------------- PARSE NAMES -------------------- */
+        while ((*p_char != ASCII_CHAR_NULL)        &&
+               (*p_char != ASCII_CHAR_NUMBER_SIGN) &&
+               (*p_char != ASCII_CHAR_LINE_FEED)) {
+            if (ASCII_IsSpace(*p_char) == DEF_YES) {
+                p_char++;
+                continue;
+            }
+
+            p_tok = p_char;
+            while ((*p_char != ASCII_CHAR_NULL)        &&
+                   (*p_char != ASCII_CHAR_NUMBER_SIGN) &&
+                   (ASCII_IsSpace(*p_char) == DEF_NO)) {
+                p_char++;
+            }
+            len = (CPU_SIZE_T)(p_char - p_tok);
+
+            if ((valid == DEF_YES) &&                           /* See Note #2.                                         */
+                (len   <= DNScHosts_NameLenMax)) {
+                if (add == DEF_YES) {
+                    name_hash = DNScCache_NameHash(p_tok, (CPU_INT16U)len, &name_len);
+                    DNScHosts_EntryAdd(p_tok, name_len, name_hash, &addr);
+                }
+                entry_nbr++;
+            }
+        }
+
+                                                                /* ------------------ SKIP TO NEXT LINE --------------- */
+        while ((*p_char != ASCII_CHAR_NULL) &&
+               (*p_char != ASCII_CHAR_LINE_FEED)) {
+            p_char++;
+        }
+        if (*p_char == ASCII_CHAR_LINE_FEED) {
+            p_char++;
+        }
+    }
+
+    return (entry_nbr);
+}
+
+
+/*
+*********************************************************************************************************
+*                                        DNScHosts_AddrParse()
+*
+* Description : Convert the string representation of an IP address to an address object.
+*
+* Argument(s) : p_str   Pointer to the string that contains the address, not necessarily NULL terminated.
+*
+*               len     Length of the address string.
+*
+*               p_addr  Pointer to the address object that will receive the address.
+*
+* Return(s)   : DEF_YES, if the address is valid.
+*
+*               DEF_NO,  otherwise.
+*
+* Caller(s)   : DNScHosts_FileParse(),
+*               DNScHosts_Init().
+*
+* Note(s)     : (1) IPv6 addresses can't be stored when IPv6 is not enabled, they are reported as invalid.
+*********************************************************************************************************
+*/
+
+static  CPU_BOOLEAN  DNScHosts_AddrParse (const  CPU_CHAR       *p_str,
+                                                 CPU_SIZE_T      len,
+                                                 DNSc_ADDR_OBJ  *p_addr)
+{
+    CPU_CHAR            addr_str[NET_ASCII_LEN_MAX_ADDR_IP + 1u];
+    NET_IP_ADDR_FAMILY  ip_family;
+    CPU_BOOLEAN         valid = DEF_NO;
+    NET_ERR             err;
+
+
+    if (len > NET_ASCII_LEN_MAX_ADDR_IP) {
+        goto exit;
+    }
+
+    Mem_Copy(addr_str, p_str, len);
+    addr_str[len] = ASCII_CHAR_NULL;
+
+    ip_family = NetASCII_Str_to_IP(addr_str,                    /* See Note #1.                                         */
+                                   p_addr->Addr,
+                                   sizeof(p_addr->Addr),
+                                  &err);
+    if (err != NET_ASCII_ERR_NONE) {
+        goto exit;
+    }
+
+    p_addr->Len          = (ip_family == NET_IP_ADDR_FAMILY_IPv4) ?
+                            NET_IPv4_ADDR_LEN                     :
+                            NET_IPv6_ADDR_LEN;
+    p_addr->RevPreferred = DEF_NO;
+    valid                = DEF_YES;
+
+exit:
+    return (valid);
+}
+
+
+/*
+*********************************************************************************************************
+*                                         DNScHosts_EntryAdd()
+*
+* Description : Add a name/address pair to the static hosts table.
+*
+* Argument(s) : p_name      Pointer to the host name.
+*
+*               name_len    Length of the host name.
+*
+*               name_hash   Hash of the host name, as returned by DNScCache_NameHash().
+*
+*               p_addr      Pointer to the address of the host.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScHosts_FileParse(),
+*               DNScHosts_Init().
+*
+* Note(s)     : (1) The entry is linked at the end of its bucket so that the addresses of a host are returned
+*                   in configuration order.
+*********************************************************************************************************
+*/
+
+static  void  DNScHosts_EntryAdd (const  CPU_CHAR       *p_name,
+                                         CPU_INT16U      name_len,
+                                         CPU_INT32U      name_hash,
+                                  const  DNSc_ADDR_OBJ  *p_addr)
+{
+    DNSc_HOSTS_ENTRY   *p_entry;
+    DNSc_HOSTS_ENTRY  **p_link;
+
+
+    p_entry           = &DNScHosts_EntryTbl[DNScHosts_EntryNbr];
+    p_entry->NamePtr  =  p_name;
+    p_entry->NameLen  =  name_len;
+    p_entry->NameHash =  name_hash;
+    p_entry->Addr     = *p_addr;
+    p_entry->NextPtr  =  DEF_NULL;
+
+    p_link = &DNScHosts_BucketTbl[name_hash & DNScHosts_BucketMask];
+    while (*p_link != DEF_NULL) {                               /* See Note #1.                                         */
+        p_link = &(*p_link)->NextPtr;
+    }
+   *p_link = p_entry;
+
+    DNScHosts_EntryNbr++;
+}
@@ -0,0 +1,67 @@
+/*
+*********************************************************************************************************
+*                                               uC/DNSc
+*                                     Domain Name Server (client)
+*
+*                    Copyright 2004-2020 Silicon Laboratories Inc. www.silabs.com
+*
+*                                 SPDX-License-Identifier: APACHE-2.0
+*
+*               This software is subject to an open source license and is distributed by
+*                Silicon Laboratories Inc. pursuant to the terms of the Apache License,
+*                    Version 2.0 available at www.apache.org/licenses/LICENSE-2.0.
+*
+*********************************************************************************************************
+*/
+
+/*
+*********************************************************************************************************
+*
+*                                      DNS CLIENT STATIC HOSTS MODULE
+*
+* Filename : dns-c_hosts.h
+* Version  : V2.02.00
+*********************************************************************************************************
+*/
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               MODULE
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifndef  DNSc_HOSTS_PRESENT
+#define  DNSc_HOSTS_PRESENT
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                            INCLUDE FILES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#include  "dns-c.h"
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                         FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+void         DNScHosts_Init(const  DNSc_CFG       *p_cfg,
+                                   DNSc_ERR       *p_err);
+
+CPU_BOOLEAN  DNScHosts_Srch(const  CPU_CHAR       *p_host_name,
+                                   DNSc_ADDR_OBJ  *p_addrs,
+                                   CPU_INT08U      addr_nbr_max,
+                                   CPU_INT08U     *p_addr_nbr_rtn,
+                                   DNSc_FLAGS      flags);
+
+#endif  /* DNSc_HOSTS_PRESENT */
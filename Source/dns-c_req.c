@@ -56,6 +56,7 @@
 
 #include  "dns-c_req.h"
 #include  "dns-c_cache.h"
+#include  "dns-c_task.h"
 
 #include  <Source/net_cfg_net.h>
 
@@ -103,6 +104,12 @@
 #define  DNSc_SOCK_TX_RETRY_MAX                            5u
 #define  DNSc_SOCK_TX_DLY_MS                              10u
 
+#define  DNSc_PORT_RANDOM_MIN                          49152u   /* Dynamic port range (see RFC #6335, Section 6).       */
+#define  DNSc_PORT_RANDOM_NBR                          16384u
+#define  DNSc_PORT_RANDOM_BIND_RETRY_MAX                   4u   /* See DNScReq_Init() Note #1.                          */
+
+#define  DNSc_RAND_SEED                           0x9E3779B9u   /* See DNScReq_RandGet() Note #1.                       */
+
 /*
 *********************************************************************************************************
 *                                           DNS TYPE DEFINE
@@ -257,8 +264,8 @@ typedef  struct  DNSc_query_info {
 *********************************************************************************************************
 */
 
-static  CPU_INT16U   DNSc_QueryID = 1u;
 static  DNSc_SERVER  DNSc_ServerAddr;
+static  CPU_INT32U   DNScReq_RandState;                         /* See DNScReq_RandGet().                               */
 
 
 /*
@@ -269,13 +276,6 @@ static  DNSc_SERVER  DNSc_ServerAddr;
 *********************************************************************************************************
 */
 
-static  CPU_INT16U  DNScReq_TxPrepareMsg (       CPU_INT08U     *p_buf,
-                                                 CPU_INT16U      buf_len,
-                                                 CPU_CHAR       *p_host_name,
-                                                 DNSc_REQ_TYPE   req_type,
-                                                 CPU_INT16U      req_query_id,
-                                                 DNSc_ERR       *p_err);
-
 static  void        DNScReq_RxRespMsg    (const  DNSc_CFG       *p_cfg,
                                                  DNSc_HOST_OBJ  *p_host,
                                                  CPU_INT08U     *p_resp_msg,
@@ -292,6 +292,12 @@ static  void        DNScReq_RxRespAddAddr(const  DNSc_CFG       *p_cfg,
                                                  CPU_INT16U      answer_size,
                                                  DNSc_ERR       *p_err);
 
+static  CPU_INT16U  DNScReq_NameLabelLenGet(const  CPU_CHAR     *p_name,
+                                                   CPU_INT16U    len);
+
+static  void        DNScReq_NameCtrlReplace(       CPU_CHAR     *p_name,
+                                                   CPU_SIZE_T    len);
+
 static  void        DNScReq_TxData       (       NET_SOCK_ID     sock_id,
                                                  CPU_INT08U     *p_buf,
                                                  CPU_INT16U      data_len,
@@ -412,7 +418,8 @@ void  DNScReq_ServerSet (DNSc_ADDR_OBJ  *p_addr,
 *
 * Return(s)   : None.
 *
-* Caller(s)   : DNSc_GetServerByAddr(),
+* Caller(s)   : DNScCache_StatsServerIxGet(),
+*               DNSc_GetServerByAddr(),
 *               DNSc_GetServerByStr().
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
@@ -477,7 +484,9 @@ exit:
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The socket is bound to a random port of the dynamic range, so that the source port of a
+*                   query is as hard to guess as its ID. If DNSc_PORT_RANDOM_BIND_RETRY_MAX random ports are
+*                   in use, the port is left to the stack.
 *********************************************************************************************************
 */
 
@@ -497,6 +506,8 @@ NET_SOCK_ID  DNScReq_Init (DNSc_ADDR_OBJ  *p_server_addr,
     NET_SOCK_ADDR              sock_addr_local;
     NET_SOCK_ADDR_LEN          addr_len;
     CPU_INT08U                *p_addr;
+    NET_PORT_NBR               port_local;
+    CPU_INT08U                 retry;
     NET_ERR                    net_err;
     DNSc_SERVER                server_addr;
     CPU_SR_ALLOC();
@@ -563,18 +574,6 @@ NET_SOCK_ID  DNScReq_Init (DNSc_ADDR_OBJ  *p_server_addr,
     }
 
 
-    NetApp_SetSockAddr(&sock_addr_local,
-                        addr_family,
-                        NET_PORT_NBR_NONE,
-                        p_addr,
-                        addr_len,
-                       &net_err);
-    if (net_err != NET_APP_ERR_NONE) {
-       *p_err = DNSc_ERR_SOCK_OPEN_FAIL;
-        goto exit_close_sock;
-    }
-
-
     NetApp_SetSockAddr(&sock_addr_server,
                         addr_family,
                         port,
@@ -587,10 +586,32 @@ NET_SOCK_ID  DNScReq_Init (DNSc_ADDR_OBJ  *p_server_addr,
     }
 
 
-    (void)NetSock_Bind(sock_id,
-                      &sock_addr_local,
-                       sizeof(sock_addr_local),
-                      &net_err);
+    retry = 0u;                                                 /* See Note #1.                                         */
+    do {
+        if (retry < DNSc_PORT_RANDOM_BIND_RETRY_MAX) {
+            port_local = (NET_PORT_NBR)(DNSc_PORT_RANDOM_MIN + ((DNScReq_RandGet() >> 16u) % DNSc_PORT_RANDOM_NBR));
+        } else {
+            port_local =  NET_PORT_NBR_NONE;
+        }
+        retry++;
+
+        NetApp_SetSockAddr(&sock_addr_local,
+                            addr_family,
+                            port_local,
+                            p_addr,
+                            addr_len,
+                           &net_err);
+        if (net_err != NET_APP_ERR_NONE) {
+           *p_err = DNSc_ERR_SOCK_OPEN_FAIL;
+            goto exit_close_sock;
+        }
+
+        (void)NetSock_Bind(sock_id,
+                          &sock_addr_local,
+                           sizeof(sock_addr_local),
+                          &net_err);
+    } while ((net_err    != NET_SOCK_ERR_NONE) &&
+             (port_local != NET_PORT_NBR_NONE));
     if (net_err != NET_SOCK_ERR_NONE) {
        *p_err = DNSc_ERR_SOCK_OPEN_FAIL;
         goto exit_close_sock;
@@ -630,6 +651,9 @@ exit:
 *
 * Argument(s) : if_nbr_last  Last configured interface number.
 *
+*               if_nbr_pref  Interface to try first, if 'if_nbr_last' is NET_IF_NBR_WILDCARD (see Note #1), or
+*                            NET_IF_NBR_NONE.
+*
 *               sock_id      Socket ID used for the request.
 *
 *               p_err        Pointer to variable that will receive the return error code from this function :
@@ -646,45 +670,56 @@ exit:
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The preferred interface is the last one the server answered through (see 'dns-c_cache.c
+*                   SERVER INTERFACE DATA TYPE'). Only its link is checked if it is up; the interfaces are
+*                   walked from the first one otherwise.
 *********************************************************************************************************
 */
 
 NET_IF_NBR  DNSc_ReqIF_Sel (NET_IF_NBR   if_nbr_last,
+                            NET_IF_NBR   if_nbr_pref,
                             NET_SOCK_ID  sock_id,
                             DNSc_ERR    *p_err)
 {
-    NET_IF_NBR  if_nbr_up = NET_IF_NBR_NONE;
-    NET_IF_NBR  if_nbr_ix;
-    NET_IF_NBR  if_nbr_cfgd;
-    NET_IF_NBR  if_nbr_base;
-    NET_ERR     net_err;
-
-
-    if_nbr_base  = NetIF_GetNbrBaseCfgd();
-    if_nbr_cfgd  = NetIF_GetExtAvailCtr(&net_err);
-    if_nbr_cfgd -= if_nbr_base;
-
-    if (if_nbr_last != NET_IF_NBR_WILDCARD) {
-        if_nbr_ix = if_nbr_last + 1;
-        if (if_nbr_ix > if_nbr_cfgd) {
-           *p_err = DNSc_ERR_NO_RESPONSE;
-            goto exit;
+    NET_IF_NBR         if_nbr_up = NET_IF_NBR_NONE;
+    NET_IF_NBR         if_nbr_ix;
+    NET_IF_NBR         if_nbr_cfgd;
+    NET_IF_NBR         if_nbr_base;
+    NET_IF_LINK_STATE  state;
+    NET_ERR            net_err;
+
+
+    if ((if_nbr_last == NET_IF_NBR_WILDCARD) &&                 /* See Note #1.                                         */
+        (if_nbr_pref != NET_IF_NBR_NONE)) {
+        state = NetIF_LinkStateGet(if_nbr_pref, &net_err);
+        if (state == NET_IF_LINK_UP) {
+            if_nbr_up = if_nbr_pref;
         }
-
-    } else {
-        if_nbr_ix = if_nbr_base;
     }
 
+    if (if_nbr_up == NET_IF_NBR_NONE) {
+        if_nbr_base  = NetIF_GetNbrBaseCfgd();
+        if_nbr_cfgd  = NetIF_GetExtAvailCtr(&net_err);
+        if_nbr_cfgd -= if_nbr_base;
+
+        if (if_nbr_last != NET_IF_NBR_WILDCARD) {
+            if_nbr_ix = if_nbr_last + 1;
+            if (if_nbr_ix > if_nbr_cfgd) {
+               *p_err = DNSc_ERR_NO_RESPONSE;
+                goto exit;
+            }
+
+        } else {
+            if_nbr_ix = if_nbr_base;
+        }
 
-    for (; if_nbr_ix <= if_nbr_cfgd; if_nbr_ix++) {
-        NET_IF_LINK_STATE  state  = NET_IF_LINK_DOWN;
 
-        state = NetIF_LinkStateGet(if_nbr_ix, &net_err);
-        if ((state == NET_IF_LINK_UP) &&
-            (if_nbr_up == NET_IF_NBR_NONE)) {
-            if_nbr_up = if_nbr_ix;
-            break;
+        for (; if_nbr_ix <= if_nbr_cfgd; if_nbr_ix++) {
+            state = NetIF_LinkStateGet(if_nbr_ix, &net_err);
+            if (state == NET_IF_LINK_UP) {
+                if_nbr_up = if_nbr_ix;
+                break;
+            }
         }
     }
 
@@ -739,27 +774,27 @@ void  DNSc_ReqClose (NET_SOCK_ID  sock_id)
 *********************************************************************************************************
 *                                            DNScReq_TxReq()
 *
-* Description : Prepare request and transmit to the server.
+* Description : Complete a query message & transmit it to the server.
 *
-* Argument(s) : p_host_name     Pointer to a string that contains the host name to resolve.
+* Argument(s) : p_msg           Pointer to the query message, encoded by DNScReq_QueryEncode().
 *
-*               sock_id         Socket ID.
+*               msg_len         Length of the query message.
 *
-*               query_id        Query ID of the request.
+*               sock_id         Socket ID.
 *
-*                                   DNSc_QUERY_ID_NONE a new query ID is generated.
+*               query_id        Query ID of the request (see DNScCache_QueryIxAdd()).
 *
 *               req_type        Request type:
 *
-*                                   DNSc_REQ_TYPE_IPv4  Request IPv4 address(es)
-*                                   DNSc_REQ_TYPE_IPv6  Request IPv6 address(es)
+*                                   DNSc_REQ_TYPE_IPv4      Request IPv4 address(es)
+*                                   DNSc_REQ_TYPE_IPv6      Request IPv6 address(es)
+*                                   DNSc_REQ_TYPE_PTR_IPv4  Request the name of an IPv4 address
+*                                   DNSc_REQ_TYPE_PTR_IPv6  Request the name of an IPv6 address
 *
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
-*                                   DNSc_ERR_NONE  Request successfully completed.
-*
-*                               RETURNED BY DNScReq_TxReqPrepare():
-*                                   See DNScReq_TxReqPrepare() for additional return error codes.
+*                                   DNSc_ERR_NONE   Request successfully completed.
+*                                   DNSc_ERR_FAULT  Unknown request type.
 *
 *                               RETURNED BY DNScReq_TxData():
 *                                   See DNScReq_TxData() for additional return error codes.
@@ -772,36 +807,49 @@ void  DNSc_ReqClose (NET_SOCK_ID  sock_id)
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) Only the query ID & the query type are written in the message, at their fixed offsets: the
+*                   header's first field & the 4 last octets of the question, before its class. The name is
+*                   not scanned again.
 *********************************************************************************************************
 */
 
-CPU_INT16U  DNScReq_TxReq (CPU_CHAR       *p_host_name,
+CPU_INT16U  DNScReq_TxReq (CPU_INT08U     *p_msg,
+                           CPU_INT16U      msg_len,
                            NET_SOCK_ID     sock_id,
                            CPU_INT16U      query_id,
                            DNSc_REQ_TYPE   req_type,
                            DNSc_ERR       *p_err)
 {
-    CPU_INT08U  buf[DNSc_PKT_MAX_SIZE];
-    CPU_INT16U  req_query_id = DNSc_QUERY_ID_NONE;
-    CPU_INT16U  data_len;
+    CPU_INT16U  msg_type;
+    CPU_INT16U  val;
 
 
+    switch (req_type) {
+        case DNSc_REQ_TYPE_IPv4:
+             msg_type = DNSc_TYPE_A;
+             break;
 
-    if (query_id == DNSc_QUERY_ID_NONE) {
-        CPU_SR_ALLOC();
+        case DNSc_REQ_TYPE_IPv6:
+             msg_type = DNSc_TYPE_AAAA;
+             break;
 
-        CPU_CRITICAL_ENTER();
-        req_query_id = DNSc_QueryID++;
-        CPU_CRITICAL_EXIT();
-    }
+        case DNSc_REQ_TYPE_PTR_IPv4:
+        case DNSc_REQ_TYPE_PTR_IPv6:
+             msg_type = DNSc_TYPE_PTR;
+             break;
 
-    data_len = DNScReq_TxPrepareMsg(buf, DNSc_PKT_MAX_SIZE, p_host_name, req_type, req_query_id, p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-        goto exit_err;
+        default:
+            *p_err = DNSc_ERR_FAULT;
+             goto exit_err;
     }
+                                                                /* See Note #1.                                         */
+    val = NET_UTIL_HOST_TO_NET_16(query_id);
+    Mem_Copy(p_msg, &val, sizeof(val));
+
+    val = NET_UTIL_HOST_TO_NET_16(msg_type);
+    Mem_Copy(p_msg + msg_len - DNSc_PKT_TYPE_SIZE - DNSc_PKT_CLASS_SIZE, &val, sizeof(val));
 
-    DNScReq_TxData(sock_id, buf, data_len, p_err);
+    DNScReq_TxData(sock_id, p_msg, msg_len, p_err);
     if (*p_err != DNSc_ERR_NONE) {
          goto exit_err;
     }
@@ -814,103 +862,26 @@ CPU_INT16U  DNScReq_TxReq (CPU_CHAR       *p_host_name,
 
 exit_err:
 
-    req_query_id = DNSc_QUERY_ID_NONE;
+    query_id = DNSc_QUERY_ID_NONE;
 
 exit:
-    return (req_query_id);
+    return (query_id);
 }
 
 
 /*
 *********************************************************************************************************
-*                                           DNScReq_RxResp()
+*                                         DNScReq_QueryEncode()
 *
-* Description : Receive DNS response.
+* Description : Encode the query message of a host name, to be sent by DNScReq_TxReq().
 *
-* Argument(s) : p_cfg       Pointer to DNSc's configuration.
+* Argument(s) : p_buf           Buffer where to format the query, of at least DNSc_REQ_QUERY_LEN_MAX() octets.
 *
-*               p_host      Pointer to the host object.
-*
-*               sock_id     Socket ID.
-*
-*               query_id    Query ID of the request.
-*
-*               p_err       Pointer to variable that will receive the return error code from this function :
-*
-*                               DNSc_ERR_NONE   Response received and host resolved.
-*
-*                               RETURNED BY DNScReq_RxData():
-*                                   See DNScReq_RxData() for additional return error codes.
-*
-*                               RETURNED BY DNScReq_RxRespProcess():
-*                                   See DNScReq_RxRespProcess() for additional return error codes.
-*
-* Return(s)   : Request Status:
-*
-*                   DNSc_STATUS_PENDING
-*                   DNSc_STATUS_RESOLVED
-*
-* Caller(s)   : DNScCache_Resp().
-*
-* Note(s)     : None.
-*********************************************************************************************************
-*/
-
-DNSc_STATUS  DNScReq_RxResp (const  DNSc_CFG       *p_cfg,
-                                    DNSc_HOST_OBJ  *p_host,
-                                    NET_SOCK_ID     sock_id,
-                                    CPU_INT16U      query_id,
-                                    DNSc_ERR       *p_err)
-{
-
-    DNSc_STATUS  status = DNSc_STATUS_PENDING;
-    CPU_INT08U   buf[DNSc_PKT_MAX_SIZE];
-    CPU_INT16U   data_len;
-
-
-    data_len = DNScReq_RxData(sock_id, buf, sizeof(buf), p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-         goto exit;
-    }
-
-    DNScReq_RxRespMsg(p_cfg, p_host, buf, data_len, query_id, p_err);
-    if (*p_err != DNSc_ERR_NONE) {
-         goto exit;
-    }
-
-    status = DNSc_STATUS_RESOLVED;
-
-exit:
-    return (status);
-}
-
-
-/*
-*********************************************************************************************************
-*********************************************************************************************************
-*                                      LOCAL FUNCTION PROTOTYPES
-*********************************************************************************************************
-*********************************************************************************************************
-*/
-
-/*
-*********************************************************************************************************
-*                                        DNScReq_TxPrepareMsg()
-*
-* Description : Prepare request's message.
-*
-* Argument(s) : p_buf           Buffer where to format the request.
-*
-*               buf_len         Request's buffer length.
+*               buf_len         Query's buffer length.
 *
 *               p_host_name     Pointer to a string that contains the host name to resolve.
 *
-*               req_type        Request type:
-*
-*                                   DNSc_REQ_TYPE_IPv4  Request IPv4 address(es)
-*                                   DNSc_REQ_TYPE_IPv6  Request IPv6 address(es)
-*
-*               req_query_id    Request ID.
+*               name_len        Length of the host name.
 *
 *               p_err           Pointer to variable that will receive the return error code from this function :
 *
@@ -920,51 +891,34 @@ exit:
 *
 * Return(s)   : Message length.
 *
-* Caller(s)   : DNScReq_TxReq().
+* Caller(s)   : DNScCache_Resolve().
 *
-* Note(s)     : None.
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) The message is encoded once per resolution. The query ID & the query type are left to 0, &
+*                   set by DNScReq_TxReq() before each transmission (see DNScReq_TxReq() Note #1).
 *********************************************************************************************************
 */
 
-static  CPU_INT16U  DNScReq_TxPrepareMsg (CPU_INT08U     *p_buf,
-                                          CPU_INT16U      buf_len,
-                                          CPU_CHAR       *p_host_name,
-                                          DNSc_REQ_TYPE   req_type,
-                                          CPU_INT16U      req_query_id,
-                                          DNSc_ERR       *p_err)
+CPU_INT16U  DNScReq_QueryEncode (CPU_INT08U  *p_buf,
+                                 CPU_INT16U   buf_len,
+                                 CPU_CHAR    *p_host_name,
+                                 CPU_INT16U   name_len,
+                                 DNSc_ERR    *p_err)
 {
     DNSc_HDR    *p_hdr       = (DNSc_HDR *)p_buf;
     CPU_INT08U  *p_query;
     CPU_INT08U  *p_cname;
     CPU_INT16U   msg_len     =  0u;
-    CPU_INT16U   msg_type;
+    CPU_INT16U   msg_type    =  0u;                             /* See Note #1.                                         */
     CPU_INT16U   buf_rem_len = buf_len;
     CPU_INT16U   dns_class;
     CPU_CHAR    *p_name;
-    CPU_CHAR    *p_dot;
-
-
-    switch (req_type) {
-        case DNSc_REQ_TYPE_IPv4:
-             msg_type = DNSc_TYPE_A;
-             break;
-
-        case DNSc_REQ_TYPE_IPv6:
-             msg_type = DNSc_TYPE_AAAA;
-             break;
-
-        case DNSc_REQ_TYPE_PTR_IPv4:
-        case DNSc_REQ_TYPE_PTR_IPv6:
-             msg_type = DNSc_TYPE_PTR;
-             break;
-
-        default:
-            *p_err = DNSc_ERR_FAULT;
-             goto exit;
-    }
+    CPU_INT16U   name_rem_len;
+    CPU_BOOLEAN  is_last;
 
 
-    p_hdr->QueryID       = NET_UTIL_HOST_TO_NET_16(req_query_id);
+    p_hdr->QueryID       = DNSc_QUERY_ID_NONE;                  /* See Note #1.                                         */
     p_hdr->Param         = NET_UTIL_HOST_TO_NET_16(DNSc_PARAM_ENTRY);
     p_hdr->QuestionNbr   = NET_UTIL_HOST_TO_NET_16(DNSc_QUESTION_NBR);
     p_hdr->AnswerNbr     = NET_UTIL_HOST_TO_NET_16(DNSc_ANSWER_NBR);
@@ -977,18 +931,14 @@ static  CPU_INT16U  DNScReq_TxPrepareMsg (CPU_INT08U     *p_buf,
     p_cname      =  p_query;
     buf_rem_len -= (p_query - p_buf);
     p_name       =  p_host_name;
+    name_rem_len =  name_len;
 
     do {                                                        /* Message compression (See RFC-1035 Section 4.1.4)     */
         CPU_INT08U  str_len;
 
 
-        p_dot = Str_Char(p_name, ASCII_CHAR_FULL_STOP);
-        if (p_dot != DEF_NULL) {
-            str_len = p_dot - p_name;                           /* Nb of chars between char and next '.'                */
-
-        } else {
-            str_len = Str_Len_N(p_name, buf_len);               /* Nb of chars between first char and '\0'              */
-        }
+        str_len = DNScReq_NameLabelLenGet(p_name, name_rem_len);/* Nb of chars between char and next '.' or name end.   */
+        is_last = (str_len >= name_rem_len) ? DEF_YES : DEF_NO;
 
 
         if ((str_len <= 0u)          &&
@@ -1002,10 +952,13 @@ static  CPU_INT16U  DNScReq_TxPrepareMsg (CPU_INT08U     *p_buf,
 
         Mem_Copy(p_cname, p_name, str_len);                    /* Copy Chars                                           */
 
-        p_name       = (p_dot   + 1u);
+        p_name      += (str_len + 1u);
         p_cname     +=  str_len;
         buf_rem_len -=  str_len;
-    } while (p_dot);
+        if (is_last == DEF_NO) {
+            name_rem_len -= (str_len + 1u);
+        }
+    } while (is_last == DEF_NO);
 
 
    *p_cname = ASCII_CHAR_NULL;                                  /* Insert end of line char                              */
@@ -1013,8 +966,7 @@ static  CPU_INT16U  DNScReq_TxPrepareMsg (CPU_INT08U     *p_buf,
 
     p_query  = p_cname;
 
-    msg_type = NET_UTIL_HOST_TO_NET_16(msg_type);               /* Set query TYPE.                                      */
-    Mem_Copy(p_query, &msg_type, sizeof(msg_type));
+    Mem_Copy(p_query, &msg_type, sizeof(msg_type));             /* Set query TYPE (see Note #1).                        */
 
 
     p_query += sizeof(msg_type);
@@ -1033,6 +985,142 @@ exit:
 }
 
 
+/*
+*********************************************************************************************************
+*                                           DNScReq_RxResp()
+*
+* Description : Receive DNS response.
+*
+* Argument(s) : p_cfg       Pointer to DNSc's configuration.
+*
+*               p_host      Pointer to the host object.
+*
+*               sock_id     Socket ID.
+*
+*               query_id    Query ID of the request.
+*
+*               p_err       Pointer to variable that will receive the return error code from this function :
+*
+*                               DNSc_ERR_NONE   Response received and host resolved.
+*
+*                               RETURNED BY DNScReq_RxData():
+*                                   See DNScReq_RxData() for additional return error codes.
+*
+*                               RETURNED BY DNScReq_RxRespProcess():
+*                                   See DNScReq_RxRespProcess() for additional return error codes.
+*
+* Return(s)   : Request Status:
+*
+*                   DNSc_STATUS_PENDING
+*                   DNSc_STATUS_RESOLVED
+*
+* Caller(s)   : DNScCache_Resp().
+*
+* Note(s)     : (1) The ID of a response is looked up in the query ID index before the message is parsed. A
+*                   response shorter than a header, or whose ID is not the one in flight for the host, is
+*                   dropped w/ DNSc_ERR_BAD_RESPONSE_ID; the host keeps waiting for its response.
+*
+*               (2) Cache lock must be acquired by the caller.
+*********************************************************************************************************
+*/
+
+DNSc_STATUS  DNScReq_RxResp (const  DNSc_CFG       *p_cfg,
+                                    DNSc_HOST_OBJ  *p_host,
+                                    NET_SOCK_ID     sock_id,
+                                    CPU_INT16U      query_id,
+                                    DNSc_ERR       *p_err)
+{
+
+    DNSc_STATUS  status = DNSc_STATUS_PENDING;
+    CPU_INT08U   buf[DNSc_PKT_MAX_SIZE];
+    CPU_INT16U   data_len;
+    CPU_INT16U   rx_query_id;
+
+
+    data_len = DNScReq_RxData(sock_id, buf, sizeof(buf), p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+                                                                /* See Note #1.                                         */
+    if (data_len < DNSc_PKT_HDR_SIZE) {
+       *p_err = DNSc_ERR_BAD_RESPONSE_ID;
+        goto exit;
+    }
+
+    rx_query_id = ((CPU_INT16U)buf[0] << 8u) | buf[1];
+    if (DNScCache_QueryIxSrch(rx_query_id) != p_host) {
+       *p_err = DNSc_ERR_BAD_RESPONSE_ID;
+        goto exit;
+    }
+
+    DNScReq_RxRespMsg(p_cfg, p_host, buf, data_len, query_id, p_err);
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
+    }
+
+    status = DNSc_STATUS_RESOLVED;
+
+exit:
+    return (status);
+}
+
+
+/*
+*********************************************************************************************************
+*                                           DNScReq_RandGet()
+*
+* Description : Get a pseudo-random number, for query IDs & source ports.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Pseudo-random 32-bit number.
+*
+* Caller(s)   : DNScCache_QueryIxAdd(),
+*               DNScReq_Init().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Xorshift generator (see Marsaglia, 'Xorshift RNGs', 2003). The current time is mixed into
+*                   the state before each draw, so that the sequence depends on when the queries are sent; the
+*                   state is never 0 once a number is drawn.
+*
+*               (2) The generator is fast but not cryptographically secure: it only makes blind spoofing of
+*                   responses harder, together w/ the random source port.
+*********************************************************************************************************
+*/
+
+CPU_INT32U  DNScReq_RandGet (void)
+{
+    CPU_INT32U  ts_ms;
+    CPU_INT32U  val;
+    CPU_SR_ALLOC();
+
+
+    ts_ms = (CPU_INT32U)DNScTask_TS_Get_ms();
+
+    CPU_CRITICAL_ENTER();
+    val = DNScReq_RandState ^ ts_ms;                            /* See Note #1.                                         */
+    if (val == 0u) {
+        val = DNSc_RAND_SEED;
+    }
+    val ^= val << 13u;
+    val ^= val >> 17u;
+    val ^= val <<  5u;
+    DNScReq_RandState = val;
+    CPU_CRITICAL_EXIT();
+
+    return (val);
+}
+
+
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                      LOCAL FUNCTION PROTOTYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
 /*
 *********************************************************************************************************
 *                                          DNScReq_RxRespMsg()
@@ -1067,7 +1155,8 @@ exit:
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The host keeps the lowest TTL of all the answers received for it, which bounds how long
+*                   its cache entry remains valid.
 *********************************************************************************************************
 */
 
@@ -1085,6 +1174,7 @@ static  void  DNScReq_RxRespMsg (const  DNSc_CFG       *p_cfg,
     CPU_INT08U  *p_data;
     CPU_INT16U   answer_type;
     CPU_INT16U   data_16;
+    CPU_INT32U   ttl;
     CPU_INT08U   ix;
 
 
@@ -1180,6 +1270,12 @@ static  void  DNScReq_RxRespMsg (const  DNSc_CFG       *p_cfg,
         Mem_Copy(&answer_type, p_data, sizeof(CPU_INT16U));
         answer_type =  NET_UTIL_NET_TO_HOST_16(answer_type);    /* Get answer TYPE.                                     */
 
+        Mem_Copy(&ttl, p_data + DNSc_PKT_TYPE_SIZE + DNSc_PKT_CLASS_SIZE, sizeof(CPU_INT32U));
+        ttl = NET_UTIL_NET_TO_HOST_32(ttl);                     /* Keep the lowest TTL of the answers (see Note #1).    */
+        if (ttl < p_host->TTL_s) {
+            p_host->TTL_s = ttl;
+        }
+
         p_data += (DNSc_PKT_TYPE_SIZE  +                        /* Skip over the CLASS & the TTL.                       */
                    DNSc_PKT_CLASS_SIZE +
                    DNSc_PKT_TTL_SIZE);
@@ -1225,9 +1321,6 @@ exit:
 *                                   DNSc_ERR_NONE               Address successfully added to the host object.
 *                                   DNSc_ERR_BAD_RESPONSE_TYPE  Unknown answer type.
 *
-*                                   RETURNED BY DNScCache_AddrObjGet():
-*                                       See DNScCache_AddrObjGet() for additional return error codes.
-*
 *                                   RETURNED BY DNScCache_HostAddrInsert():
 *                                       See DNScCache_HostAddrInsert() for additional return error codes.
 *
@@ -1247,40 +1340,32 @@ static  void  DNScReq_RxRespAddAddr (const  DNSc_CFG       *p_cfg,
                                             CPU_INT16U      answer_size,
                                             DNSc_ERR       *p_err)
 {
-    DNSc_ADDR_OBJ  *p_addr;
+    DNSc_ADDR_OBJ   addr;
+    CPU_INT32U      addr_ipv4;
     CPU_CHAR       *p_char;
-    CPU_BOOLEAN     is_reverse;
-    CPU_BOOLEAN     is_canonical;
     CPU_BOOLEAN     is_compressed;
     CPU_SIZE_T      data_len;
     CPU_INT08U      hostname_len;
     CPU_INT08U      append_len;
-    CPU_INT08U      i;
     CPU_BOOLEAN     is_ctrl_char;
 
 
-    is_reverse    =   (answer_type == DNSc_TYPE_PTR);
-    is_canonical  =   (answer_type == DNSc_TYPE_CNAME);
     is_compressed = (*(p_data + (answer_size - DNSc_HOST_NAME_PTR_SIZE)) == DNSc_COMP_ANSWER);
 
-    if ((!is_reverse) && (!is_canonical)) {
-        p_addr = DNScCache_AddrObjGet(p_err);
-        if (*p_err != DNSc_ERR_NONE) {
-            goto exit;
-        }
-    }
+    addr.RevPreferred = DEF_NO;
 
     switch (answer_type) {
         case DNSc_TYPE_A:
-             Mem_Copy(&p_addr->Addr, p_data, sizeof(CPU_INT32U));
-           *(CPU_INT32U *)p_addr->Addr = NET_UTIL_NET_TO_HOST_32(*(CPU_INT32U *)p_addr->Addr);
-             p_addr->Len               = NET_IPv4_ADDR_LEN;
+             Mem_Copy(&addr_ipv4, p_data, sizeof(CPU_INT32U));
+             addr_ipv4 = NET_UTIL_NET_TO_HOST_32(addr_ipv4);
+             Mem_Copy(addr.Addr, &addr_ipv4, sizeof(CPU_INT32U));
+             addr.Len  = NET_IPv4_ADDR_LEN;
              break;
 
 
         case DNSc_TYPE_AAAA:
-             Mem_Copy(p_addr->Addr, p_data, NET_IPv6_ADDR_LEN);
-             p_addr->Len = NET_IPv6_ADDR_LEN;
+             Mem_Copy(addr.Addr, p_data, NET_IPv6_ADDR_LEN);
+             addr.Len = NET_IPv6_ADDR_LEN;
              break;
 
 
@@ -1289,18 +1374,12 @@ static  void  DNScReq_RxRespAddAddr (const  DNSc_CFG       *p_cfg,
                  data_len = answer_size;
                  Mem_Clr(p_host->CanonicalNamePtr, p_host->NameLenMax);
 
-                 p_char = (CPU_CHAR *)p_data;
-
-                 for (i = 0u; i < data_len; i++) {              /* Replace control characters with '.' character.       */
-                      is_ctrl_char = ASCII_IsCtrl(*p_char);
-                      if (is_ctrl_char) {
-                         *p_char = '.';
-                          if (i == 0u) {                        /* Ignore '.' character at the beginning of host name.  */
-                              p_data++;
-                              data_len--;
-                          }
-                      }
-                      p_char++;
+                 is_ctrl_char = ASCII_IsCtrl((CPU_CHAR)*p_data);
+                                                                /* Replace control characters with '.' character.       */
+                 DNScReq_NameCtrlReplace((CPU_CHAR *)p_data, data_len);
+                 if (is_ctrl_char) {                            /* Ignore '.' character at the beginning of host name.  */
+                     p_data++;
+                     data_len--;
                  }
                  p_char = (CPU_CHAR *)p_data;
 
@@ -1332,15 +1411,8 @@ static  void  DNScReq_RxRespAddAddr (const  DNSc_CFG       *p_cfg,
 
         case DNSc_TYPE_PTR:
              data_len = Str_Len_N((const CPU_CHAR *)p_data, p_host->NameLenMax);
-             p_char   = (CPU_CHAR *)p_data;
-
-             for (i = 0u; i < data_len; i++) {                  /* Replace control characters with '.' character.       */
-                  is_ctrl_char = ASCII_IsCtrl(*p_char);
-                  if (is_ctrl_char) {
-                     *p_char = '.';
-                  }
-                  p_char++;
-             }
+                                                                /* Replace control characters with '.' character.       */
+             DNScReq_NameCtrlReplace((CPU_CHAR *)p_data, data_len);
              p_char = (CPU_CHAR *)(p_data + 1u);               /* Ignore first character of the host name.              */
 
              Str_Copy_N(p_host->ReverseNamePtr, p_char, p_host->NameLenMax);
@@ -1350,22 +1422,122 @@ static  void  DNScReq_RxRespAddAddr (const  DNSc_CFG       *p_cfg,
 
         default:
             *p_err = DNSc_ERR_BAD_RESPONSE_TYPE;
-             goto exit_release_addr;
+             goto exit;
     }
 
-    DNScCache_HostAddrInsert(p_cfg, p_host, p_addr, is_reverse, p_err);
-    if ((*p_err != DNSc_ERR_NONE) && (!is_reverse)) {
-        goto exit_release_addr;
+    DNScCache_HostAddrInsert(p_cfg, p_host, &addr, p_err);
+
+
+exit:
+    return;
+}
+
+
+/*
+*********************************************************************************************************
+*                                       DNScReq_NameLabelLenGet()
+*
+* Description : Get the length of the first label of a host name.
+*
+* Argument(s) : p_name      Pointer to a string that contains the host name.
+*
+*               len         Length of the host name.
+*
+* Return(s)   : Number of characters before the first '.' or NULL character, at most 'len'.
+*
+* Caller(s)   : DNScReq_QueryEncode().
+*
+* Note(s)     : (1) Once the name is aligned, it is scanned one word at a time, until a word holds a '.' or a
+*                   NULL character, or the end of the name is reached (see 'dns-c_cache.h  NAME WORD DEFINES').
+*********************************************************************************************************
+*/
+
+static  CPU_INT16U  DNScReq_NameLabelLenGet (const  CPU_CHAR    *p_name,
+                                                    CPU_INT16U   len)
+{
+           CPU_SIZE_T   ix = 0u;
+    const  CPU_CHAR    *p_word;
+           CPU_INT64U   word;
+
+
+    while ((ix         <  len)                  &&
+           (p_name[ix] != ASCII_CHAR_NULL)      &&
+           (p_name[ix] != ASCII_CHAR_FULL_STOP) &&
+           (DNSc_NAME_WORD_IS_ALIGNED(&p_name[ix]) == DEF_NO)) {
+        ix++;
+    }
+                                                                /* See Note #1.                                         */
+    while ((len - ix) >= DNSc_NAME_WORD_SIZE) {
+        p_word = &p_name[ix];
+        word   =  DNSc_NAME_WORD_GET(p_word);
+        if ((DNSc_NAME_WORD_HAS_ZERO(word) |
+             DNSc_NAME_WORD_HAS_CHAR(word, ASCII_CHAR_FULL_STOP)) != 0u) {
+            break;
+        }
+        ix += DNSc_NAME_WORD_SIZE;
     }
 
-    goto exit;
+    while ((ix         <  len)             &&
+           (p_name[ix] != ASCII_CHAR_NULL) &&
+           (p_name[ix] != ASCII_CHAR_FULL_STOP)) {
+        ix++;
+    }
 
+    return ((CPU_INT16U)ix);
+}
 
-exit_release_addr:
-    DNScCache_AddrObjFree(p_addr);
 
-exit:
-    return;
+/*
+*********************************************************************************************************
+*                                       DNScReq_NameCtrlReplace()
+*
+* Description : Replace the control characters of a host name received in a response with '.' characters.
+*
+* Argument(s) : p_name      Pointer to the host name, as received (labels preceded by their length).
+*
+*               len         Length of the host name.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : DNScReq_RxRespAddAddr().
+*
+* Note(s)     : (1) Once the name is aligned, it is scanned one word at a time; only the words that hold a
+*                   control character are scanned again one character at a time (see 'dns-c_cache.h  NAME
+*                   WORD DEFINES').
+*********************************************************************************************************
+*/
+
+static  void  DNScReq_NameCtrlReplace (CPU_CHAR    *p_name,
+                                       CPU_SIZE_T   len)
+{
+    CPU_SIZE_T   ix = 0u;
+    CPU_SIZE_T   end;
+    CPU_CHAR    *p_word;
+    CPU_INT64U   word;
+
+
+    while (ix < len) {
+        end = ix + 1u;                                          /* Scan one char ...                                    */
+        if ((DNSc_NAME_WORD_IS_ALIGNED(&p_name[ix]) == DEF_YES) &&
+            ((len - ix) >= DNSc_NAME_WORD_SIZE)) {
+            p_word = &p_name[ix];
+            word   =  DNSc_NAME_WORD_GET(p_word);
+            if ((DNSc_NAME_WORD_HAS_LESS(word, ASCII_CHAR_SPACE) |
+                 DNSc_NAME_WORD_HAS_CHAR(word, ASCII_CHAR_DELETE)) == 0u) {
+                ix += DNSc_NAME_WORD_SIZE;                      /* ... or skip a word w/o ctrl char (see Note #1).      */
+                end = ix;
+            } else {
+                end = ix + DNSc_NAME_WORD_SIZE;
+            }
+        }
+
+        while (ix < end) {
+            if (ASCII_IsCtrl(p_name[ix]) == DEF_YES) {
+                p_name[ix] = ASCII_CHAR_FULL_STOP;
+            }
+            ix++;
+        }
+    }
 }
 
 
@@ -1431,7 +1603,7 @@ static  void  DNScReq_TxData (NET_SOCK_ID   sock_id,
                  if ((len        > 0u) &&
                      (fail_retry < DNSc_SOCK_TX_RETRY_MAX)) {
 
-                     KAL_Dly(DNSc_SOCK_TX_DLY_MS);
+                     DNScTask_Dly_ms(DNSc_SOCK_TX_DLY_MS);
                      fail_retry++;
 
                  } else {
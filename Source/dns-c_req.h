@@ -52,6 +52,19 @@
 #include  "dns-c.h"
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                               DEFINES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+                                                                /* Max len of a query msg: hdr, name encoded w/ its ... */
+                                                                /* ... first len & its root label, type & class.        */
+#define  DNSc_REQ_QUERY_LEN_MAX(name_len_max)             (12u + (name_len_max) + 2u + 4u)
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -74,12 +87,20 @@ NET_SOCK_ID  DNScReq_Init      (       DNSc_ADDR_OBJ  *p_server_addr,
                                        DNSc_ERR       *p_err);
 
 NET_IF_NBR   DNSc_ReqIF_Sel    (       NET_IF_NBR      if_nbr_last,
+                                       NET_IF_NBR      if_nbr_pref,
                                        NET_SOCK_ID     sock_id,
                                        DNSc_ERR       *p_err);
 
 void         DNSc_ReqClose     (       NET_SOCK_ID     sock_id);
 
-CPU_INT16U   DNScReq_TxReq     (       CPU_CHAR       *p_host_name,
+CPU_INT16U   DNScReq_QueryEncode(      CPU_INT08U     *p_buf,
+                                       CPU_INT16U      buf_len,
+                                       CPU_CHAR       *p_host_name,
+                                       CPU_INT16U      name_len,
+                                       DNSc_ERR       *p_err);
+
+CPU_INT16U   DNScReq_TxReq     (       CPU_INT08U     *p_msg,
+                                       CPU_INT16U      msg_len,
                                        NET_SOCK_ID     sock_id,
                                        CPU_INT16U      query_id,
                                        DNSc_REQ_TYPE   req_type,
@@ -91,4 +112,6 @@ DNSc_STATUS  DNScReq_RxResp    (const  DNSc_CFG       *p_cfg,
                                        CPU_INT16U      query_id,
                                        DNSc_ERR       *p_err);
 
+CPU_INT32U   DNScReq_RandGet   (       void);
+
 #endif  /* DNSc_REQ_PRESENT */
@@ -41,9 +41,27 @@
 #include  "dns-c_type.h"
 #include  "dns-c_task.h"
 #include  "dns-c_cache.h"
+#include  <Source/net_util.h>
 #include  "KAL/kal.h"
 
 
+/*
+*********************************************************************************************************
+*********************************************************************************************************
+*                                          LOCAL DATA TYPES
+*********************************************************************************************************
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+typedef  struct  dnsc_task_worker {                             /* See DNScTask_Init() Note #1.                         */
+    KAL_TASK_HANDLE  TaskHandle;
+    KAL_SEM_HANDLE   SignalHandle;                              /* Posted for each req submitted to the worker.         */
+    CPU_INT08U       Ix;                                        /* Ix of the partition of pending hosts it resolves.    */
+} DNSc_TASK_WORKER;
+#endif
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -53,12 +71,14 @@
 */
 
 #ifdef  DNSc_TASK_MODULE_EN
-       KAL_TASK_HANDLE  DNScTask_TaskHandle;
-       KAL_SEM_HANDLE   DNScTask_SignalHandle;
-#else
-const  DNSc_CFG        *DNScTask_CfgPtr;
+static  DNSc_TASK_WORKER  *DNScTask_WorkerTbl = DEF_NULL;
+static  CPU_INT08U         DNScTask_WorkerNbr = 0u;
 #endif
 
+const  DNSc_CFG        *DNScTask_CfgPtr;
+
+static  const  DNSc_CFG_CLK  *DNScTask_ClkPtr = DEF_NULL;       /* See DNScTask_TS_Get_ms() Note #1.                    */
+
 
 /*
 *********************************************************************************************************
@@ -82,11 +102,14 @@ static  void  DNScTask       (void  *p_arg);
 *
 * Argument(s) : p_cfg   Pointer to the DNSc configuration.
 *
+*               p_task_cfg  Pointer to the task configuration.
+*
 *               p_err   Pointer to variable that will receive the return error code from this function :
 *
 *                           DNSc_ERR_NONE           Successfully initialized
 *                           DNSc_ERR_MEM_ALLOC      Memory allocation error.
 *                           DNSc_ERR_FAULT_INIT     Fault during OS object initialization.
+*                           DNSc_ERR_INVALID_CFG    Clock w/o both of its functions.
 *
 *
 * Return(s)   : None.
@@ -95,7 +118,13 @@ static  void  DNScTask       (void  *p_arg);
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : none.
+* Note(s)     : (1) The asynchronous mode runs '.WorkerNbr' tasks (one when 0). Each pending host belongs to
+*                   the worker of its name hash (see DNScTask_WorkerIxGet()), which alone advances it &
+*                   whose semaphore alone is posted for it, so that the workers pace & wake up independently.
+*                   Each request already owns its socket (see 'dns-c_cache.c  DNScCache_Resolve()').
+*
+*               (2) Every worker is created w/ the same priority & stack size. When '.StkPtr' is not
+*                   DEF_NULL, it must point to '.WorkerNbr' contiguous stacks of '.StkSizeBytes' each.
 *********************************************************************************************************
 */
 
@@ -104,10 +133,31 @@ void  DNScTask_Init (const  DNSc_CFG       *p_cfg,
                             DNSc_ERR       *p_err)
 {
 #ifdef  DNSc_TASK_MODULE_EN
-    void     *p_stack = DEF_NULL;
-    KAL_ERR   kal_err;
+    DNSc_TASK_WORKER  *p_worker;
+    CPU_INT08U        *p_stack = DEF_NULL;
+    CPU_INT08U         worker_nbr;
+    CPU_INT08U         ix;
+    KAL_ERR            kal_err;
+    LIB_ERR            lib_err;
+#endif
 
 
+#if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
+    if ((p_cfg->ClkPtr            != DEF_NULL) &&
+       ((p_cfg->ClkPtr->TS_Get_ms == DEF_NULL) ||
+        (p_cfg->ClkPtr->Dly_ms    == DEF_NULL))) {
+       *p_err = DNSc_ERR_INVALID_CFG;
+        return;
+    }
+#endif
+
+    DNScTask_ClkPtr = p_cfg->ClkPtr;
+
+
+    DNScTask_CfgPtr = p_cfg;
+
+
+#ifdef  DNSc_TASK_MODULE_EN
 #if (DNSc_CFG_ARG_CHK_EXT_EN == DEF_ENABLED)
     if (p_task_cfg == DEF_NULL) {
        *p_err = DNSc_ERR_NULL_PTR;
@@ -115,73 +165,93 @@ void  DNScTask_Init (const  DNSc_CFG       *p_cfg,
     }
 #endif
 
+    worker_nbr = DEF_MAX(p_task_cfg->WorkerNbr, 1u);            /* See Note #1.                                         */
 
-    DNScTask_SignalHandle = KAL_SemCreate("DNSc Task Signal",
-                                           DEF_NULL,
-                                          &kal_err);
-    switch (kal_err) {
-        case KAL_ERR_NONE:
-             break;
+    DNScTask_WorkerTbl = (DNSc_TASK_WORKER *)Mem_SegAlloc("DNSc Task Workers",
+                                                           p_cfg->MemSegPtr,
+                                                          (worker_nbr * sizeof(DNSc_TASK_WORKER)),
+                                                          &lib_err);
+    if (lib_err != LIB_MEM_ERR_NONE) {
+       *p_err = DNSc_ERR_MEM_ALLOC;
+        goto exit;
+    }
 
-        case KAL_ERR_MEM_ALLOC:
-            *p_err = DNSc_ERR_MEM_ALLOC;
-             goto exit;
+    for (ix = 0u; ix < worker_nbr; ix++) {                      /* Create every signal before any worker runs.          */
+        p_worker     = &DNScTask_WorkerTbl[ix];
+        p_worker->Ix =  ix;
 
-        default:
-            *p_err = DNSc_ERR_FAULT_INIT;
-             goto exit;
-    }
+        p_worker->SignalHandle = KAL_SemCreate("DNSc Task Signal",
+                                                DEF_NULL,
+                                               &kal_err);
+        switch (kal_err) {
+            case KAL_ERR_NONE:
+                 break;
 
-    if (p_task_cfg->StkPtr != DEF_NULL) {
-        p_stack = (void *)p_task_cfg->StkPtr;
-    }
+            case KAL_ERR_MEM_ALLOC:
+                *p_err = DNSc_ERR_MEM_ALLOC;
+                 goto exit;
 
-    DNScTask_TaskHandle = KAL_TaskAlloc("DNSc Task",
-                                         p_stack,
-                                         p_task_cfg->StkSizeBytes,
-                                         DEF_NULL,
-                                        &kal_err);
-    switch (kal_err) {
-        case KAL_ERR_NONE:
-             break;
-
-        case KAL_ERR_MEM_ALLOC:
-            *p_err = DNSc_ERR_MEM_ALLOC;
-             goto exit;
-
-        default:
-            *p_err = DNSc_ERR_FAULT_INIT;
-             goto exit;
+            default:
+                *p_err = DNSc_ERR_FAULT_INIT;
+                 goto exit;
+        }
     }
 
+    DNScTask_WorkerNbr = worker_nbr;
 
-    KAL_TaskCreate(DNScTask_TaskHandle,
-                  &DNScTask,
-           (void *)p_cfg,
-                   p_task_cfg->Prio,
-                   DEF_NULL,
-                  &kal_err);
-    switch (kal_err) {
-        case KAL_ERR_NONE:
-             break;
+    for (ix = 0u; ix < worker_nbr; ix++) {
+        p_worker = &DNScTask_WorkerTbl[ix];
+        if (p_task_cfg->StkPtr != DEF_NULL) {                   /* See Note #2.                                         */
+            p_stack = (CPU_INT08U *)p_task_cfg->StkPtr + ((CPU_SIZE_T)ix * p_task_cfg->StkSizeBytes);
+        }
+
+        p_worker->TaskHandle = KAL_TaskAlloc("DNSc Task",
+                                             (void *)p_stack,
+                                              p_task_cfg->StkSizeBytes,
+                                              DEF_NULL,
+                                             &kal_err);
+        switch (kal_err) {
+            case KAL_ERR_NONE:
+                 break;
+
+            case KAL_ERR_MEM_ALLOC:
+                *p_err = DNSc_ERR_MEM_ALLOC;
+                 goto exit;
+
+            default:
+                *p_err = DNSc_ERR_FAULT_INIT;
+                 goto exit;
+        }
+
+
+        KAL_TaskCreate(p_worker->TaskHandle,
+                      &DNScTask,
+               (void *)p_worker,
+                       p_task_cfg->Prio,
+                       DEF_NULL,
+                      &kal_err);
+        switch (kal_err) {
+            case KAL_ERR_NONE:
+                 break;
 
-        case KAL_ERR_MEM_ALLOC:
-            *p_err = DNSc_ERR_MEM_ALLOC;
-             goto exit;
+            case KAL_ERR_MEM_ALLOC:
+                *p_err = DNSc_ERR_MEM_ALLOC;
+                 goto exit;
 
-        default:
-            *p_err = DNSc_ERR_FAULT_INIT;
-             goto exit;
+            default:
+                *p_err = DNSc_ERR_FAULT_INIT;
+                 goto exit;
+        }
     }
 
 
    *p_err = DNSc_ERR_NONE;
 
 exit:
+    return;
 #else
-    DNScTask_CfgPtr = p_cfg;
+   *p_err = DNSc_ERR_NONE;
 #endif
-    return;
 }
 
 
@@ -191,7 +261,7 @@ exit:
 *
 * Description : Function to submit a host resolution to the task or to perform host resolution.
 *
-* Argument(s) : p_host  Pointer to the Host object.
+* Argument(s) : p_host  Pointer to the Host object, already in the cache (see DNScCache_HostInsert()).
 *
 *               flags   Request flag option
 *
@@ -202,9 +272,6 @@ exit:
 *                           DNSc_ERR_NONE               Resolution submitted or completed.
 *                           DNSc_ERR_TASK_SIGNAL
 *
-*                           RETURNED BY DNScCache_HostInsert():
-*                               See DNScCache_HostInsert() for additional return error codes.
-*
 *                           RETURNED BY DNScCache_ProcessHost():
 *                               See DNScCache_ProcessHost() for additional return error codes.
 *
@@ -218,7 +285,16 @@ exit:
 *
 *               This function is an INTERNAL function & MUST NOT be called by application function(s).
 *
-* Note(s)     : None.
+* Note(s)     : (1) The host's semaphore is read before the host is submitted: DNSc's task hands it over when
+*                   it signals the host (see 'dns-c_cache.c  DNScCache_HostSignal()'), possibly before this
+*                   function pends on it. It is deleted here once signaled.
+*
+*               (2) With DNSc_FLAG_PARTIAL, the caller is signaled as soon as the host's IPv4 addresses are
+*                   available; DNSc's task resolves its IPv6 addresses in the background. W/o DNSc's task, the
+*                   flag has no effect on the resolution & this function returns once both are resolved.
+*
+*               (3) A host whose resolution fails here is removed from the cache & released; the caller must
+*                   not release it again.
 *********************************************************************************************************
 */
 
@@ -228,24 +304,25 @@ DNSc_STATUS  DNScTask_HostResolve (DNSc_HOST_OBJ  *p_host,
                                    DNSc_ERR       *p_err)
 {
 #ifdef DNSc_TASK_MODULE_EN
-    KAL_ERR      err;
+    KAL_ERR         err;
+#endif
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+    KAL_SEM_HANDLE  sem;
 #endif
-    DNSc_STATUS  status = DNSc_STATUS_NONE;
-    CPU_BOOLEAN  flag_set;
+    DNSc_STATUS     status = DNSc_STATUS_NONE;
 
 
-    flag_set = DEF_BIT_IS_SET(flags, DNSc_FLAG_REVERSE_LOOKUP);
-    if (((flag_set                != DEF_TRUE)  &&
-         (p_host->ReverseNamePtr  != DEF_NULL)) ||
-         (p_host->AddrsCount      ==       0u)) {
-        DNScCache_HostInsert(p_host, p_err);
-        if (*p_err != DNSc_ERR_NONE) {
-             goto exit;
-        }
+#ifdef DNSc_TASK_MODULE_EN
+#ifdef  DNSc_SIGNAL_TASK_MODULE_EN
+    sem = p_host->TaskSignal;                                   /* See Note #1.                                         */
+#endif
+
+    DNScCache_HostPendInsert(p_host, p_err);                    /* See 'dns-c_cache.c  DNScCache_PendLink()'.           */
+    if (*p_err != DNSc_ERR_NONE) {
+         goto exit;
     }
 
-#ifdef DNSc_TASK_MODULE_EN
-    KAL_SemPost(DNScTask_SignalHandle, KAL_OPT_POST_NONE, &err);
+    KAL_SemPost(DNScTask_WorkerTbl[DNScTask_WorkerIxGet(p_host)].SignalHandle, KAL_OPT_POST_NONE, &err);
 
 
 #ifdef  DNSc_SIGNAL_TASK_MODULE_EN
@@ -253,12 +330,12 @@ DNSc_STATUS  DNScTask_HostResolve (DNSc_HOST_OBJ  *p_host,
         KAL_ERR  err_muck;
 
 
-        status = DNSc_STATUS_UNKNOWN;
-        KAL_SemPend(p_host->TaskSignal, KAL_OPT_PEND_BLOCKING, 0u, &err);
-        KAL_SemDel(p_host->TaskSignal, &err_muck);
+        status = DNSc_STATUS_UNKNOWN;                           /* See Note #2.                                         */
+        KAL_SemPend(sem, KAL_OPT_PEND_BLOCKING, 0u, &err);
+        KAL_SemDel(sem, &err_muck);
        (void)&err_muck;
-        p_host->TaskSignal = KAL_SemHandleNull;
         if (err != KAL_ERR_NONE) {
+            p_host->TaskSignal = KAL_SemHandleNull;
             DNScCache_HostRemove(p_host);
            *p_err  = DNSc_ERR_TASK_SIGNAL;
             status = DNSc_STATUS_FAILED;
@@ -271,6 +348,8 @@ DNSc_STATUS  DNScTask_HostResolve (DNSc_HOST_OBJ  *p_host,
 #endif  /* DNSc_SIGNAL_TASK_MODULE_EN */
 
 #else
+   (void)&flags;
+
     status = DNSc_STATUS_PENDING;
     while (status == DNSc_STATUS_PENDING) {
         CPU_INT16U  dly = DNScTask_CfgPtr->TaskDly_ms;
@@ -283,7 +362,7 @@ DNSc_STATUS  DNScTask_HostResolve (DNSc_HOST_OBJ  *p_host,
 
         status = DNScCache_ResolveHost(DNScTask_CfgPtr, p_host, p_err);
 
-        KAL_Dly(dly);
+        DNScTask_Dly_ms(dly);
     }
 
     if (status == DNSc_STATUS_FAILED) {
@@ -291,11 +370,101 @@ DNSc_STATUS  DNScTask_HostResolve (DNSc_HOST_OBJ  *p_host,
     }
 #endif  /* DNSc_TASK_MODULE_EN */
 
+#ifdef DNSc_TASK_MODULE_EN
 exit:
+#endif
     return (status);
 }
 
 
+/*
+*********************************************************************************************************
+*                                       DNScTask_WorkerIxGet()
+*
+* Description : Get the worker task that resolves a host.
+*
+* Argument(s) : p_host  Pointer to the host object; its name must be set.
+*
+* Return(s)   : Index of the worker.
+*
+* Caller(s)   : DNScTask_HostResolve(),
+*               DNScCache_ResolveAll().
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) See DNScTask_Init() Note #1. The name hash is fixed once the host is inserted, so that a
+*                   pending host stays w/ the same worker until it completes.
+*********************************************************************************************************
+*/
+
+#ifdef  DNSc_TASK_MODULE_EN
+CPU_INT08U  DNScTask_WorkerIxGet (const  DNSc_HOST_OBJ  *p_host)
+{
+    return ((CPU_INT08U)(p_host->NameHash % DNScTask_WorkerNbr));
+}
+#endif
+
+
+/*
+*********************************************************************************************************
+*                                        DNScTask_TS_Get_ms()
+*
+* Description : Get the current time of DNSc's clock.
+*
+* Argument(s) : None.
+*
+* Return(s)   : Current time, in milliseconds.
+*
+* Caller(s)   : Various.
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) Every timeout, TTL & delay of DNSc is measured w/ the clock of the configuration's .ClkPtr,
+*                   or w/ NetUtil_TS_Get_ms() & KAL_Dly() when it is DEF_NULL. A simulator can substitute a
+*                   virtual clock, whose delay advances the time instead of waiting, to replay resolutions
+*                   w/ retransmissions & timeouts deterministically.
+*********************************************************************************************************
+*/
+
+NET_TS_MS  DNScTask_TS_Get_ms (void)
+{
+    if (DNScTask_ClkPtr != DEF_NULL) {
+        return ((NET_TS_MS)DNScTask_ClkPtr->TS_Get_ms());
+    }
+
+    return (NetUtil_TS_Get_ms());
+}
+
+
+/*
+*********************************************************************************************************
+*                                          DNScTask_Dly_ms()
+*
+* Description : Delay the caller on DNSc's clock.
+*
+* Argument(s) : dly_ms  Delay, in milliseconds.
+*
+* Return(s)   : None.
+*
+* Caller(s)   : Various.
+*
+*               This function is an INTERNAL function & MUST NOT be called by application function(s).
+*
+* Note(s)     : (1) See DNScTask_TS_Get_ms() Note #1.
+*********************************************************************************************************
+*/
+
+void  DNScTask_Dly_ms (CPU_INT32U  dly_ms)
+{
+    if (DNScTask_ClkPtr != DEF_NULL) {
+        DNScTask_ClkPtr->Dly_ms(dly_ms);
+        return;
+    }
+
+    KAL_Dly(dly_ms);
+}
+
+
 /*
 *********************************************************************************************************
 *********************************************************************************************************
@@ -308,53 +477,61 @@ exit:
 *********************************************************************************************************
 *                                              DNScTask()
 *
-* Description : DNSc's task.
+* Description : DNSc's worker task.
 *
-* Argument(s) : p_arg   Pointer to task argument, should be the DNSc's configuration.
+* Argument(s) : p_arg   Pointer to task argument, should be the worker (see DNScTask_Init() Note #1).
 *
 * Return(s)   : None.
 *
 * Caller(s)   : Referenced by DNScTask_Init().
 *
-* Note(s)     : None.
+* Note(s)     : (1) While requests are pending, the task waits on its signal until the earliest retransmission
+*                   deadline of its requests (see 'dns-c_cache.c  DNScCache_ResolveAll()  Note #3'), so that a
+*                   new request or a step that can be taken right away is processed w/o delay. The wait is
+*                   bounded by the task delay, the sockets being polled for responses.
+*
+*               (2) A configured clock may not be the one of the kernel: the task polls its signal & delays
+*                   itself through DNScTask_Dly_ms() instead.
+*
+*               (3) The task waits for its signal w/o timeout once none of its requests is pending, as reported
+*                   by DNScCache_ResolveAll(), so that requests completed, cancelled or released outside of the
+*                   task don't keep it polling. If the cache can't be walked, the pass is retried.
 *********************************************************************************************************
 */
 #ifdef  DNSc_TASK_MODULE_EN
 static  void  DNScTask (void  *p_arg)
 {
-    const  DNSc_CFG    *p_cfg           = (const DNSc_CFG *)p_arg;
-           CPU_INT16U   nb_req_active   =  0u;
-           CPU_INT16U   nb_req_resolved =  0u;
-           KAL_OPT      opt;
-           KAL_ERR      kal_err;
-           DNSc_ERR     dns_err;
+    const  DNSc_CFG          *p_cfg           =  DNScTask_CfgPtr;
+           DNSc_TASK_WORKER  *p_worker        = (DNSc_TASK_WORKER *)p_arg;
+           NET_TS_MS          dly_ms          =  DEF_INT_32U_MAX_VAL;
+           CPU_INT32U         timeout_ms;
+           KAL_OPT            opt;
+           KAL_ERR            kal_err;
+           DNSc_ERR           dns_err;
 
 
 
     while (DEF_ON) {
-        opt = KAL_OPT_PEND_NONE;
-        if (nb_req_active > 0u) {
-            DEF_BIT_SET(opt, KAL_OPT_PEND_NON_BLOCKING);
+        opt        = KAL_OPT_PEND_NONE;
+        timeout_ms = KAL_TIMEOUT_INFINITE;
+        if (dly_ms != DEF_INT_32U_MAX_VAL) {                    /* See Note #1.                                         */
+            timeout_ms = DEF_MIN(dly_ms, p_cfg->TaskDly_ms);
+            if ((timeout_ms      == 0u) ||
+                (DNScTask_ClkPtr != DEF_NULL)) {                /* See Note #2.                                         */
+                DEF_BIT_SET(opt, KAL_OPT_PEND_NON_BLOCKING);
+            }
         }
 
-        KAL_SemPend(DNScTask_SignalHandle, opt, 0, &kal_err);
-        switch (kal_err) {
-            case KAL_ERR_NONE:
-                 nb_req_active++;
-                 break;
+        KAL_SemPend(p_worker->SignalHandle, opt, timeout_ms, &kal_err);
 
-            default:
-                 break;
+       (void)DNScCache_ResolveAll(p_cfg, p_worker->Ix, &dly_ms, &dns_err);
+        if (dns_err != DNSc_ERR_NONE) {                         /* Retry after the task delay (see Note #3).            */
+            dly_ms = p_cfg->TaskDly_ms;
         }
 
-        nb_req_resolved = DNScCache_ResolveAll(p_cfg, &dns_err);
-        if (nb_req_resolved < nb_req_active) {
-            nb_req_active  -= nb_req_resolved;
-        } else {
-            nb_req_active   = 0u;
+        if (DNScTask_ClkPtr != DEF_NULL) {
+            DNScTask_Dly_ms(DEF_MIN(dly_ms, p_cfg->TaskDly_ms));
         }
-
-        KAL_Dly(p_cfg->TaskDly_ms);
     }
 }
 #endif
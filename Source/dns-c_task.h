@@ -70,4 +70,12 @@ DNSc_STATUS  DNScTask_HostResolve(       DNSc_HOST_OBJ  *p_host,
                                          DNSc_REQ_CFG   *p_cfg,
                                          DNSc_ERR       *p_err);
 
+#ifdef  DNSc_TASK_MODULE_EN
+CPU_INT08U   DNScTask_WorkerIxGet(const  DNSc_HOST_OBJ  *p_host);
+#endif
+
+NET_TS_MS    DNScTask_TS_Get_ms  (       void);
+
+void         DNScTask_Dly_ms     (       CPU_INT32U      dly_ms);
+
 #endif  /* DNSc_KAL_PRESENT */
@@ -44,9 +44,22 @@ typedef  struct  DNSc_cfg_task {
     CPU_INT32U  Prio;
     CPU_INT16U  StkSizeBytes;
     CPU_ADDR    StkPtr;
+    CPU_INT08U  WorkerNbr;                                      /* See 'dns-c_task.c  DNScTask_Init()  Note #1'.        */
 } DNSc_CFG_TASK;
 
 
+typedef  struct  DNSc_cfg_host {
+    CPU_CHAR   *NamePtr;
+    CPU_CHAR   *AddrPtr;
+} DNSc_CFG_HOST;
+
+
+typedef  struct  DNSc_cfg_clk {                                 /* See 'dns-c_task.c  DNScTask_TS_Get_ms()  Note #1'.   */
+    CPU_INT32U  (*TS_Get_ms)(void);                             /* Get the current time, in milliseconds.               */
+    void        (*Dly_ms)   (CPU_INT32U  dly_ms);               /* Delay the caller, in milliseconds.                   */
+} DNSc_CFG_CLK;
+
+
 typedef  struct DNSc_cfg {
     MEM_SEG        *MemSegPtr;
 
@@ -61,6 +74,12 @@ typedef  struct DNSc_cfg {
     CPU_INT08U      TaskDly_ms;
     CPU_INT08U      ReqRetryNbrMax;
     CPU_INT16U      ReqRetryTimeout_ms;
+
+    DNSc_CFG_HOST  *HostsTblPtr;
+    CPU_INT16U      HostsTblNbr;
+    CPU_CHAR       *HostsFilePtr;
+
+    const  DNSc_CFG_CLK  *ClkPtr;
 } DNSc_CFG;
 
 